@@ -1,84 +1,220 @@
 #include <assert.h>
 #include <qr/ecc.h>
+#include <qr/ecc_tables.h>
+#include <qr/pool.h>
 #include <qr/types.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-#define GF_SIZE 256
-#define PRIMITIVE 0x11D
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
-word gf_log[GF_SIZE];
-static word gf_antilog[(GF_SIZE * 2) - 2];
-static int gf_tables_initialized = 0;
+static inline word
+gf_add(word a, word b)
+{
+	return a ^ b;
+}
+
+// the constant tables of the generator of one degree
+typedef struct
+{
+	size_t degree;
+	// one row per feedback value
+	const parity_row *products;
+	// one table per coefficient
+	const nibble_table *nibbles;
+} generator_tables;
 
 static void
-gf_init_log_antilog(void)
+generator_tables_init(generator_tables *g, size_t degree)
+{
+	assert(degree > 0 && degree <= MAX_ECC_LENGTH && ECC_DEGREE_INDEX[degree] >= 0 && "Generator polynomial degree out of range");
+
+	g->degree = degree;
+	g->products = GENERATOR_PRODUCTS[ECC_DEGREE_INDEX[degree]];
+	g->nibbles = GENERATOR_NIBBLES[ECC_DEGREE_INDEX[degree]];
+}
+
+// consecutive blocks of one type in the interleaved message: data word i < data_length - 1 of block k is
+// data[(i * stride) + k], the last data word is last[k] and ec word j is ecc[(j * stride) + k]
+typedef struct
+{
+	const word *data;
+	const word *last;
+	word *ecc;
+	size_t stride;
+	size_t data_length;
+	size_t block_count;
+} block_group;
+
+static inline const word *
+block_group_row(const block_group *blocks, size_t i)
 {
-	if (gf_tables_initialized) return;
+	return i + 1 == blocks->data_length ? blocks->last : blocks->data + (i * blocks->stride);
+}
 
-	size_t i;
-	word x = 1;
+// each data word shifts the parity register by one word and adds a whole row of the product table
+static void
+ecc_generate(const block_group *blocks, size_t block, const generator_tables *g)
+{
+	uint64_t parity[PARITY_WORDS] = {0};
+	const uint64_t *row;
+	size_t i, w, words = (g->degree + 7) / 8;
 
-	for (i = 0; i < GF_SIZE - 1; ++i)
+	for (i = 0; i < blocks->data_length; ++i)
 	{
-		gf_antilog[i] = x;
-		gf_antilog[i + (GF_SIZE - 1)] = x;
-		gf_log[x] = i;
-		x = (x << 1) ^ ((x & 0x80) ? PRIMITIVE : 0);
+		row = g->products[gf_add(block_group_row(blocks, i)[block], parity[0] & 0xFF)];
+
+		for (w = 0; w + 1 < words; ++w)
+			parity[w] = ((parity[w] >> 8) | (parity[w + 1] << 56)) ^ row[w];
+		parity[words - 1] = (parity[words - 1] >> 8) ^ row[words - 1];
 	}
 
-	gf_tables_initialized = 1;
+	for (i = 0; i < g->degree; ++i)
+		blocks->ecc[(i * blocks->stride) + block] = parity[i / 8] >> (8 * (i % 8));
 }
 
-static inline word
-gf_mul(word a, word b)
-{
-	if (a == 0 || b == 0) return 0;
-	return gf_antilog[gf_log[a] + gf_log[b]];
-}
+#if defined(__x86_64__) || defined(__i386__)
+// blocks of one type are encoded side by side, one block per vector lane
+#define ECC_LANES 1
+// below this many blocks the scalar encoder is faster than filling mostly empty lanes
+#define ECC_LANES_MIN_BLOCKS 4
 
-static inline word
-gf_add(word a, word b)
+// one parity register per lane, every coefficient product is two PSHUFB lookups on the feedback nibbles
+// interleaving puts word i of neighbouring blocks next to each other, so full vectors load and store directly
+__attribute__((target("ssse3")))
+static void
+ecc_generate_lanes_ssse3(const block_group *blocks, const generator_tables *g)
 {
-	return a ^ b;
+	__m128i parity[MAX_ECC_LENGTH + 1], feedback, low, high, nibble = _mm_set1_epi8(0x0F);
+	word lanes[16];
+	const word *row;
+	size_t first, width, lane, i, j, ecc_length = g->degree;
+
+	for (first = 0; first < blocks->block_count; first += width)
+	{
+		width = blocks->block_count - first < 16 ? blocks->block_count - first : 16;
+
+		for (j = 0; j <= ecc_length; ++j)
+			parity[j] = _mm_setzero_si128();
+
+		for (i = 0; i < blocks->data_length; ++i)
+		{
+			row = block_group_row(blocks, i) + first;
+			if (width < 16)
+			{
+				for (lane = 0; lane < 16; ++lane)
+					lanes[lane] = lane < width ? row[lane] : 0;
+				row = lanes;
+			}
+
+			feedback = _mm_xor_si128(_mm_loadu_si128((const __m128i *) row), parity[0]);
+			low = _mm_and_si128(feedback, nibble);
+			high = _mm_and_si128(_mm_srli_epi64(feedback, 4), nibble);
+
+			// parity[ecc_length] stays zero and shifts into the last word
+			for (j = 0; j < ecc_length; ++j)
+				parity[j] = _mm_xor_si128(parity[j + 1], _mm_xor_si128(
+					_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) g->nibbles[j][0]), low),
+					_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) g->nibbles[j][1]), high)));
+		}
+
+		for (j = 0; j < ecc_length; ++j)
+		{
+			if (width == 16)
+			{
+				_mm_storeu_si128((__m128i *) (blocks->ecc + (j * blocks->stride) + first), parity[j]);
+				continue;
+			}
+
+			_mm_storeu_si128((__m128i *) lanes, parity[j]);
+			for (lane = 0; lane < width; ++lane)
+				blocks->ecc[(j * blocks->stride) + first + lane] = lanes[lane];
+		}
+	}
 }
 
+__attribute__((target("avx2")))
 static void
-generator_polynomial(word *poly, size_t degree)
+ecc_generate_lanes_avx2(const block_group *blocks, const generator_tables *g)
 {
-	size_t i, j;
+	__m256i parity[MAX_ECC_LENGTH + 1], feedback, low, high, nibble = _mm256_set1_epi8(0x0F);
+	word lanes[32];
+	const word *row;
+	size_t first, width, lane, i, j, ecc_length = g->degree;
 
-	for (i = 0; i < degree; ++i)
-		poly[i] = 0;
-	poly[degree] = 1;
-
-	for (i = 0; i < degree; ++i)
+	for (first = 0; first < blocks->block_count; first += width)
 	{
-		word coef = gf_antilog[i];
+		width = blocks->block_count - first < 32 ? blocks->block_count - first : 32;
+
+		for (j = 0; j <= ecc_length; ++j)
+			parity[j] = _mm256_setzero_si256();
 
-		for (j = 0; j < degree; ++j)
-			poly[j] = gf_add(poly[j + 1], gf_mul(poly[j], coef));
-		poly[degree] = gf_mul(poly[degree], coef);
+		for (i = 0; i < blocks->data_length; ++i)
+		{
+			row = block_group_row(blocks, i) + first;
+			if (width < 32)
+			{
+				for (lane = 0; lane < 32; ++lane)
+					lanes[lane] = lane < width ? row[lane] : 0;
+				row = lanes;
+			}
+
+			feedback = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) row), parity[0]);
+			low = _mm256_and_si256(feedback, nibble);
+			high = _mm256_and_si256(_mm256_srli_epi64(feedback, 4), nibble);
+
+			for (j = 0; j < ecc_length; ++j)
+				parity[j] = _mm256_xor_si256(parity[j + 1], _mm256_xor_si256(
+					_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) g->nibbles[j][0])), low),
+					_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) g->nibbles[j][1])), high)));
+		}
+
+		for (j = 0; j < ecc_length; ++j)
+		{
+			if (width == 32)
+			{
+				_mm256_storeu_si256((__m256i *) (blocks->ecc + (j * blocks->stride) + first), parity[j]);
+				continue;
+			}
+
+			_mm256_storeu_si256((__m256i *) lanes, parity[j]);
+			for (lane = 0; lane < width; ++lane)
+				blocks->ecc[(j * blocks->stride) + first + lane] = lanes[lane];
+		}
 	}
 }
+#endif
 
 static void
-ecc_generate(const word *data, size_t data_length, word *ecc, size_t ecc_length, word g[ecc_length])
+ecc_generate_blocks(const block_group *blocks, size_t ecc_length)
 {
-	size_t i, j;
-	word feedback;
+	generator_tables g;
+	size_t block;
 
-	for (i = 0; i < ecc_length; ++i)
-		ecc[i] = 0;
+	generator_tables_init(&g, ecc_length);
 
-	for (i = 0; i < data_length; ++i)
+#if ECC_LANES
+	if (blocks->block_count >= ECC_LANES_MIN_BLOCKS)
 	{
-		feedback = gf_add(data[i], ecc[0]);
-		for (j = 0; j < ecc_length - 1; ++j)
-			ecc[j] = gf_add(ecc[j + 1], gf_mul(feedback, g[j]));
-		ecc[ecc_length - 1] = gf_mul(feedback, g[ecc_length - 1]);
+		if (__builtin_cpu_supports("avx2"))
+		{
+			ecc_generate_lanes_avx2(blocks, &g);
+			return;
+		}
+		if (__builtin_cpu_supports("ssse3"))
+		{
+			ecc_generate_lanes_ssse3(blocks, &g);
+			return;
+		}
 	}
+#endif
+
+	for (block = 0; block < blocks->block_count; ++block)
+		ecc_generate(blocks, block, &g);
 }
 
 #define BLOCK_TYPES_PER_VERSION 2
@@ -194,77 +330,112 @@ static const size_t TOTAL_DATA_CODEWORD_COUNT[QR_EC_LEVEL_COUNT][QR_VERSION_COUN
 	}
 };
 
-void
-qr_ec_encode(qr_code *qr)
+// ec codewords of the blocks [first, last), numbered across both block types in order
+// the data codewords are read from and the ec codewords written to their interleaved positions
+static void
+ecc_generate_range(qr_code *qr, size_t first, size_t last)
 {
-	gf_init_log_antilog();
-
-	size_t i, j, data_length, ecc_length;
-	word *data = qr->codewords;
-	word *ecc = qr->codewords + TOTAL_DATA_CODEWORD_COUNT[qr->level][qr->version];
+	const size_t *block_count = BLOCK_COUNT[qr->level][qr->version];
+	const size_t *data_length = DATA_CODEWORD_COUNT[qr->level][qr->version];
+	size_t i, block = 0, from, to, stride = block_count[0] + block_count[1];
+	size_t ecc_length = TOTAL_CODEWORD_COUNT[qr->level][qr->version][0] - data_length[0];
+	block_group blocks;
 
 	for (i = 0; i < BLOCK_TYPES_PER_VERSION; ++i)
 	{
-		data_length = DATA_CODEWORD_COUNT[qr->level][qr->version][i];
-		ecc_length = TOTAL_CODEWORD_COUNT[qr->level][qr->version][i] - data_length;
-		word generator[ecc_length + 1];
-		generator_polynomial(generator, ecc_length);
-
-		for (j = 0; j < BLOCK_COUNT[qr->level][qr->version][i]; ++j)
-		{
-			ecc_generate(data, data_length, ecc, ecc_length, generator + 1);
-			data += data_length;
-			ecc += ecc_length;
-		}
+		from = first > block ? first : block;
+		to = last < block + block_count[i] ? last : block + block_count[i];
+		block += block_count[i];
+		if (from >= to) continue;
+
+		blocks.data = qr->codewords + from;
+		// the longer blocks of the second type have one data word more, interleaved after all the others
+		blocks.last = i ? qr->codewords + (data_length[0] * stride) + (from - block_count[0]) : qr->codewords + ((data_length[0] - 1) * stride) + from;
+		blocks.ecc = qr->codewords + TOTAL_DATA_CODEWORD_COUNT[qr->level][qr->version] + from;
+		blocks.stride = stride;
+		blocks.data_length = data_length[i];
+		blocks.block_count = to - from;
+
+		ecc_generate_blocks(&blocks, ecc_length);
 	}
+}
+
+typedef struct
+{
+	qr_code *qr;
+	unsigned shares;
+	size_t block_count;
+} ecc_task;
 
-	assert(data - qr->codewords == (long int) TOTAL_DATA_CODEWORD_COUNT[qr->level][qr->version] && "Sum of data codewords in blocks do not match expected number of data codewords");
-	assert(ecc - qr->codewords == (long int) qr->codeword_count && "Number of generated ec codewords do not match the expected number of codewords");
+static void
+ecc_task_run(void *arg, size_t index)
+{
+	ecc_task *task = arg;
+
+	ecc_generate_range(task->qr, (index * task->block_count) / task->shares, ((index + 1) * task->block_count) / task->shares);
 }
 
-static word *
-interleave_words(const size_t codeword_count[BLOCK_TYPES_PER_VERSION], const size_t block_count[BLOCK_TYPES_PER_VERSION], word *in, word *out)
+// every share of the blocks is a contiguous range whose ec codewords are written by one thread of the shared pool
+static void
+ecc_generate_parallel(qr_code *qr, unsigned threads, size_t block_count)
 {
-	size_t i, block, codeword;
-	size_t block_offsets[BLOCK_TYPES_PER_VERSION], max_codeword_count = 0;
+	ecc_task task = { .qr = qr, .block_count = block_count };
+
+	if (threads > QR_POOL_MAX_THREADS) threads = QR_POOL_MAX_THREADS;
+
+	task.shares = threads;
+	qr_pool_run(ecc_task_run, &task, threads);
+}
+
+void
+qr_ec_encode(qr_code *qr)
+{
+	size_t i, block_count = 0, data_count = 0, total_count = 0;
 
 	for (i = 0; i < BLOCK_TYPES_PER_VERSION; ++i)
 	{
-		block_offsets[i] = i ? block_offsets[i - 1] + (codeword_count[i - 1] * block_count[i - 1]) : 0;
-		if (codeword_count[i] > max_codeword_count)
-			max_codeword_count = codeword_count[i];
+		block_count += BLOCK_COUNT[qr->level][qr->version][i];
+		data_count += BLOCK_COUNT[qr->level][qr->version][i] * DATA_CODEWORD_COUNT[qr->level][qr->version][i];
+		total_count += BLOCK_COUNT[qr->level][qr->version][i] * TOTAL_CODEWORD_COUNT[qr->level][qr->version][i];
 	}
 
-	for (codeword = 0; codeword < max_codeword_count; ++codeword)
-	{
-		for (i = 0; i < BLOCK_TYPES_PER_VERSION; ++i)
-		{
-			if (codeword >= codeword_count[i]) continue;
+	assert((!BLOCK_COUNT[qr->level][qr->version][1] || DATA_CODEWORD_COUNT[qr->level][qr->version][1] == DATA_CODEWORD_COUNT[qr->level][qr->version][0] + 1) && "Blocks of the second type must be one data codeword longer");
+	assert((!BLOCK_COUNT[qr->level][qr->version][1] || TOTAL_CODEWORD_COUNT[qr->level][qr->version][1] == TOTAL_CODEWORD_COUNT[qr->level][qr->version][0] + 1) && "All blocks must have the same number of ec codewords");
 
-			for (block = 0; block < block_count[i]; ++block)
-				*(out++) = in[(block * codeword_count[i]) + codeword + block_offsets[i]];
-		}
-	}
+	assert(data_count == TOTAL_DATA_CODEWORD_COUNT[qr->level][qr->version] && "Sum of data codewords in blocks do not match expected number of data codewords");
+	assert(total_count == qr->codeword_count && "Number of generated ec codewords do not match the expected number of codewords");
 
-	return out;
+	if (qr->ecc_threads > 1 && block_count >= QR_ECC_PARALLEL_MIN_BLOCKS)
+		ecc_generate_parallel(qr, qr->ecc_threads, block_count);
+	else
+		ecc_generate_range(qr, 0, block_count);
+}
+
+size_t
+qr_data_codeword_count(qr_ec_level level, unsigned version)
+{
+	return TOTAL_DATA_CODEWORD_COUNT[level][version];
 }
 
 void
-qr_interleave_codewords(qr_code *qr)
+qr_codeword_positions(const qr_code *qr, uint16_t *positions)
 {
-	word final_message[qr->codeword_count], *word_ptr = final_message;
-	const size_t *data_codeword_count = DATA_CODEWORD_COUNT[qr->level][qr->version];
 	const size_t *block_count = BLOCK_COUNT[qr->level][qr->version];
-	size_t i, ecc_codeword_count[BLOCK_TYPES_PER_VERSION];
+	const size_t *data_length = DATA_CODEWORD_COUNT[qr->level][qr->version];
+	size_t i, j, block, blocks = block_count[0] + block_count[1];
+	size_t data_count = TOTAL_DATA_CODEWORD_COUNT[qr->level][qr->version];
+	size_t ecc_length = (qr->codeword_count - data_count) / blocks;
 
-	for (i = 0; i < BLOCK_TYPES_PER_VERSION; ++i)
-		ecc_codeword_count[i] = TOTAL_CODEWORD_COUNT[qr->level][qr->version][i] - data_codeword_count[i];
-
-	word_ptr = interleave_words(data_codeword_count, block_count, qr->codewords, word_ptr);
-	word_ptr = interleave_words(ecc_codeword_count, block_count, qr->codewords + TOTAL_DATA_CODEWORD_COUNT[qr->level][qr->version], word_ptr);
-
-	assert(word_ptr == final_message + qr->codeword_count && "Length of interleaved message does not match length of original message");
+	// data codewords: word i of every block in turn, the extra last word of the longer blocks at the end
+	for (block = 0; block < blocks; ++block)
+	{
+		i = block < block_count[0] ? 0 : 1;
+		for (j = 0; j < data_length[i]; ++j)
+			*(positions++) = j < data_length[0] ? (j * blocks) + block : (data_length[0] * blocks) + block - block_count[0];
+	}
 
-	for (i = 0; i < qr->codeword_count; ++i)
-		qr->codewords[i] = final_message[i];
+	// ec codewords: word j of every block in turn
+	for (block = 0; block < blocks; ++block)
+		for (j = 0; j < ecc_length; ++j)
+			*(positions++) = data_count + (j * blocks) + block;
 }
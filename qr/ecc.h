@@ -2,8 +2,17 @@
 #define QR_ECC_H
 
 #include <qr/types.h>
+#include <stddef.h>
+#include <stdint.h>
 
+// smallest number of ec blocks for which qr_code.ecc_threads > 1 splits the blocks between worker threads
+#define QR_ECC_PARALLEL_MIN_BLOCKS 32
+
+size_t qr_data_codeword_count(qr_ec_level level, unsigned version);
+// positions in the interleaved message of the data codewords of all blocks in order, then their ec codewords;
+// fills qr->codeword_count entries
+void qr_codeword_positions(const qr_code *qr, uint16_t *positions);
+// expects the data codewords at their interleaved positions and writes the ec codewords to theirs
 void qr_ec_encode(qr_code *qr);
-void qr_interleave_codewords(qr_code *qr);
 
 #endif // QR_ECC_H
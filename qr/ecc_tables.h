@@ -0,0 +1,2002 @@
+#ifndef QR_ECC_TABLES_H
+#define QR_ECC_TABLES_H
+
+#include <qr/types.h>
+#include <stdint.h>
+
+// constant multiplication tables of the generator polynomials, generated by qr/ecc_tables.py; only the degrees
+// used by ec blocks are present, the tests check them against GF(256)
+
+#define GF_SIZE 256
+
+// longest ec block of any version and level
+#define MAX_ECC_LENGTH 30
+
+// parity register of an ec block, byte j lives in bits 8 * (j % 8) of word j / 8
+#define PARITY_WORDS ((MAX_ECC_LENGTH + 7) / 8)
+typedef uint64_t parity_row[PARITY_WORDS];
+
+// split-nibble multiplication tables of one coefficient: products with the 16 low nibbles, then the 16 high nibbles
+typedef word nibble_table[2][16];
+
+#define ECC_DEGREE_COUNT 13
+
+// index into the tables below by generator degree, -1 for degrees no ec block uses
+static const int ECC_DEGREE_INDEX[MAX_ECC_LENGTH + 1] =
+{
+	-1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, 3, 4, 5, 6, -1, 7, -1, 8, -1, 9, -1, 10, -1, 11, -1, 12
+};
+
+// products of every feedback value with the generator coefficients, packed like the parity register
+static const parity_row GENERATOR_PRODUCTS[ECC_DEGREE_COUNT][GF_SIZE] =
+{
+	{ // 7
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0075440ba49a7a7fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00ea88165529f4feULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x009fcc1df1b38e81ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00c90d2caa52f5e1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00bc49270ec88f9eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0023853aff7b011fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0056c1315be17b60ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x008f1a5849a4f7dfULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00fa5e53ed3e8da0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0065924e1c8d0321ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0010d645b817795eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00461774e3f6023eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0033537f476c7841ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00ac9f62b6dff6c0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00d9db6912458cbfULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x000334b09255f3a3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x007670bb36cf89dcULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00e9bca6c77c075dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x009cf8ad63e67d22ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00ca399c38070642ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00bf7d979c9d7c3dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0020b18a6d2ef2bcULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0055f581c9b488c3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x008c2ee8dbf1047cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00f96ae37f6b7e03ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0066a6fe8ed8f082ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0013e2f52a428afdULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x004523c471a3f19dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x003067cfd5398be2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00afabd2248a0563ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00daefd980107f1cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0006687d39aafb5bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00732c769d308124ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00ece06b6c830fa5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0099a460c81975daULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00cf655193f80ebaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ba215a376274c5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0025ed47c6d1fa44ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0050a94c624b803bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00897225700e0c84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00fc362ed49476fbULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0063fa332527f87aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0016be3881bd8205ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00407f09da5cf965ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00353b027ec6831aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00aaf71f8f750d9bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00dfb3142bef77e4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00055ccdabff08f8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x007018c60f657287ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00efd4dbfed6fc06ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x009a90d05a4c8679ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00cc51e101adfd19ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00b915eaa5378766ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0026d9f7548409e7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00539dfcf01e7398ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x008a4695e25bff27ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ff029e46c18558ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0060ce83b7720bd9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00158a8813e871a6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00434bb948090ac6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00360fb2ec9370b9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00a9c3af1d20fe38ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00dc87a4b9ba8447ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x000cd0fa7249ebb6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x007994f1d6d391c9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00e658ec27601f48ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00931ce783fa6537ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00c5ddd6d81b1e57ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00b099dd7c816428ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x002f55c08d32eaa9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x005a11cb29a890d6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0083caa23bed1c69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00f68ea99f776616ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x006942b46ec4e897ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x001c06bfca5e92e8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x004ac78e91bfe988ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x003f8385352593f7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00a04f98c4961d76ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00d50b93600c6709ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x000fe44ae01c1815ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x007aa0414486626aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00e56c5cb535ecebULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0090285711af9694ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00c6e9664a4eedf4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00b3ad6deed4978bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x002c61701f67190aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0059257bbbfd6375ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0080fe12a9b8efcaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00f5ba190d2295b5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x006a7604fc911b34ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x001f320f580b614bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0049f33e03ea1a2bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x003cb735a7706054ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00a37b2856c3eed5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00d63f23f25994aaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x000ab8874be310edULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x007ffc8cef796a92ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00e030911ecae413ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0095749aba509e6cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00c3b5abe1b1e50cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00b6f1a0452b9f73ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00293dbdb49811f2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x005c79b610026b8dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0085a2df0247e732ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00f0e6d4a6dd9d4dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x006f2ac9576e13ccULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x001a6ec2f3f469b3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x004caff3a81512d3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0039ebf80c8f68acULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00a627e5fd3ce62dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00d363ee59a69c52ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00098c37d9b6e34eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x007cc83c7d2c9931ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00e304218c9f17b0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0096402a28056dcfULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00c0811b73e416afULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00b5c510d77e6cd0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x002a090d26cde251ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x005f4d068257982eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0086966f90121491ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00f3d26434886eeeULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x006c1e79c53be06fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00195a7261a19a10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x004f9b433a40e170ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x003adf489eda9b0fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00a513556f69158eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00d0575ecbf36ff1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0018bde9e492cb71ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x006df9e24008b10eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00f235ffb1bb3f8fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008771f4152145f0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00d1b0c54ec03e90ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00a4f4ceea5a44efULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x003b38d31be9ca6eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x004e7cd8bf73b011ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0097a7b1ad363caeULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00e2e3ba09ac46d1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x007d2fa7f81fc850ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00086bac5c85b22fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x005eaa9d0764c94fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x002bee96a3feb330ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00b4228b524d3db1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00c16680f6d747ceULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x001b895976c738d2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x006ecd52d25d42adULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00f1014f23eecc2cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008445448774b653ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00d28475dc95cd33ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00a7c07e780fb74cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00380c6389bc39cdULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x004d48682d2643b2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x009493013f63cf0dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00e1d70a9bf9b572ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x007e1b176a4a3bf3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x000b5f1cced0418cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x005d9e2d95313aecULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0028da2631ab4093ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00b7163bc018ce12ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00c252306482b46dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x001ed594dd38302aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x006b919f79a24a55ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00f45d828811c4d4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008119892c8bbeabULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00d7d8b8776ac5cbULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00a29cb3d3f0bfb4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x003d50ae22433135ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x004814a586d94b4aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0091cfcc949cc7f5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00e48bc73006bd8aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x007b47dac1b5330bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x000e03d1652f4974ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0058c2e03ece3214ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x002d86eb9a54486bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00b24af66be7c6eaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00c70efdcf7dbc95ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x001de1244f6dc389ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0068a52febf7b9f6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00f769321a443777ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00822d39bede4d08ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00d4ec08e53f3668ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00a1a80341a54c17ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x003e641eb016c296ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x004b2015148cb8e9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0092fb7c06c93456ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00e7bf77a2534e29ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0078736a53e0c0a8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x000d3761f77abad7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x005bf650ac9bc1b7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x002eb25b0801bbc8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00b17e46f9b23549ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00c43a4d5d284f36ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00146d1396db20c7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0061291832415ab8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00fee505c3f2d439ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008ba10e6768ae46ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00dd603f3c89d526ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00a824349813af59ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0037e82969a021d8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0042ac22cd3a5ba7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x009b774bdf7fd718ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ee33407be5ad67ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0071ff5d8a5623e6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0004bb562ecc5999ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00527a67752d22f9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00273e6cd1b75886ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00b8f2712004d607ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00cdb67a849eac78ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x001759a3048ed364ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00621da8a014a91bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00fdd1b551a7279aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008895bef53d5de5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00de548faedc2685ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ab10840a465cfaULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0034dc99fbf5d27bULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x004198925f6fa804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x009843fb4d2a24bbULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ed07f0e9b05ec4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0072cbed1803d045ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00078fe6bc99aa3aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00514ed7e778d15aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00240adc43e2ab25ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00bbc6c1b25125a4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ce82ca16cb5fdbULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0012056eaf71db9cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x006741650beba1e3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00f88d78fa582f62ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008dc9735ec2551dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00db084205232e7dULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ae4c49a1b95402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00318054500ada83ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0044c45ff490a0fcULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x009d1f36e6d52c43ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00e85b3d424f563cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00779720b3fcd8bdULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0002d32b1766a2c2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0054121a4c87d9a2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00215611e81da3ddULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00be9a0c19ae2d5cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00cbde07bd345723ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x001131de3d24283fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x006475d599be5240ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00fbb9c8680ddcc1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x008efdc3cc97a6beULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00d83cf29776dddeULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00ad78f933eca7a1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0032b4e4c25f2920ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0047f0ef66c5535fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x009e2b867480dfe0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00eb6f8dd01aa59fULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0074a39021a92b1eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0001e79b85335161ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x005726aaded22a01ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x002262a17a48507eULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x00bdaebc8bfbdeffULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x00c8eab72f61a480ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+	},
+	{ // 10
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x715f5ec76f9fc2d8ULL, 0x000000000000c19dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe2bebc93de2399adULL, 0x0000000000009f27ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x93e1e254b1bc5b75ULL, 0x0000000000005ebaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd961653ba1462f47ULL, 0x000000000000234eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa83e3bfcced9ed9fULL, 0x000000000000e2d3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3bdfd9a87f65b6eaULL, 0x000000000000bc69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4a80876f10fa7432ULL, 0x0000000000007df4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xafc2ca765f8c5e8eULL, 0x000000000000469cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xde9d94b130139c56ULL, 0x0000000000008701ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4d7c76e581afc723ULL, 0x000000000000d9bbULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3c232822ee3005fbULL, 0x0000000000001826ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x76a3af4dfeca71c9ULL, 0x00000000000065d2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x07fcf18a9155b311ULL, 0x000000000000a44fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x941d13de20e9e864ULL, 0x000000000000faf5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe5424d194f762abcULL, 0x0000000000003b68ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x439989ecbe05bc01ULL, 0x0000000000008c25ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x32c6d72bd19a7ed9ULL, 0x0000000000004db8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa127357f602625acULL, 0x0000000000001302ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd0786bb80fb9e774ULL, 0x000000000000d29fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9af8ecd71f439346ULL, 0x000000000000af6bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xeba7b21070dc519eULL, 0x0000000000006ef6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x78465044c1600aebULL, 0x000000000000304cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x09190e83aeffc833ULL, 0x000000000000f1d1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xec5b439ae189e28fULL, 0x000000000000cab9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9d041d5d8e162057ULL, 0x0000000000000b24ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0ee5ff093faa7b22ULL, 0x000000000000559eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7fbaa1ce5035b9faULL, 0x0000000000009403ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x353a26a140cfcdc8ULL, 0x000000000000e9f7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x446578662f500f10ULL, 0x000000000000286aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd7849a329eec5465ULL, 0x00000000000076d0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa6dbc4f5f17396bdULL, 0x000000000000b74dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x862f0fc5610a6502ULL, 0x000000000000054aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf77051020e95a7daULL, 0x000000000000c4d7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6491b356bf29fcafULL, 0x0000000000009a6dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x15ceed91d0b63e77ULL, 0x0000000000005bf0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5f4e6afec04c4a45ULL, 0x0000000000002604ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2e113439afd3889dULL, 0x000000000000e799ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbdf0d66d1e6fd3e8ULL, 0x000000000000b923ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xccaf88aa71f01130ULL, 0x00000000000078beULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x29edc5b33e863b8cULL, 0x00000000000043d6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x58b29b745119f954ULL, 0x000000000000824bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcb537920e0a5a221ULL, 0x000000000000dcf1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xba0c27e78f3a60f9ULL, 0x0000000000001d6cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf08ca0889fc014cbULL, 0x0000000000006098ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x81d3fe4ff05fd613ULL, 0x000000000000a105ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x12321c1b41e38d66ULL, 0x000000000000ffbfULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x636d42dc2e7c4fbeULL, 0x0000000000003e22ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc5b68629df0fd903ULL, 0x000000000000896fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb4e9d8eeb0901bdbULL, 0x00000000000048f2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x27083aba012c40aeULL, 0x0000000000001648ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5657647d6eb38276ULL, 0x000000000000d7d5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1cd7e3127e49f644ULL, 0x000000000000aa21ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6d88bdd511d6349cULL, 0x0000000000006bbcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfe695f81a06a6fe9ULL, 0x0000000000003506ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8f360146cff5ad31ULL, 0x000000000000f49bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6a744c5f8083878dULL, 0x000000000000cff3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1b2b1298ef1c4555ULL, 0x0000000000000e6eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x88caf0cc5ea01e20ULL, 0x00000000000050d4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf995ae0b313fdcf8ULL, 0x0000000000009149ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb315296421c5a8caULL, 0x000000000000ecbdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc24a77a34e5a6a12ULL, 0x0000000000002d20ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x51ab95f7ffe63167ULL, 0x000000000000739aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x20f4cb309079f3bfULL, 0x000000000000b207ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x115e1e97c214ca04ULL, 0x0000000000000a94ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x60014050ad8b08dcULL, 0x000000000000cb09ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf3e0a2041c3753a9ULL, 0x00000000000095b3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x82bffcc373a89171ULL, 0x000000000000542eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc83f7bac6352e543ULL, 0x00000000000029daULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb960256b0ccd279bULL, 0x000000000000e847ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2a81c73fbd717ceeULL, 0x000000000000b6fdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5bde99f8d2eebe36ULL, 0x0000000000007760ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbe9cd4e19d98948aULL, 0x0000000000004c08ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcfc38a26f2075652ULL, 0x0000000000008d95ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5c22687243bb0d27ULL, 0x000000000000d32fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2d7d36b52c24cfffULL, 0x00000000000012b2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x67fdb1da3cdebbcdULL, 0x0000000000006f46ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x16a2ef1d53417915ULL, 0x000000000000aedbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x85430d49e2fd2260ULL, 0x000000000000f061ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf41c538e8d62e0b8ULL, 0x00000000000031fcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x52c7977b7c117605ULL, 0x00000000000086b1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2398c9bc138eb4ddULL, 0x000000000000472cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb0792be8a232efa8ULL, 0x0000000000001996ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc126752fcdad2d70ULL, 0x000000000000d80bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8ba6f240dd575942ULL, 0x000000000000a5ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfaf9ac87b2c89b9aULL, 0x0000000000006462ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x69184ed30374c0efULL, 0x0000000000003ad8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x184710146ceb0237ULL, 0x000000000000fb45ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfd055d0d239d288bULL, 0x000000000000c02dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8c5a03ca4c02ea53ULL, 0x00000000000001b0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1fbbe19efdbeb126ULL, 0x0000000000005f0aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6ee4bf59922173feULL, 0x0000000000009e97ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2464383682db07ccULL, 0x000000000000e363ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x553b66f1ed44c514ULL, 0x00000000000022feULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc6da84a55cf89e61ULL, 0x0000000000007c44ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb785da6233675cb9ULL, 0x000000000000bdd9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x97711152a31eaf06ULL, 0x0000000000000fdeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe62e4f95cc816ddeULL, 0x000000000000ce43ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x75cfadc17d3d36abULL, 0x00000000000090f9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0490f30612a2f473ULL, 0x0000000000005164ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4e10746902588041ULL, 0x0000000000002c90ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3f4f2aae6dc74299ULL, 0x000000000000ed0dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xacaec8fadc7b19ecULL, 0x000000000000b3b7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xddf1963db3e4db34ULL, 0x000000000000722aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x38b3db24fc92f188ULL, 0x0000000000004942ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x49ec85e3930d3350ULL, 0x00000000000088dfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xda0d67b722b16825ULL, 0x000000000000d665ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xab5239704d2eaafdULL, 0x00000000000017f8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe1d2be1f5dd4decfULL, 0x0000000000006a0cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x908de0d8324b1c17ULL, 0x000000000000ab91ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x036c028c83f74762ULL, 0x000000000000f52bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x72335c4bec6885baULL, 0x00000000000034b6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd4e898be1d1b1307ULL, 0x00000000000083fbULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa5b7c6797284d1dfULL, 0x0000000000004266ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3656242dc3388aaaULL, 0x0000000000001cdcULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x47097aeaaca74872ULL, 0x000000000000dd41ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0d89fd85bc5d3c40ULL, 0x000000000000a0b5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7cd6a342d3c2fe98ULL, 0x0000000000006128ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xef374116627ea5edULL, 0x0000000000003f92ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9e681fd10de16735ULL, 0x000000000000fe0fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7b2a52c842974d89ULL, 0x000000000000c567ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0a750c0f2d088f51ULL, 0x00000000000004faULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9994ee5b9cb4d424ULL, 0x0000000000005a40ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe8cbb09cf32b16fcULL, 0x0000000000009bddULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa24b37f3e3d162ceULL, 0x000000000000e629ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd31469348c4ea016ULL, 0x00000000000027b4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x40f58b603df2fb63ULL, 0x000000000000790eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x31aad5a7526d39bbULL, 0x000000000000b893ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x22bc3c3399288908ULL, 0x0000000000001435ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x53e362f4f6b74bd0ULL, 0x000000000000d5a8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc00280a0470b10a5ULL, 0x0000000000008b12ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb15dde672894d27dULL, 0x0000000000004a8fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfbdd5908386ea64fULL, 0x000000000000377bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8a8207cf57f16497ULL, 0x000000000000f6e6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1963e59be64d3fe2ULL, 0x000000000000a85cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x683cbb5c89d2fd3aULL, 0x00000000000069c1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8d7ef645c6a4d786ULL, 0x00000000000052a9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfc21a882a93b155eULL, 0x0000000000009334ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6fc04ad618874e2bULL, 0x000000000000cd8eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1e9f141177188cf3ULL, 0x0000000000000c13ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x541f937e67e2f8c1ULL, 0x00000000000071e7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2540cdb9087d3a19ULL, 0x000000000000b07aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb6a12fedb9c1616cULL, 0x000000000000eec0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc7fe712ad65ea3b4ULL, 0x0000000000002f5dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6125b5df272d3509ULL, 0x0000000000009810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x107aeb1848b2f7d1ULL, 0x000000000000598dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x839b094cf90eaca4ULL, 0x0000000000000737ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf2c4578b96916e7cULL, 0x000000000000c6aaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb844d0e4866b1a4eULL, 0x000000000000bb5eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc91b8e23e9f4d896ULL, 0x0000000000007ac3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5afa6c77584883e3ULL, 0x0000000000002479ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2ba532b037d7413bULL, 0x000000000000e5e4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcee77fa978a16b87ULL, 0x000000000000de8cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbfb8216e173ea95fULL, 0x0000000000001f11ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2c59c33aa682f22aULL, 0x00000000000041abULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5d069dfdc91d30f2ULL, 0x0000000000008036ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x17861a92d9e744c0ULL, 0x000000000000fdc2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x66d94455b6788618ULL, 0x0000000000003c5fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf538a60107c4dd6dULL, 0x00000000000062e5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8467f8c6685b1fb5ULL, 0x000000000000a378ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa49333f6f822ec0aULL, 0x000000000000117fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd5cc6d3197bd2ed2ULL, 0x000000000000d0e2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x462d8f65260175a7ULL, 0x0000000000008e58ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3772d1a2499eb77fULL, 0x0000000000004fc5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7df256cd5964c34dULL, 0x0000000000003231ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0cad080a36fb0195ULL, 0x000000000000f3acULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9f4cea5e87475ae0ULL, 0x000000000000ad16ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xee13b499e8d89838ULL, 0x0000000000006c8bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0b51f980a7aeb284ULL, 0x00000000000057e3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7a0ea747c831705cULL, 0x000000000000967eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe9ef4513798d2b29ULL, 0x000000000000c8c4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x98b01bd41612e9f1ULL, 0x0000000000000959ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd2309cbb06e89dc3ULL, 0x00000000000074adULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa36fc27c69775f1bULL, 0x000000000000b530ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x308e2028d8cb046eULL, 0x000000000000eb8aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x41d17eefb754c6b6ULL, 0x0000000000002a17ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe70aba1a4627500bULL, 0x0000000000009d5aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9655e4dd29b892d3ULL, 0x0000000000005cc7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x05b406899804c9a6ULL, 0x000000000000027dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x74eb584ef79b0b7eULL, 0x000000000000c3e0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3e6bdf21e7617f4cULL, 0x000000000000be14ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4f3481e688febd94ULL, 0x0000000000007f89ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdcd563b23942e6e1ULL, 0x0000000000002133ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xad8a3d7556dd2439ULL, 0x000000000000e0aeULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x48c8706c19ab0e85ULL, 0x000000000000dbc6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x39972eab7634cc5dULL, 0x0000000000001a5bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xaa76ccffc7889728ULL, 0x00000000000044e1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdb299238a81755f0ULL, 0x000000000000857cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x91a91557b8ed21c2ULL, 0x000000000000f888ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe0f64b90d772e31aULL, 0x0000000000003915ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7317a9c466ceb86fULL, 0x00000000000067afULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0248f70309517ab7ULL, 0x000000000000a632ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x33e222a45b3c430cULL, 0x0000000000001ea1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x42bd7c6334a381d4ULL, 0x000000000000df3cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd15c9e37851fdaa1ULL, 0x0000000000008186ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa003c0f0ea801879ULL, 0x000000000000401bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xea83479ffa7a6c4bULL, 0x0000000000003defULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9bdc195895e5ae93ULL, 0x000000000000fc72ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x083dfb0c2459f5e6ULL, 0x000000000000a2c8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7962a5cb4bc6373eULL, 0x0000000000006355ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9c20e8d204b01d82ULL, 0x000000000000583dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xed7fb6156b2fdf5aULL, 0x00000000000099a0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7e9e5441da93842fULL, 0x000000000000c71aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0fc10a86b50c46f7ULL, 0x0000000000000687ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x45418de9a5f632c5ULL, 0x0000000000007b73ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x341ed32eca69f01dULL, 0x000000000000baeeULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa7ff317a7bd5ab68ULL, 0x000000000000e454ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd6a06fbd144a69b0ULL, 0x00000000000025c9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x707bab48e539ff0dULL, 0x0000000000009284ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0124f58f8aa63dd5ULL, 0x0000000000005319ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x92c517db3b1a66a0ULL, 0x0000000000000da3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe39a491c5485a478ULL, 0x000000000000cc3eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa91ace73447fd04aULL, 0x000000000000b1caULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd84590b42be01292ULL, 0x0000000000007057ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4ba472e09a5c49e7ULL, 0x0000000000002eedULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3afb2c27f5c38b3fULL, 0x000000000000ef70ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdfb9613ebab5a183ULL, 0x000000000000d418ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xaee63ff9d52a635bULL, 0x0000000000001585ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3d07ddad6496382eULL, 0x0000000000004b3fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4c58836a0b09faf6ULL, 0x0000000000008aa2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x06d804051bf38ec4ULL, 0x000000000000f756ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x77875ac2746c4c1cULL, 0x00000000000036cbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe466b896c5d01769ULL, 0x0000000000006871ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9539e651aa4fd5b1ULL, 0x000000000000a9ecULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb5cd2d613a36260eULL, 0x0000000000001bebULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc49273a655a9e4d6ULL, 0x000000000000da76ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x577391f2e415bfa3ULL, 0x00000000000084ccULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x262ccf358b8a7d7bULL, 0x0000000000004551ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6cac485a9b700949ULL, 0x00000000000038a5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1df3169df4efcb91ULL, 0x000000000000f938ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8e12f4c9455390e4ULL, 0x000000000000a782ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xff4daa0e2acc523cULL, 0x000000000000661fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1a0fe71765ba7880ULL, 0x0000000000005d77ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6b50b9d00a25ba58ULL, 0x0000000000009ceaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf8b15b84bb99e12dULL, 0x000000000000c250ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x89ee0543d40623f5ULL, 0x00000000000003cdULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc36e822cc4fc57c7ULL, 0x0000000000007e39ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb231dcebab63951fULL, 0x000000000000bfa4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x21d03ebf1adfce6aULL, 0x000000000000e11eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x508f607875400cb2ULL, 0x0000000000002083ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf654a48d84339a0fULL, 0x00000000000097ceULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x870bfa4aebac58d7ULL, 0x0000000000005653ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x14ea181e5a1003a2ULL, 0x00000000000008e9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x65b546d9358fc17aULL, 0x000000000000c974ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2f35c1b62575b548ULL, 0x000000000000b480ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5e6a9f714aea7790ULL, 0x000000000000751dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcd8b7d25fb562ce5ULL, 0x0000000000002ba7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbcd423e294c9ee3dULL, 0x000000000000ea3aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x59966efbdbbfc481ULL, 0x000000000000d152ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x28c9303cb4200659ULL, 0x00000000000010cfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbb28d268059c5d2cULL, 0x0000000000004e75ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xca778caf6a039ff4ULL, 0x0000000000008fe8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x80f70bc07af9ebc6ULL, 0x000000000000f21cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf1a855071566291eULL, 0x0000000000003381ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6249b753a4da726bULL, 0x0000000000006d3bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1316e994cb45b0b3ULL, 0x000000000000aca6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+	},
+	{ // 13
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0d3411b111e34989ULL, 0x0000007884532b2eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1a68227f22db920fULL, 0x000000f015a6565cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x175c33ce3338db86ULL, 0x0000008891f57d72ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x34d044fe44ab391eULL, 0x000000fd2a51acb8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x39e4554f55487097ULL, 0x00000085ae028796ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2eb866816670ab11ULL, 0x0000000d3ff7fae4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x238c77307793e298ULL, 0x00000075bba4d1caULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x68bd88e1884b723cULL, 0x000000e754a2456dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6589995099a83bb5ULL, 0x0000009fd0f16e43ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x72d5aa9eaa90e033ULL, 0x0000001741041331ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7fe1bb2fbb73a9baULL, 0x0000006fc557381fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5c6dcc1fcce04b22ULL, 0x0000001a7ef3e9d5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5159ddaedd0302abULL, 0x00000062faa0c2fbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4605ee60ee3bd92dULL, 0x000000ea6b55bf89ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4b31ffd1ffd890a4ULL, 0x00000092ef0694a7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd0670ddf0d96e478ULL, 0x000000d3a8598adaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdd531c6e1c75adf1ULL, 0x000000ab2c0aa1f4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xca0f2fa02f4d7677ULL, 0x00000023bdffdc86ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc73b3e113eae3ffeULL, 0x0000005b39acf7a8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe4b74921493ddd66ULL, 0x0000002e82082662ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe983589058de94efULL, 0x00000056065b0d4cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfedf6b5e6be64f69ULL, 0x000000de97ae703eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf3eb7aef7a0506e0ULL, 0x000000a613fd5b10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb8da853e85dd9644ULL, 0x00000034fcfbcfb7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb5ee948f943edfcdULL, 0x0000004c78a8e499ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa2b2a741a706044bULL, 0x000000c4e95d99ebULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xaf86b6f0b6e54dc2ULL, 0x000000bc6d0eb2c5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8c0ac1c0c176af5aULL, 0x000000c9d6aa630fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x813ed071d095e6d3ULL, 0x000000b152f94821ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9662e3bfe3ad3d55ULL, 0x00000039c30c3553ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9b56f20ef24e74dcULL, 0x00000041475f1e7dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbdce1aa31a31d5f0ULL, 0x000000bb4db209a9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb0fa0b120bd29c79ULL, 0x000000c3c9e12287ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa7a638dc38ea47ffULL, 0x0000004b58145ff5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xaa92296d29090e76ULL, 0x00000033dc4774dbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x891e5e5d5e9aeceeULL, 0x0000004667e3a511ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x842a4fec4f79a567ULL, 0x0000003ee3b08e3fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x93767c227c417ee1ULL, 0x000000b67245f34dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9e426d936da23768ULL, 0x000000cef616d863ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd5739242927aa7ccULL, 0x0000005c19104cc4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd84783f38399ee45ULL, 0x000000249d4367eaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcf1bb03db0a135c3ULL, 0x000000ac0cb61a98ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc22fa18ca1427c4aULL, 0x000000d488e531b6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe1a3d6bcd6d19ed2ULL, 0x000000a13341e07cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xec97c70dc732d75bULL, 0x000000d9b712cb52ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfbcbf4c3f40a0cddULL, 0x0000005126e7b620ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf6ffe572e5e94554ULL, 0x00000029a2b49d0eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6da9177c17a73188ULL, 0x00000068e5eb8373ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x609d06cd06447801ULL, 0x0000001061b8a85dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x77c13503357ca387ULL, 0x00000098f04dd52fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7af524b2249fea0eULL, 0x000000e0741efe01ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x59795382530c0896ULL, 0x00000095cfba2fcbULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x544d423342ef411fULL, 0x000000ed4be904e5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x431171fd71d79a99ULL, 0x00000065da1c7997ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4e25604c6034d310ULL, 0x0000001d5e4f52b9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x05149f9d9fec43b4ULL, 0x0000008fb149c61eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x08208e2c8e0f0a3dULL, 0x000000f7351aed30ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1f7cbde2bd37d1bbULL, 0x0000007fa4ef9042ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1248ac53acd49832ULL, 0x0000000720bcbb6cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x31c4db63db477aaaULL, 0x000000729b186aa6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3cf0cad2caa43323ULL, 0x0000000a1f4b4188ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2bacf91cf99ce8a5ULL, 0x000000828ebe3cfaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2698e8ade87fa12cULL, 0x000000fa0aed17d4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6781345b3462b7fdULL, 0x0000006b9a79124fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6ab525ea2581fe74ULL, 0x000000131e2a3961ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7de9162416b925f2ULL, 0x0000009b8fdf4413ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x70dd0795075a6c7bULL, 0x000000e30b8c6f3dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x535170a570c98ee3ULL, 0x00000096b028bef7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5e656114612ac76aULL, 0x000000ee347b95d9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x493952da52121cecULL, 0x00000066a58ee8abULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x440d436b43f15565ULL, 0x0000001e21ddc385ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0f3cbcbabc29c5c1ULL, 0x0000008ccedb5722ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0208ad0badca8c48ULL, 0x000000f44a887c0cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x15549ec59ef257ceULL, 0x0000007cdb7d017eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x18608f748f111e47ULL, 0x000000045f2e2a50ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3becf844f882fcdfULL, 0x00000071e48afb9aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x36d8e9f5e961b556ULL, 0x0000000960d9d0b4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2184da3bda596ed0ULL, 0x00000081f12cadc6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2cb0cb8acbba2759ULL, 0x000000f9757f86e8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb7e6398439f45385ULL, 0x000000b832209895ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbad2283528171a0cULL, 0x000000c0b673b3bbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xad8e1bfb1b2fc18aULL, 0x000000482786cec9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa0ba0a4a0acc8803ULL, 0x00000030a3d5e5e7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x83367d7a7d5f6a9bULL, 0x000000451871342dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8e026ccb6cbc2312ULL, 0x0000003d9c221f03ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x995e5f055f84f894ULL, 0x000000b50dd76271ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x946a4eb44e67b11dULL, 0x000000cd8984495fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdf5bb165b1bf21b9ULL, 0x0000005f6682ddf8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd26fa0d4a05c6830ULL, 0x00000027e2d1f6d6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc533931a9364b3b6ULL, 0x000000af73248ba4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc80782ab8287fa3fULL, 0x000000d7f777a08aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xeb8bf59bf51418a7ULL, 0x000000a24cd37140ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe6bfe42ae4f7512eULL, 0x000000dac8805a6eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf1e3d7e4d7cf8aa8ULL, 0x000000525975271cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfcd7c655c62cc321ULL, 0x0000002add260c32ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xda4f2ef82e53620dULL, 0x000000d0d7cb1be6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd77b3f493fb02b84ULL, 0x000000a8539830c8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc0270c870c88f002ULL, 0x00000020c26d4dbaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcd131d361d6bb98bULL, 0x00000058463e6694ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xee9f6a066af85b13ULL, 0x0000002dfd9ab75eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe3ab7bb77b1b129aULL, 0x0000005579c99c70ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf4f748794823c91cULL, 0x000000dde83ce102ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf9c359c859c08095ULL, 0x000000a56c6fca2cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb2f2a619a6181031ULL, 0x0000003783695e8bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbfc6b7a8b7fb59b8ULL, 0x0000004f073a75a5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa89a846684c3823eULL, 0x000000c796cf08d7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa5ae95d79520cbb7ULL, 0x000000bf129c23f9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8622e2e7e2b3292fULL, 0x000000caa938f233ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8b16f356f35060a6ULL, 0x000000b22d6bd91dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9c4ac098c068bb20ULL, 0x0000003abc9ea46fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x917ed129d18bf2a9ULL, 0x0000004238cd8f41ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0a28232723c58675ULL, 0x000000037f92913cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x071c32963226cffcULL, 0x0000007bfbc1ba12ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x10400158011e147aULL, 0x000000f36a34c760ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1d7410e910fd5df3ULL, 0x0000008bee67ec4eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3ef867d9676ebf6bULL, 0x000000fe55c33d84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x33cc7668768df6e2ULL, 0x00000086d19016aaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x249045a645b52d64ULL, 0x0000000e40656bd8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x29a45417545664edULL, 0x00000076c43640f6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6295abc6ab8ef449ULL, 0x000000e42b30d451ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6fa1ba77ba6dbdc0ULL, 0x0000009caf63ff7fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x78fd89b989556646ULL, 0x000000143e96820dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x75c9980898b62fcfULL, 0x0000006cbac5a923ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5645ef38ef25cd57ULL, 0x00000019016178e9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5b71fe89fec684deULL, 0x00000061853253c7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4c2dcd47cdfe5f58ULL, 0x000000e914c72eb5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4119dcf6dc1d16d1ULL, 0x000000919094059bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xce1f68b668c473e7ULL, 0x000000d629f2249eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc32b790779273a6eULL, 0x000000aeada10fb0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd4774ac94a1fe1e8ULL, 0x000000263c5472c2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd9435b785bfca861ULL, 0x0000005eb80759ecULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfacf2c482c6f4af9ULL, 0x0000002b03a38826ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf7fb3df93d8c0370ULL, 0x0000005387f0a308ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe0a70e370eb4d8f6ULL, 0x000000db1605de7aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xed931f861f57917fULL, 0x000000a39256f554ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa6a2e057e08f01dbULL, 0x000000317d5061f3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xab96f1e6f16c4852ULL, 0x00000049f9034addULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbccac228c25493d4ULL, 0x000000c168f637afULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb1fed399d3b7da5dULL, 0x000000b9eca51c81ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9272a4a9a42438c5ULL, 0x000000cc5701cd4bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9f46b518b5c7714cULL, 0x000000b4d352e665ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x881a86d686ffaacaULL, 0x0000003c42a79b17ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x852e9767971ce343ULL, 0x00000044c6f4b039ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1e7865696552979fULL, 0x0000000581abae44ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x134c74d874b1de16ULL, 0x0000007d05f8856aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0410471647890590ULL, 0x000000f5940df818ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x092456a7566a4c19ULL, 0x0000008d105ed336ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2aa8219721f9ae81ULL, 0x000000f8abfa02fcULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x279c3026301ae708ULL, 0x000000802fa929d2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x30c003e803223c8eULL, 0x00000008be5c54a0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3df4125912c17507ULL, 0x000000703a0f7f8eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x76c5ed88ed19e5a3ULL, 0x000000e2d509eb29ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7bf1fc39fcfaac2aULL, 0x0000009a515ac007ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6cadcff7cfc277acULL, 0x00000012c0afbd75ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6199de46de213e25ULL, 0x0000006a44fc965bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4215a976a9b2dcbdULL, 0x0000001fff584791ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4f21b8c7b8519534ULL, 0x000000677b0b6cbfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x587d8b098b694eb2ULL, 0x000000efeafe11cdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x55499ab89a8a073bULL, 0x000000976ead3ae3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x73d1721572f5a617ULL, 0x0000006d64402d37ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7ee563a46316ef9eULL, 0x00000015e0130619ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x69b9506a502e3418ULL, 0x0000009d71e67b6bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x648d41db41cd7d91ULL, 0x000000e5f5b55045ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x470136eb365e9f09ULL, 0x000000904e11818fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4a35275a27bdd680ULL, 0x000000e8ca42aaa1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5d69149414850d06ULL, 0x000000605bb7d7d3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x505d05250566448fULL, 0x00000018dfe4fcfdULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1b6cfaf4fabed42bULL, 0x0000008a30e2685aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1658eb45eb5d9da2ULL, 0x000000f2b4b14374ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0104d88bd8654624ULL, 0x0000007a25443e06ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0c30c93ac9860fadULL, 0x00000002a1171528ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2fbcbe0abe15ed35ULL, 0x000000771ab3c4e2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2288afbbaff6a4bcULL, 0x0000000f9ee0efccULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x35d49c759cce7f3aULL, 0x000000870f1592beULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x38e08dc48d2d36b3ULL, 0x000000ff8b46b990ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa3b67fca7f63426fULL, 0x000000becc19a7edULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xae826e7b6e800be6ULL, 0x000000c6484a8cc3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb9de5db55db8d060ULL, 0x0000004ed9bff1b1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb4ea4c044c5b99e9ULL, 0x000000365decda9fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x97663b343bc87b71ULL, 0x00000043e6480b55ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9a522a852a2b32f8ULL, 0x0000003b621b207bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8d0e194b1913e97eULL, 0x000000b3f3ee5d09ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x803a08fa08f0a0f7ULL, 0x000000cb77bd7627ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcb0bf72bf7283053ULL, 0x0000005998bbe280ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc63fe69ae6cb79daULL, 0x000000211ce8c9aeULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd163d554d5f3a25cULL, 0x000000a98d1db4dcULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdc57c4e5c410ebd5ULL, 0x000000d1094e9ff2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xffdbb3d5b383094dULL, 0x000000a4b2ea4e38ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf2efa264a26040c4ULL, 0x000000dc36b96516ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe5b391aa91589b42ULL, 0x00000054a74c1864ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe887801b80bbd2cbULL, 0x0000002c231f334aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa99e5ced5ca6c41aULL, 0x000000bdb38b36d1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa4aa4d5c4d458d93ULL, 0x000000c537d81dffULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb3f67e927e7d5615ULL, 0x0000004da62d608dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbec26f236f9e1f9cULL, 0x00000035227e4ba3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9d4e1813180dfd04ULL, 0x0000004099da9a69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x907a09a209eeb48dULL, 0x000000381d89b147ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x87263a6c3ad66f0bULL, 0x000000b08c7ccc35ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8a122bdd2b352682ULL, 0x000000c8082fe71bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc123d40cd4edb626ULL, 0x0000005ae72973bcULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcc17c5bdc50effafULL, 0x00000022637a5892ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdb4bf673f6362429ULL, 0x000000aaf28f25e0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd67fe7c2e7d56da0ULL, 0x000000d276dc0eceULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf5f390f290468f38ULL, 0x000000a7cd78df04ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf8c7814381a5c6b1ULL, 0x000000df492bf42aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xef9bb28db29d1d37ULL, 0x00000057d8de8958ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe2afa33ca37e54beULL, 0x0000002f5c8da276ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x79f9513251302062ULL, 0x0000006e1bd2bc0bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x74cd408340d369ebULL, 0x000000169f819725ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6391734d73ebb26dULL, 0x0000009e0e74ea57ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6ea562fc6208fbe4ULL, 0x000000e68a27c179ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4d2915cc159b197cULL, 0x00000093318310b3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x401d047d047850f5ULL, 0x000000ebb5d03b9dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x574137b337408b73ULL, 0x00000063242546efULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5a75260226a3c2faULL, 0x0000001ba0766dc1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1144d9d3d97b525eULL, 0x000000894f70f966ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1c70c862c8981bd7ULL, 0x000000f1cb23d248ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0b2cfbacfba0c051ULL, 0x000000795ad6af3aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0618ea1dea4389d8ULL, 0x00000001de858414ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x25949d2d9dd06b40ULL, 0x00000074652155deULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x28a08c9c8c3322c9ULL, 0x0000000ce1727ef0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3ffcbf52bf0bf94fULL, 0x0000008470870382ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x32c8aee3aee8b0c6ULL, 0x000000fcf4d428acULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1450464e469711eaULL, 0x00000006fe393f78ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x196457ff57745863ULL, 0x0000007e7a6a1456ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0e386431644c83e5ULL, 0x000000f6eb9f6924ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x030c758075afca6cULL, 0x0000008e6fcc420aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x208002b0023c28f4ULL, 0x000000fbd46893c0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2db4130113df617dULL, 0x00000083503bb8eeULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3ae820cf20e7bafbULL, 0x0000000bc1cec59cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x37dc317e3104f372ULL, 0x00000073459deeb2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7cedceafcedc63d6ULL, 0x000000e1aa9b7a15ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x71d9df1edf3f2a5fULL, 0x000000992ec8513bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6685ecd0ec07f1d9ULL, 0x00000011bf3d2c49ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6bb1fd61fde4b850ULL, 0x000000693b6e0767ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x483d8a518a775ac8ULL, 0x0000001c80cad6adULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x45099be09b941341ULL, 0x000000640499fd83ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5255a82ea8acc8c7ULL, 0x000000ec956c80f1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5f61b99fb94f814eULL, 0x00000094113fabdfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc4374b914b01f592ULL, 0x000000d55660b5a2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc9035a205ae2bc1bULL, 0x000000add2339e8cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xde5f69ee69da679dULL, 0x0000002543c6e3feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd36b785f78392e14ULL, 0x0000005dc795c8d0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf0e70f6f0faacc8cULL, 0x000000287c31191aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfdd31ede1e498505ULL, 0x00000050f8623234ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xea8f2d102d715e83ULL, 0x000000d869974f46ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe7bb3ca13c92170aULL, 0x000000a0edc46468ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xac8ac370c34a87aeULL, 0x0000003202c2f0cfULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa1bed2c1d2a9ce27ULL, 0x0000004a8691dbe1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb6e2e10fe19115a1ULL, 0x000000c21764a693ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbbd6f0bef0725c28ULL, 0x000000ba93378dbdULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x985a878e87e1beb0ULL, 0x000000cf28935c77ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x956e963f9602f739ULL, 0x000000b7acc07759ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8232a5f1a53a2cbfULL, 0x0000003f3d350a2bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8f06b440b4d96536ULL, 0x00000047b9662105ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+	},
+	{ // 15
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x690a4a70a36fc41dULL, 0x001a862097848b69ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd21494e05bde953aULL, 0x0034114033150bd2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbb1ede90f8b15127ULL, 0x002e9760a49180bbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb92835ddb6a13774ULL, 0x00682280662a16b9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd0227fad15cef369ULL, 0x0072a4a0f1ae9dd0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6b3ca13ded7fa24eULL, 0x005c33c0553f1d6bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0236eb4d4e106653ULL, 0x0046b5e0c2bb9602ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6f506aa7715f6ee8ULL, 0x00d0441dcc542c6fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x065a20d7d230aaf5ULL, 0x00cac23d5bd0a706ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbd44fe472a81fbd2ULL, 0x00e4555dff4127bdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd44eb43789ee3fcfULL, 0x00fed37d68c5acd4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd6785f7ac7fe599cULL, 0x00b8669daa7e3ad6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbf72150a64919d81ULL, 0x00a2e0bd3dfab1bfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x046ccb9a9c20cca6ULL, 0x008c77dd996b3104ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6d6681ea3f4f08bbULL, 0x0096f1fd0eefba6dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdea0d453e2bedccdULL, 0x00bd883a85a858deULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb7aa9e2341d118d0ULL, 0x00a70e1a122cd3b7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0cb440b3b96049f7ULL, 0x0089997ab6bd530cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x65be0ac31a0f8deaULL, 0x00931f5a2139d865ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6788e18e541febb9ULL, 0x00d5aabae3824e67ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0e82abfef7702fa4ULL, 0x00cf2c9a7406c50eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb59c756e0fc17e83ULL, 0x00e1bbfad09745b5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdc963f1eacaeba9eULL, 0x00fb3dda4713cedcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb1f0bef493e1b225ULL, 0x006dcc2749fc74b1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd8faf484308e7638ULL, 0x00774a07de78ffd8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x63e42a14c83f271fULL, 0x0059dd677ae97f63ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0aee60646b50e302ULL, 0x00435b47ed6df40aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x08d88b2925408551ULL, 0x0005eea72fd66208ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x61d2c159862f414cULL, 0x001f6887b852e961ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdacc1fc97e9e106bULL, 0x0031ffe71cc369daULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb3c655b9ddf1d476ULL, 0x002b79c78b47e2b3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa15db5a6d961a587ULL, 0x00670d74174db0a1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc857ffd67a0e619aULL, 0x007d8b5480c93bc8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7349214682bf30bdULL, 0x00531c342458bb73ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1a436b3621d0f4a0ULL, 0x00499a14b3dc301aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1875807b6fc092f3ULL, 0x000f2ff47167a618ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x717fca0bccaf56eeULL, 0x0015a9d4e6e32d71ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xca61149b341e07c9ULL, 0x003b3eb44272adcaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa36b5eeb9771c3d4ULL, 0x0021b894d5f626a3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xce0ddf01a83ecb6fULL, 0x00b74969db199cceULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa70795710b510f72ULL, 0x00adcf494c9d17a7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1c194be1f3e05e55ULL, 0x00835829e80c971cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x75130191508f9a48ULL, 0x0099de097f881c75ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7725eadc1e9ffc1bULL, 0x00df6be9bd338a77ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1e2fa0acbdf03806ULL, 0x00c5edc92ab7011eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa5317e3c45416921ULL, 0x00eb7aa98e2681a5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcc3b344ce62ead3cULL, 0x00f1fc8919a20accULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7ffd61f53bdf794aULL, 0x00da854e92e5e87fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x16f72b8598b0bd57ULL, 0x00c0036e05616316ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xade9f5156001ec70ULL, 0x00ee940ea1f0e3adULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc4e3bf65c36e286dULL, 0x00f4122e367468c4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc6d554288d7e4e3eULL, 0x00b2a7cef4cffec6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xafdf1e582e118a23ULL, 0x00a821ee634b75afULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x14c1c0c8d6a0db04ULL, 0x0086b68ec7daf514ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7dcb8ab875cf1f19ULL, 0x009c30ae505e7e7dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x10ad0b524a8017a2ULL, 0x000ac1535eb1c410ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x79a74122e9efd3bfULL, 0x00104773c9354f79ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc2b99fb2115e8298ULL, 0x003ed0136da4cfc2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xabb3d5c2b2314685ULL, 0x00245633fa2044abULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa9853e8ffc2120d6ULL, 0x0062e3d3389bd2a9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc08f74ff5f4ee4cbULL, 0x007865f3af1f59c0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7b91aa6fa7ffb5ecULL, 0x0056f2930b8ed97bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x129be01f049071f1ULL, 0x004c74b39c0a5212ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5fba7751afc25713ULL, 0x00ce1ae82e9a7d5fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x36b03d210cad930eULL, 0x00d49cc8b91ef636ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8daee3b1f41cc229ULL, 0x00fa0ba81d8f768dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe4a4a9c157730634ULL, 0x00e08d888a0bfde4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe692428c19636067ULL, 0x00a6386848b06be6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8f9808fcba0ca47aULL, 0x00bcbe48df34e08fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3486d66c42bdf55dULL, 0x009229287ba56034ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5d8c9c1ce1d23140ULL, 0x0088af08ec21eb5dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x30ea1df6de9d39fbULL, 0x001e5ef5e2ce5130ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x59e057867df2fde6ULL, 0x0004d8d5754ada59ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe2fe89168543acc1ULL, 0x002a4fb5d1db5ae2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8bf4c366262c68dcULL, 0x0030c995465fd18bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x89c2282b683c0e8fULL, 0x00767c7584e44789ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe0c8625bcb53ca92ULL, 0x006cfa551360cce0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5bd6bccb33e29bb5ULL, 0x00426d35b7f14c5bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x32dcf6bb908d5fa8ULL, 0x0058eb152075c732ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x811aa3024d7c8bdeULL, 0x007392d2ab322581ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe810e972ee134fc3ULL, 0x006914f23cb6aee8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x530e37e216a21ee4ULL, 0x0047839298272e53ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3a047d92b5cddaf9ULL, 0x005d05b20fa3a53aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x383296dffbddbcaaULL, 0x001bb052cd183338ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5138dcaf58b278b7ULL, 0x000136725a9cb851ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xea26023fa0032990ULL, 0x002fa112fe0d38eaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x832c484f036ced8dULL, 0x003527326989b383ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xee4ac9a53c23e536ULL, 0x00a3d6cf676609eeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x874083d59f4c212bULL, 0x00b950eff0e28287ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3c5e5d4567fd700cULL, 0x0097c78f5473023cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x55541735c492b411ULL, 0x008d41afc3f78955ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5762fc788a82d242ULL, 0x00cbf44f014c1f57ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3e68b60829ed165fULL, 0x00d1726f96c8943eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x85766898d15c4778ULL, 0x00ffe50f32591485ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xec7c22e872338365ULL, 0x00e5632fa5dd9fecULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfee7c2f776a3f294ULL, 0x00a9179c39d7cdfeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x97ed8887d5cc3689ULL, 0x00b391bcae534697ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2cf356172d7d67aeULL, 0x009d06dc0ac2c62cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x45f91c678e12a3b3ULL, 0x008780fc9d464d45ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x47cff72ac002c5e0ULL, 0x00c1351c5ffddb47ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2ec5bd5a636d01fdULL, 0x00dbb33cc879502eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x95db63ca9bdc50daULL, 0x00f5245c6ce8d095ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfcd129ba38b394c7ULL, 0x00efa27cfb6c5bfcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x91b7a85007fc9c7cULL, 0x00795381f583e191ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf8bde220a4935861ULL, 0x0063d5a162076af8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x43a33cb05c220946ULL, 0x004d42c1c696ea43ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2aa976c0ff4dcd5bULL, 0x0057c4e15112612aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x289f9d8db15dab08ULL, 0x0011710193a9f728ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4195d7fd12326f15ULL, 0x000bf721042d7c41ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfa8b096dea833e32ULL, 0x00256041a0bcfcfaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9381431d49ecfa2fULL, 0x003fe66137387793ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x204716a4941d2e59ULL, 0x00149fa6bc7f9520ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x494d5cd43772ea44ULL, 0x000e19862bfb1e49ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf2538244cfc3bb63ULL, 0x00208ee68f6a9ef2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9b59c8346cac7f7eULL, 0x003a08c618ee159bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x996f237922bc192dULL, 0x007cbd26da558399ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf065690981d3dd30ULL, 0x00663b064dd108f0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4b7bb79979628c17ULL, 0x0048ac66e940884bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2271fde9da0d480aULL, 0x00522a467ec40322ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4f177c03e54240b1ULL, 0x00c4dbbb702bb94fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x261d3673462d84acULL, 0x00de5d9be7af3226ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9d03e8e3be9cd58bULL, 0x00f0cafb433eb29dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf409a2931df31196ULL, 0x00ea4cdbd4ba39f4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf63f49de53e377c5ULL, 0x00acf93b1601aff6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9f3503aef08cb3d8ULL, 0x00b67f1b8185249fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x242bdd3e083de2ffULL, 0x0098e87b2514a424ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4d21974eab5226e2ULL, 0x00826e5bb2902f4dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbe69eea24399ae26ULL, 0x008134cd5c29fabeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd763a4d2e0f66a3bULL, 0x009bb2edcbad71d7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6c7d7a4218473b1cULL, 0x00b5258d6f3cf16cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x05773032bb28ff01ULL, 0x00afa3adf8b87a05ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0741db7ff5389952ULL, 0x00e9164d3a03ec07ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6e4b910f56575d4fULL, 0x00f3906dad87676eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd5554f9faee60c68ULL, 0x00dd070d0916e7d5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbc5f05ef0d89c875ULL, 0x00c7812d9e926cbcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd139840532c6c0ceULL, 0x005170d0907dd6d1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb833ce7591a904d3ULL, 0x004bf6f007f95db8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x032d10e5691855f4ULL, 0x00656190a368dd03ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6a275a95ca7791e9ULL, 0x007fe7b034ec566aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6811b1d88467f7baULL, 0x00395250f657c068ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x011bfba8270833a7ULL, 0x0023d47061d34b01ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xba052538dfb96280ULL, 0x000d4310c542cbbaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd30f6f487cd6a69dULL, 0x0017c53052c640d3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x60c93af1a12772ebULL, 0x003cbcf7d981a260ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x09c370810248b6f6ULL, 0x00263ad74e052909ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb2ddae11faf9e7d1ULL, 0x0008adb7ea94a9b2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdbd7e461599623ccULL, 0x00122b977d1022dbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd9e10f2c1786459fULL, 0x00549e77bfabb4d9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb0eb455cb4e98182ULL, 0x004e1857282f3fb0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0bf59bcc4c58d0a5ULL, 0x00608f378cbebf0bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x62ffd1bcef3714b8ULL, 0x007a09171b3a3462ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0f995056d0781c03ULL, 0x00ecf8ea15d58e0fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x66931a267317d81eULL, 0x00f67eca82510566ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdd8dc4b68ba68939ULL, 0x00d8e9aa26c085ddULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb4878ec628c94d24ULL, 0x00c26f8ab1440eb4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb6b1658b66d92b77ULL, 0x0084da6a73ff98b6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdfbb2ffbc5b6ef6aULL, 0x009e5c4ae47b13dfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x64a5f16b3d07be4dULL, 0x00b0cb2a40ea9364ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0dafbb1b9e687a50ULL, 0x00aa4d0ad76e180dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1f345b049af80ba1ULL, 0x00e639b94b644a1fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x763e11743997cfbcULL, 0x00fcbf99dce0c176ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcd20cfe4c1269e9bULL, 0x00d228f9787141cdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa42a859462495a86ULL, 0x00c8aed9eff5caa4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa61c6ed92c593cd5ULL, 0x008e1b392d4e5ca6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcf1624a98f36f8c8ULL, 0x00949d19bacad7cfULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7408fa397787a9efULL, 0x00ba0a791e5b5774ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1d02b049d4e86df2ULL, 0x00a08c5989dfdc1dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x706431a3eba76549ULL, 0x00367da487306670ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x196e7bd348c8a154ULL, 0x002cfb8410b4ed19ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa270a543b079f073ULL, 0x00026ce4b4256da2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcb7aef331316346eULL, 0x0018eac423a1e6cbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc94c047e5d06523dULL, 0x005e5f24e11a70c9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa0464e0efe699620ULL, 0x0044d904769efba0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1b58909e06d8c707ULL, 0x006a4e64d20f7b1bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7252daeea5b7031aULL, 0x0070c844458bf072ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc1948f577846d76cULL, 0x005bb183cecc12c1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa89ec527db291371ULL, 0x004137a3594899a8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x13801bb723984256ULL, 0x006fa0c3fdd91913ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7a8a51c780f7864bULL, 0x007526e36a5d927aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x78bcba8acee7e018ULL, 0x00339303a8e60478ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x11b6f0fa6d882405ULL, 0x002915233f628f11ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xaaa82e6a95397522ULL, 0x000782439bf30faaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc3a2641a3656b13fULL, 0x001d04630c7784c3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xaec4e5f00919b984ULL, 0x008bf59e02983eaeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc7ceaf80aa767d99ULL, 0x009173be951cb5c7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7cd0711052c72cbeULL, 0x00bfe4de318d357cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x15da3b60f1a8e8a3ULL, 0x00a562fea609be15ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x17ecd02dbfb88ef0ULL, 0x00e3d71e64b22817ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7ee69a5d1cd74aedULL, 0x00f9513ef336a37eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc5f844cde4661bcaULL, 0x00d7c65e57a723c5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xacf20ebd4709dfd7ULL, 0x00cd407ec023a8acULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe1d399f3ec5bf935ULL, 0x004f2e2572b387e1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x88d9d3834f343d28ULL, 0x0055a805e5370c88ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x33c70d13b7856c0fULL, 0x007b3f6541a68c33ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5acd476314eaa812ULL, 0x0061b945d622075aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x58fbac2e5aface41ULL, 0x00270ca514999158ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x31f1e65ef9950a5cULL, 0x003d8a85831d1a31ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8aef38ce01245b7bULL, 0x00131de5278c9a8aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe3e572bea24b9f66ULL, 0x00099bc5b00811e3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8e83f3549d0497ddULL, 0x009f6a38bee7ab8eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe789b9243e6b53c0ULL, 0x0085ec18296320e7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5c9767b4c6da02e7ULL, 0x00ab7b788df2a05cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x359d2dc465b5c6faULL, 0x00b1fd581a762b35ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x37abc6892ba5a0a9ULL, 0x00f748b8d8cdbd37ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5ea18cf988ca64b4ULL, 0x00edce984f49365eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe5bf5269707b3593ULL, 0x00c359f8ebd8b6e5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8cb51819d314f18eULL, 0x00d9dfd87c5c3d8cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3f734da00ee525f8ULL, 0x00f2a61ff71bdf3fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x567907d0ad8ae1e5ULL, 0x00e8203f609f5456ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xed67d940553bb0c2ULL, 0x00c6b75fc40ed4edULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x846d9330f65474dfULL, 0x00dc317f538a5f84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x865b787db844128cULL, 0x009a849f9131c986ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xef51320d1b2bd691ULL, 0x008002bf06b542efULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x544fec9de39a87b6ULL, 0x00ae95dfa224c254ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3d45a6ed40f543abULL, 0x00b413ff35a0493dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x502327077fba4b10ULL, 0x0022e2023b4ff350ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x39296d77dcd58f0dULL, 0x00386422accb7839ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8237b3e72464de2aULL, 0x0016f342085af882ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xeb3df997870b1a37ULL, 0x000c75629fde73ebULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe90b12dac91b7c64ULL, 0x004ac0825d65e5e9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x800158aa6a74b879ULL, 0x005046a2cae16e80ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3b1f863a92c5e95eULL, 0x007ed1c26e70ee3bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5215cc4a31aa2d43ULL, 0x006457e2f9f46552ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x408e2c55353a5cb2ULL, 0x0028235165fe3740ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x29846625965598afULL, 0x0032a571f27abc29ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x929ab8b56ee4c988ULL, 0x001c321156eb3c92ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfb90f2c5cd8b0d95ULL, 0x0006b431c16fb7fbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf9a61988839b6bc6ULL, 0x004001d103d421f9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x90ac53f820f4afdbULL, 0x005a87f19450aa90ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2bb28d68d845fefcULL, 0x0074109130c12a2bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x42b8c7187b2a3ae1ULL, 0x006e96b1a745a142ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2fde46f24465325aULL, 0x00f8674ca9aa1b2fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x46d40c82e70af647ULL, 0x00e2e16c3e2e9046ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfdcad2121fbba760ULL, 0x00cc760c9abf10fdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x94c09862bcd4637dULL, 0x00d6f02c0d3b9b94ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x96f6732ff2c4052eULL, 0x009045cccf800d96ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfffc395f51abc133ULL, 0x008ac3ec580486ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x44e2e7cfa91a9014ULL, 0x00a4548cfc950644ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2de8adbf0a755409ULL, 0x00bed2ac6b118d2dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9e2ef806d784807fULL, 0x0095ab6be0566f9eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf724b27674eb4462ULL, 0x008f2d4b77d2e4f7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4c3a6ce68c5a1545ULL, 0x00a1ba2bd343644cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x253026962f35d158ULL, 0x00bb3c0b44c7ef25ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2706cddb6125b70bULL, 0x00fd89eb867c7927ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4e0c87abc24a7316ULL, 0x00e70fcb11f8f24eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf512593b3afb2231ULL, 0x00c998abb56972f5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9c18134b9994e62cULL, 0x00d31e8b22edf99cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf17e92a1a6dbee97ULL, 0x0045ef762c0243f1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9874d8d105b42a8aULL, 0x005f6956bb86c898ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x236a0641fd057badULL, 0x0071fe361f174823ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4a604c315e6abfb0ULL, 0x006b78168893c34aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4856a77c107ad9e3ULL, 0x002dcdf64a285548ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x215ced0cb3151dfeULL, 0x00374bd6ddacde21ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9a42339c4ba44cd9ULL, 0x0019dcb6793d5e9aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf34879ece8cb88c4ULL, 0x00035a96eeb9d5f3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+	},
+	{ // 16
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x081ed144bd680d3bULL, 0x3b243262e52941a3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x103cbf8867d01a76ULL, 0x764864c4d752825bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x18226eccdab8174dULL, 0x4d6c56a6327bc3f8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2078630dcebd34ecULL, 0xec90c895b3a419b6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2866b24973d539d7ULL, 0xd7b4faf7568d5815ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3044dc85a96d2e9aULL, 0x9ad8ac5164f69bedULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x385a0dc1140523a1ULL, 0xa1fc9e3381dfda4eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x40f0c61a816768c5ULL, 0xc53d8d377b553271ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x48ee175e3c0f65feULL, 0xfe19bf559e7c73d2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x50cc7992e6b772b3ULL, 0xb375e9f3ac07b02aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x58d2a8d65bdf7f88ULL, 0x8851db91492ef189ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6088a5174fda5c29ULL, 0x29ad45a2c8f12bc7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x68967453f2b25112ULL, 0x128977c02dd86a64ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x70b41a9f280a465fULL, 0x5fe521661fa3a99cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x78aacbdb95624b64ULL, 0x64c11304fa8ae83fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x80fd91341fced097ULL, 0x977a076ef6aa64e2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x88e34070a2a6ddacULL, 0xac5e350c13832541ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x90c12ebc781ecae1ULL, 0xe13263aa21f8e6b9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x98dffff8c576c7daULL, 0xda1651c8c4d1a71aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa085f239d173e47bULL, 0x7beacffb450e7d54ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa89b237d6c1be940ULL, 0x40cefd99a0273cf7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb0b94db1b6a3fe0dULL, 0x0da2ab3f925cff0fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb8a79cf50bcbf336ULL, 0x3686995d7775beacULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc00d572e9ea9b852ULL, 0x52478a598dff5693ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc813866a23c1b569ULL, 0x6963b83b68d61730ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd031e8a6f979a224ULL, 0x240fee9d5aadd4c8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd82f39e24411af1fULL, 0x1f2bdcffbf84956bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe075342350148cbeULL, 0xbed742cc3e5b4f25ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe86be567ed7c8185ULL, 0x85f370aedb720e86ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf0498bab37c496c8ULL, 0xc89f2608e909cd7eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf8575aef8aac9bf3ULL, 0xf3bb146a0c208cddULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1de73f683e81bd33ULL, 0x33f40edcf149c8d9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x15f9ee2c83e9b008ULL, 0x08d03cbe1460897aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0ddb80e05951a745ULL, 0x45bc6a18261b4a82ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x05c551a4e439aa7eULL, 0x7e98587ac3320b21ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3d9f5c65f03c89dfULL, 0xdf64c64942edd16fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x35818d214d5484e4ULL, 0xe440f42ba7c490ccULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2da3e3ed97ec93a9ULL, 0xa92ca28d95bf5334ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x25bd32a92a849e92ULL, 0x920890ef70961297ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5d17f972bfe6d5f6ULL, 0xf6c983eb8a1cfaa8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x55092836028ed8cdULL, 0xcdedb1896f35bb0bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4d2b46fad836cf80ULL, 0x8081e72f5d4e78f3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x453597be655ec2bbULL, 0xbba5d54db8673950ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7d6f9a7f715be11aULL, 0x1a594b7e39b8e31eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x75714b3bcc33ec21ULL, 0x217d791cdc91a2bdULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6d5325f7168bfb6cULL, 0x6c112fbaeeea6145ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x654df4b3abe3f657ULL, 0x57351dd80bc320e6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9d1aae5c214f6da4ULL, 0xa48e09b207e3ac3bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x95047f189c27609fULL, 0x9faa3bd0e2caed98ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8d2611d4469f77d2ULL, 0xd2c66d76d0b12e60ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8538c090fbf77ae9ULL, 0xe9e25f1435986fc3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbd62cd51eff25948ULL, 0x481ec127b447b58dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb57c1c15529a5473ULL, 0x733af345516ef42eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xad5e72d98822433eULL, 0x3e56a5e3631537d6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa540a39d354a4e05ULL, 0x05729781863c7675ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xddea6846a0280561ULL, 0x61b384857cb69e4aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd5f4b9021d40085aULL, 0x5a97b6e7999fdfe9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xcdd6d7cec7f81f17ULL, 0x17fbe041abe41c11ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc5c8068a7a90122cULL, 0x2cdfd2234ecd5db2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfd920b4b6e95318dULL, 0x8d234c10cf1287fcULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf58cda0fd3fd3cb6ULL, 0xb6077e722a3bc65fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xedaeb4c309452bfbULL, 0xfb6b28d4184005a7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe5b06587b42d26c0ULL, 0xc04f1ab6fd694404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3ad37ed07c1f6766ULL, 0x66f51ca5ff928dafULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x32cdaf94c1776a5dULL, 0x5dd12ec71abbcc0cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2aefc1581bcf7d10ULL, 0x10bd786128c00ff4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x22f1101ca6a7702bULL, 0x2b994a03cde94e57ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1aab1dddb2a2538aULL, 0x8a65d4304c369419ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x12b5cc990fca5eb1ULL, 0xb141e652a91fd5baULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0a97a255d57249fcULL, 0xfc2db0f49b641642ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x02897311681a44c7ULL, 0xc70982967e4d57e1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7a23b8cafd780fa3ULL, 0xa3c8919284c7bfdeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x723d698e40100298ULL, 0x98eca3f061eefe7dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6a1f07429aa815d5ULL, 0xd580f55653953d85ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6201d60627c018eeULL, 0xeea4c734b6bc7c26ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5a5bdbc733c53b4fULL, 0x4f5859073763a668ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x52450a838ead3674ULL, 0x747c6b65d24ae7cbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4a67644f54152139ULL, 0x39103dc3e0312433ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4279b50be97d2c02ULL, 0x02340fa105186590ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xba2eefe463d1b7f1ULL, 0xf18f1bcb0938e94dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb2303ea0deb9bacaULL, 0xcaab29a9ec11a8eeULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xaa12506c0401ad87ULL, 0x87c77f0fde6a6b16ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa20c8128b969a0bcULL, 0xbce34d6d3b432ab5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9a568ce9ad6c831dULL, 0x1d1fd35eba9cf0fbULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x92485dad10048e26ULL, 0x263be13c5fb5b158ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8a6a3361cabc996bULL, 0x6b57b79a6dce72a0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8274e22577d49450ULL, 0x507385f888e73303ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfade29fee2b6df34ULL, 0x34b296fc726ddb3cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf2c0f8ba5fded20fULL, 0x0f96a49e97449a9fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xeae296768566c542ULL, 0x42faf238a53f5967ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe2fc4732380ec879ULL, 0x79dec05a401618c4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdaa64af32c0bebd8ULL, 0xd8225e69c1c9c28aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd2b89bb79163e6e3ULL, 0xe3066c0b24e08329ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xca9af57b4bdbf1aeULL, 0xae6a3aad169b40d1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc284243ff6b3fc95ULL, 0x954e08cff3b20172ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x273441b8429eda55ULL, 0x550112790edb4576ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2f2a90fcfff6d76eULL, 0x6e25201bebf204d5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3708fe30254ec023ULL, 0x234976bdd989c72dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3f162f749826cd18ULL, 0x186d44df3ca0868eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x074c22b58c23eeb9ULL, 0xb991daecbd7f5cc0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0f52f3f1314be382ULL, 0x82b5e88e58561d63ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x17709d3debf3f4cfULL, 0xcfd9be286a2dde9bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1f6e4c79569bf9f4ULL, 0xf4fd8c4a8f049f38ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x67c487a2c3f9b290ULL, 0x903c9f4e758e7707ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6fda56e67e91bfabULL, 0xab18ad2c90a736a4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x77f8382aa429a8e6ULL, 0xe674fb8aa2dcf55cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7fe6e96e1941a5ddULL, 0xdd50c9e847f5b4ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x47bce4af0d44867cULL, 0x7cac57dbc62a6eb1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4fa235ebb02c8b47ULL, 0x478865b923032f12ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x57805b276a949c0aULL, 0x0ae4331f1178eceaULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5f9e8a63d7fc9131ULL, 0x31c0017df451ad49ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa7c9d08c5d500ac2ULL, 0xc27b1517f8712194ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xafd701c8e03807f9ULL, 0xf95f27751d586037ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb7f56f043a8010b4ULL, 0xb43371d32f23a3cfULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbfebbe4087e81d8fULL, 0x8f1743b1ca0ae26cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x87b1b38193ed3e2eULL, 0x2eebdd824bd53822ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8faf62c52e853315ULL, 0x15cfefe0aefc7981ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x978d0c09f43d2458ULL, 0x58a3b9469c87ba79ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9f93dd4d49552963ULL, 0x63878b2479aefbdaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe7391696dc376207ULL, 0x07469820832413e5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xef27c7d2615f6f3cULL, 0x3c62aa42660d5246ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf705a91ebbe77871ULL, 0x710efce4547691beULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xff1b785a068f754aULL, 0x4a2ace86b15fd01dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc741759b128a56ebULL, 0xebd650b530800a53ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcf5fa4dfafe25bd0ULL, 0xd0f262d7d5a94bf0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd77dca13755a4c9dULL, 0x9d9e3471e7d28808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdf631b57c83241a6ULL, 0xa6ba061302fbc9abULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x74bbfcbdf83ececcULL, 0xccf73857e3390743ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7ca52df94556c3f7ULL, 0xf7d30a35061046e0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x648743359feed4baULL, 0xbabf5c93346b8518ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6c9992712286d981ULL, 0x819b6ef1d142c4bbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x54c39fb03683fa20ULL, 0x2067f0c2509d1ef5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5cdd4ef48bebf71bULL, 0x1b43c2a0b5b45f56ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x44ff20385153e056ULL, 0x562f940687cf9caeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4ce1f17cec3bed6dULL, 0x6d0ba66462e6dd0dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x344b3aa77959a609ULL, 0x09cab560986c3532ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3c55ebe3c431ab32ULL, 0x32ee87027d457491ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2477852f1e89bc7fULL, 0x7f82d1a44f3eb769ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2c69546ba3e1b144ULL, 0x44a6e3c6aa17f6caULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x143359aab7e492e5ULL, 0xe55a7df52bc82c84ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1c2d88ee0a8c9fdeULL, 0xde7e4f97cee16d27ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x040fe622d0348893ULL, 0x93121931fc9aaedfULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0c1137666d5c85a8ULL, 0xa8362b5319b3ef7cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf4466d89e7f01e5bULL, 0x5b8d3f39159363a1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfc58bccd5a981360ULL, 0x60a90d5bf0ba2202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe47ad2018020042dULL, 0x2dc55bfdc2c1e1faULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xec6403453d480916ULL, 0x16e1699f27e8a059ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd43e0e84294d2ab7ULL, 0xb71df7aca6377a17ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdc20dfc09425278cULL, 0x8c39c5ce431e3bb4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc402b10c4e9d30c1ULL, 0xc15593687165f84cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcc1c6048f3f53dfaULL, 0xfa71a10a944cb9efULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb4b6ab936697769eULL, 0x9eb0b20e6ec651d0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbca87ad7dbff7ba5ULL, 0xa594806c8bef1073ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa48a141b01476ce8ULL, 0xe8f8d6cab994d38bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xac94c55fbc2f61d3ULL, 0xd3dce4a85cbd9228ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x94cec89ea82a4272ULL, 0x72207a9bdd624866ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9cd019da15424f49ULL, 0x490448f9384b09c5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x84f27716cffa5804ULL, 0x04681e5f0a30ca3dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8ceca6527292553fULL, 0x3f4c2c3def198b9eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x695cc3d5c6bf73ffULL, 0xff03368b1270cf9aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x614212917bd77ec4ULL, 0xc42704e9f7598e39ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x79607c5da16f6989ULL, 0x894b524fc5224dc1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x717ead191c0764b2ULL, 0xb26f602d200b0c62ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4924a0d808024713ULL, 0x1393fe1ea1d4d62cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x413a719cb56a4a28ULL, 0x28b7cc7c44fd978fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x59181f506fd25d65ULL, 0x65db9ada76865477ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5106ce14d2ba505eULL, 0x5effa8b893af15d4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x29ac05cf47d81b3aULL, 0x3a3ebbbc6925fdebULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x21b2d48bfab01601ULL, 0x011a89de8c0cbc48ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3990ba472008014cULL, 0x4c76df78be777fb0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x318e6b039d600c77ULL, 0x7752ed1a5b5e3e13ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x09d466c289652fd6ULL, 0xd6ae7329da81e45dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x01cab786340d22edULL, 0xed8a414b3fa8a5feULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x19e8d94aeeb535a0ULL, 0xa0e617ed0dd36606ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x11f6080e53dd389bULL, 0x9bc2258fe8fa27a5ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe9a152e1d971a368ULL, 0x687931e5e4daab78ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe1bf83a56419ae53ULL, 0x535d038701f3eadbULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf99ded69bea1b91eULL, 0x1e31552133882923ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf1833c2d03c9b425ULL, 0x25156743d6a16880ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc9d931ec17cc9784ULL, 0x84e9f970577eb2ceULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc1c7e0a8aaa49abfULL, 0xbfcdcb12b257f36dULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd9e58e64701c8df2ULL, 0xf2a19db4802c3095ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd1fb5f20cd7480c9ULL, 0xc985afd665057136ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa95194fb5816cbadULL, 0xad44bcd29f8f9909ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa14f45bfe57ec696ULL, 0x96608eb07aa6d8aaULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb96d2b733fc6d1dbULL, 0xdb0cd81648dd1b52ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb173fa3782aedce0ULL, 0xe028ea74adf45af1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8929f7f696abff41ULL, 0x41d474472c2b80bfULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x813726b22bc3f27aULL, 0x7af04625c902c11cULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9915487ef17be537ULL, 0x379c1083fb7902e4ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x910b993a4c13e80cULL, 0x0cb822e11e504347ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x4e68826d8421a9aaULL, 0xaa0224f21cab8aecULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x467653293949a491ULL, 0x91261690f982cb4fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x5e543de5e3f1b3dcULL, 0xdc4a4036cbf908b7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x564aeca15e99bee7ULL, 0xe76e72542ed04914ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x6e10e1604a9c9d46ULL, 0x4692ec67af0f935aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x660e3024f7f4907dULL, 0x7db6de054a26d2f9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x7e2c5ee82d4c8730ULL, 0x30da88a3785d1101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x76328fac90248a0bULL, 0x0bfebac19d7450a2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0e9844770546c16fULL, 0x6f3fa9c567feb89dULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x06869533b82ecc54ULL, 0x541b9ba782d7f93eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x1ea4fbff6296db19ULL, 0x1977cd01b0ac3ac6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x16ba2abbdffed622ULL, 0x2253ff6355857b65ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x2ee0277acbfbf583ULL, 0x83af6150d45aa12bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x26fef63e7693f8b8ULL, 0xb88b53323173e088ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x3edc98f2ac2beff5ULL, 0xf5e7059403082370ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x36c249b61143e2ceULL, 0xcec337f6e62162d3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xce9513599bef793dULL, 0x3d78239cea01ee0eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xc68bc21d26877406ULL, 0x065c11fe0f28afadULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xdea9acd1fc3f634bULL, 0x4b3047583d536c55ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd6b77d9541576e70ULL, 0x7014753ad87a2df6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xeeed705455524dd1ULL, 0xd1e8eb0959a5f7b8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xe6f3a110e83a40eaULL, 0xeaccd96bbc8cb61bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xfed1cfdc328257a7ULL, 0xa7a08fcd8ef775e3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xf6cf1e988fea5a9cULL, 0x9c84bdaf6bde3440ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x8e65d5431a8811f8ULL, 0xf845aeab9154dc7fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x867b0407a7e01cc3ULL, 0xc3619cc9747d9ddcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9e596acb7d580b8eULL, 0x8e0dca6f46065e24ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9647bb8fc03006b5ULL, 0xb529f80da32f1f87ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xae1db64ed4352514ULL, 0x14d5663e22f0c5c9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xa603670a695d282fULL, 0x2ff1545cc7d9846aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xbe2109c6b3e53f62ULL, 0x629d02faf5a24792ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xb63fd8820e8d3259ULL, 0x59b93098108b0631ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x538fbd05baa01499ULL, 0x99f62a2eede24235ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x5b916c4107c819a2ULL, 0xa2d2184c08cb0396ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x43b3028ddd700eefULL, 0xefbe4eea3ab0c06eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x4badd3c9601803d4ULL, 0xd49a7c88df9981cdULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x73f7de08741d2075ULL, 0x7566e2bb5e465b83ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x7be90f4cc9752d4eULL, 0x4e42d0d9bb6f1a20ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x63cb618013cd3a03ULL, 0x032e867f8914d9d8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x6bd5b0c4aea53738ULL, 0x380ab41d6c3d987bULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x137f7b1f3bc77c5cULL, 0x5ccba71996b77044ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x1b61aa5b86af7167ULL, 0x67ef957b739e31e7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x0343c4975c17662aULL, 0x2a83c3dd41e5f21fULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x0b5d15d3e17f6b11ULL, 0x11a7f1bfa4ccb3bcULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x33071812f57a48b0ULL, 0xb05b6f8c251369f2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x3b19c9564812458bULL, 0x8b7f5deec03a2851ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x233ba79a92aa52c6ULL, 0xc6130b48f241eba9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x2b2576de2fc25ffdULL, 0xfd37392a1768aa0aULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xd3722c31a56ec40eULL, 0x0e8c2d401b4826d7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdb6cfd751806c935ULL, 0x35a81f22fe616774ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xc34e93b9c2bede78ULL, 0x78c44984cc1aa48cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xcb5042fd7fd6d343ULL, 0x43e07be62933e52fULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xf30a4f3c6bd3f0e2ULL, 0xe21ce5d5a8ec3f61ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xfb149e78d6bbfdd9ULL, 0xd938d7b74dc57ec2ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xe336f0b40c03ea94ULL, 0x945481117fbebd3aULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xeb2821f0b16be7afULL, 0xaf70b3739a97fc99ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x9382ea2b2409accbULL, 0xcbb1a077601d14a6ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x9b9c3b6f9961a1f0ULL, 0xf095921585345505ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0x83be55a343d9b6bdULL, 0xbdf9c4b3b74f96fdULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x8ba084e7feb1bb86ULL, 0x86ddf6d15266d75eULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xb3fa8926eab49827ULL, 0x272168e2d3b90d10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbbe4586257dc951cULL, 0x1c055a8036904cb3ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+		{ 0xa3c636ae8d648251ULL, 0x51690c2604eb8f4bULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xabd8e7ea300c8f6aULL, 0x6a4d3e44e1c2cee8ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+	},
+	{ // 17
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x53c5167778534277ULL, 0x637d3555868f29f9ULL, 0x000000000000004fULL, 0x0000000000000000ULL },
+		{ 0xa6972ceef0a684eeULL, 0xc6fa6aaa110352efULL, 0x000000000000009eULL, 0x0000000000000000ULL }, { 0xf5523a9988f5c699ULL, 0xa5875fff978c7b16ULL, 0x00000000000000d1ULL, 0x0000000000000000ULL },
+		{ 0x513358c1fd5115c1ULL, 0x91e9d4492206a4c3ULL, 0x0000000000000021ULL, 0x0000000000000000ULL }, { 0x02f64eb6850257b6ULL, 0xf294e11ca4898d3aULL, 0x000000000000006eULL, 0x0000000000000000ULL },
+		{ 0xf7a4742f0df7912fULL, 0x5713bee33305f62cULL, 0x00000000000000bfULL, 0x0000000000000000ULL }, { 0xa461625875a4d358ULL, 0x346e8bb6b58adfd5ULL, 0x00000000000000f0ULL, 0x0000000000000000ULL },
+		{ 0xa266b09fe7a22a9fULL, 0x3fcfb592440c559bULL, 0x0000000000000042ULL, 0x0000000000000000ULL }, { 0xf1a3a6e89ff168e8ULL, 0x5cb280c7c2837c62ULL, 0x000000000000000dULL, 0x0000000000000000ULL },
+		{ 0x04f19c711704ae71ULL, 0xf935df38550f0774ULL, 0x00000000000000dcULL, 0x0000000000000000ULL }, { 0x57348a066f57ec06ULL, 0x9a48ea6dd3802e8dULL, 0x0000000000000093ULL, 0x0000000000000000ULL },
+		{ 0xf355e85e1af33f5eULL, 0xae2661db660af158ULL, 0x0000000000000063ULL, 0x0000000000000000ULL }, { 0xa090fe2962a07d29ULL, 0xcd5b548ee085d8a1ULL, 0x000000000000002cULL, 0x0000000000000000ULL },
+		{ 0x55c2c4b0ea55bbb0ULL, 0x68dc0b717709a3b7ULL, 0x00000000000000fdULL, 0x0000000000000000ULL }, { 0x0607d2c79206f9c7ULL, 0x0ba13e24f1868a4eULL, 0x00000000000000b2ULL, 0x0000000000000000ULL },
+		{ 0x59cc7d23d3595423ULL, 0x7e8377398818aa2bULL, 0x0000000000000084ULL, 0x0000000000000000ULL }, { 0x0a096b54ab0a1654ULL, 0x1dfe426c0e9783d2ULL, 0x00000000000000cbULL, 0x0000000000000000ULL },
+		{ 0xff5b51cd23ffd0cdULL, 0xb8791d93991bf8c4ULL, 0x000000000000001aULL, 0x0000000000000000ULL }, { 0xac9e47ba5bac92baULL, 0xdb0428c61f94d13dULL, 0x0000000000000055ULL, 0x0000000000000000ULL },
+		{ 0x08ff25e22e0841e2ULL, 0xef6aa370aa1e0ee8ULL, 0x00000000000000a5ULL, 0x0000000000000000ULL }, { 0x5b3a3395565b0395ULL, 0x8c1796252c912711ULL, 0x00000000000000eaULL, 0x0000000000000000ULL },
+		{ 0xae68090cdeaec50cULL, 0x2990c9dabb1d5c07ULL, 0x000000000000003bULL, 0x0000000000000000ULL }, { 0xfdad1f7ba6fd877bULL, 0x4aedfc8f3d9275feULL, 0x0000000000000074ULL, 0x0000000000000000ULL },
+		{ 0xfbaacdbc34fb7ebcULL, 0x414cc2abcc14ffb0ULL, 0x00000000000000c6ULL, 0x0000000000000000ULL }, { 0xa86fdbcb4ca83ccbULL, 0x2231f7fe4a9bd649ULL, 0x0000000000000089ULL, 0x0000000000000000ULL },
+		{ 0x5d3de152c45dfa52ULL, 0x87b6a801dd17ad5fULL, 0x0000000000000058ULL, 0x0000000000000000ULL }, { 0x0ef8f725bc0eb825ULL, 0xe4cb9d545b9884a6ULL, 0x0000000000000017ULL, 0x0000000000000000ULL },
+		{ 0xaa99957dc9aa6b7dULL, 0xd0a516e2ee125b73ULL, 0x00000000000000e7ULL, 0x0000000000000000ULL }, { 0xf95c830ab1f9290aULL, 0xb3d823b7689d728aULL, 0x00000000000000a8ULL, 0x0000000000000000ULL },
+		{ 0x0c0eb993390cef93ULL, 0x165f7c48ff11099cULL, 0x0000000000000079ULL, 0x0000000000000000ULL }, { 0x5fcbafe4415fade4ULL, 0x7522491d799e2065ULL, 0x0000000000000036ULL, 0x0000000000000000ULL },
+		{ 0xb285fa46bbb2a846ULL, 0xfc1bee720d304956ULL, 0x0000000000000015ULL, 0x0000000000000000ULL }, { 0xe140ec31c3e1ea31ULL, 0x9f66db278bbf60afULL, 0x000000000000005aULL, 0x0000000000000000ULL },
+		{ 0x1412d6a84b142ca8ULL, 0x3ae184d81c331bb9ULL, 0x000000000000008bULL, 0x0000000000000000ULL }, { 0x47d7c0df33476edfULL, 0x599cb18d9abc3240ULL, 0x00000000000000c4ULL, 0x0000000000000000ULL },
+		{ 0xe3b6a28746e3bd87ULL, 0x6df23a3b2f36ed95ULL, 0x0000000000000034ULL, 0x0000000000000000ULL }, { 0xb073b4f03eb0fff0ULL, 0x0e8f0f6ea9b9c46cULL, 0x000000000000007bULL, 0x0000000000000000ULL },
+		{ 0x45218e69b6453969ULL, 0xab0850913e35bf7aULL, 0x00000000000000aaULL, 0x0000000000000000ULL }, { 0x16e4981ece167b1eULL, 0xc87565c4b8ba9683ULL, 0x00000000000000e5ULL, 0x0000000000000000ULL },
+		{ 0x10e34ad95c1082d9ULL, 0xc3d45be0493c1ccdULL, 0x0000000000000057ULL, 0x0000000000000000ULL }, { 0x43265cae2443c0aeULL, 0xa0a96eb5cfb33534ULL, 0x0000000000000018ULL, 0x0000000000000000ULL },
+		{ 0xb6746637acb60637ULL, 0x052e314a583f4e22ULL, 0x00000000000000c9ULL, 0x0000000000000000ULL }, { 0xe5b17040d4e54440ULL, 0x6653041fdeb067dbULL, 0x0000000000000086ULL, 0x0000000000000000ULL },
+		{ 0x41d01218a1419718ULL, 0x523d8fa96b3ab80eULL, 0x0000000000000076ULL, 0x0000000000000000ULL }, { 0x1215046fd912d56fULL, 0x3140bafcedb591f7ULL, 0x0000000000000039ULL, 0x0000000000000000ULL },
+		{ 0xe7473ef651e713f6ULL, 0x94c7e5037a39eae1ULL, 0x00000000000000e8ULL, 0x0000000000000000ULL }, { 0xb482288129b45181ULL, 0xf7bad056fcb6c318ULL, 0x00000000000000a7ULL, 0x0000000000000000ULL },
+		{ 0xeb49876568ebfc65ULL, 0x8298994b8528e37dULL, 0x0000000000000091ULL, 0x0000000000000000ULL }, { 0xb88c911210b8be12ULL, 0xe1e5ac1e03a7ca84ULL, 0x00000000000000deULL, 0x0000000000000000ULL },
+		{ 0x4ddeab8b984d788bULL, 0x4462f3e1942bb192ULL, 0x000000000000000fULL, 0x0000000000000000ULL }, { 0x1e1bbdfce01e3afcULL, 0x271fc6b412a4986bULL, 0x0000000000000040ULL, 0x0000000000000000ULL },
+		{ 0xba7adfa495bae9a4ULL, 0x13714d02a72e47beULL, 0x00000000000000b0ULL, 0x0000000000000000ULL }, { 0xe9bfc9d3ede9abd3ULL, 0x700c785721a16e47ULL, 0x00000000000000ffULL, 0x0000000000000000ULL },
+		{ 0x1cedf34a651c6d4aULL, 0xd58b27a8b62d1551ULL, 0x000000000000002eULL, 0x0000000000000000ULL }, { 0x4f28e53d1d4f2f3dULL, 0xb6f612fd30a23ca8ULL, 0x0000000000000061ULL, 0x0000000000000000ULL },
+		{ 0x492f37fa8f49d6faULL, 0xbd572cd9c124b6e6ULL, 0x00000000000000d3ULL, 0x0000000000000000ULL }, { 0x1aea218df71a948dULL, 0xde2a198c47ab9f1fULL, 0x000000000000009cULL, 0x0000000000000000ULL },
+		{ 0xefb81b147fef5214ULL, 0x7bad4673d027e409ULL, 0x000000000000004dULL, 0x0000000000000000ULL }, { 0xbc7d0d6307bc1063ULL, 0x18d0732656a8cdf0ULL, 0x0000000000000002ULL, 0x0000000000000000ULL },
+		{ 0x181c6f3b7218c33bULL, 0x2cbef890e3221225ULL, 0x00000000000000f2ULL, 0x0000000000000000ULL }, { 0x4bd9794c0a4b814cULL, 0x4fc3cdc565ad3bdcULL, 0x00000000000000bdULL, 0x0000000000000000ULL },
+		{ 0xbe8b43d582be47d5ULL, 0xea44923af22140caULL, 0x000000000000006cULL, 0x0000000000000000ULL }, { 0xed4e55a2faed05a2ULL, 0x8939a76f74ae6933ULL, 0x0000000000000023ULL, 0x0000000000000000ULL },
+		{ 0x7917e98c6b794d8cULL, 0xe536c1e41a6092acULL, 0x000000000000002aULL, 0x0000000000000000ULL }, { 0x2ad2fffb132a0ffbULL, 0x864bf4b19cefbb55ULL, 0x0000000000000065ULL, 0x0000000000000000ULL },
+		{ 0xdf80c5629bdfc962ULL, 0x23ccab4e0b63c043ULL, 0x00000000000000b4ULL, 0x0000000000000000ULL }, { 0x8c45d315e38c8b15ULL, 0x40b19e1b8dece9baULL, 0x00000000000000fbULL, 0x0000000000000000ULL },
+		{ 0x2824b14d9628584dULL, 0x74df15ad3866366fULL, 0x000000000000000bULL, 0x0000000000000000ULL }, { 0x7be1a73aee7b1a3aULL, 0x17a220f8bee91f96ULL, 0x0000000000000044ULL, 0x0000000000000000ULL },
+		{ 0x8eb39da3668edca3ULL, 0xb2257f0729656480ULL, 0x0000000000000095ULL, 0x0000000000000000ULL }, { 0xdd768bd41edd9ed4ULL, 0xd1584a52afea4d79ULL, 0x00000000000000daULL, 0x0000000000000000ULL },
+		{ 0xdb7159138cdb6713ULL, 0xdaf974765e6cc737ULL, 0x0000000000000068ULL, 0x0000000000000000ULL }, { 0x88b44f64f4882564ULL, 0xb9844123d8e3eeceULL, 0x0000000000000027ULL, 0x0000000000000000ULL },
+		{ 0x7de675fd7c7de3fdULL, 0x1c031edc4f6f95d8ULL, 0x00000000000000f6ULL, 0x0000000000000000ULL }, { 0x2e23638a042ea18aULL, 0x7f7e2b89c9e0bc21ULL, 0x00000000000000b9ULL, 0x0000000000000000ULL },
+		{ 0x8a4201d2718a72d2ULL, 0x4b10a03f7c6a63f4ULL, 0x0000000000000049ULL, 0x0000000000000000ULL }, { 0xd98717a509d930a5ULL, 0x286d956afae54a0dULL, 0x0000000000000006ULL, 0x0000000000000000ULL },
+		{ 0x2cd52d3c812cf63cULL, 0x8deaca956d69311bULL, 0x00000000000000d7ULL, 0x0000000000000000ULL }, { 0x7f103b4bf97fb44bULL, 0xee97ffc0ebe618e2ULL, 0x0000000000000098ULL, 0x0000000000000000ULL },
+		{ 0x20db94afb82019afULL, 0x9bb5b6dd92783887ULL, 0x00000000000000aeULL, 0x0000000000000000ULL }, { 0x731e82d8c0735bd8ULL, 0xf8c8838814f7117eULL, 0x00000000000000e1ULL, 0x0000000000000000ULL },
+		{ 0x864cb84148869d41ULL, 0x5d4fdc77837b6a68ULL, 0x0000000000000030ULL, 0x0000000000000000ULL }, { 0xd589ae3630d5df36ULL, 0x3e32e92205f44391ULL, 0x000000000000007fULL, 0x0000000000000000ULL },
+		{ 0x71e8cc6e45710c6eULL, 0x0a5c6294b07e9c44ULL, 0x000000000000008fULL, 0x0000000000000000ULL }, { 0x222dda193d224e19ULL, 0x692157c136f1b5bdULL, 0x00000000000000c0ULL, 0x0000000000000000ULL },
+		{ 0xd77fe080b5d78880ULL, 0xcca6083ea17dceabULL, 0x0000000000000011ULL, 0x0000000000000000ULL }, { 0x84baf6f7cd84caf7ULL, 0xafdb3d6b27f2e752ULL, 0x000000000000005eULL, 0x0000000000000000ULL },
+		{ 0x82bd24305f823330ULL, 0xa47a034fd6746d1cULL, 0x00000000000000ecULL, 0x0000000000000000ULL }, { 0xd178324727d17147ULL, 0xc707361a50fb44e5ULL, 0x00000000000000a3ULL, 0x0000000000000000ULL },
+		{ 0x242a08deaf24b7deULL, 0x628069e5c7773ff3ULL, 0x0000000000000072ULL, 0x0000000000000000ULL }, { 0x77ef1ea9d777f5a9ULL, 0x01fd5cb041f8160aULL, 0x000000000000003dULL, 0x0000000000000000ULL },
+		{ 0xd38e7cf1a2d326f1ULL, 0x3593d706f472c9dfULL, 0x00000000000000cdULL, 0x0000000000000000ULL }, { 0x804b6a86da806486ULL, 0x56eee25372fde026ULL, 0x0000000000000082ULL, 0x0000000000000000ULL },
+		{ 0x7519501f5275a21fULL, 0xf369bdace5719b30ULL, 0x0000000000000053ULL, 0x0000000000000000ULL }, { 0x26dc46682a26e068ULL, 0x901488f963feb2c9ULL, 0x000000000000001cULL, 0x0000000000000000ULL },
+		{ 0xcb9213cad0cbe5caULL, 0x192d2f961750dbfaULL, 0x000000000000003fULL, 0x0000000000000000ULL }, { 0x985705bda898a7bdULL, 0x7a501ac391dff203ULL, 0x0000000000000070ULL, 0x0000000000000000ULL },
+		{ 0x6d053f24206d6124ULL, 0xdfd7453c06538915ULL, 0x00000000000000a1ULL, 0x0000000000000000ULL }, { 0x3ec02953583e2353ULL, 0xbcaa706980dca0ecULL, 0x00000000000000eeULL, 0x0000000000000000ULL },
+		{ 0x9aa14b0b2d9af00bULL, 0x88c4fbdf35567f39ULL, 0x000000000000001eULL, 0x0000000000000000ULL }, { 0xc9645d7c55c9b27cULL, 0xebb9ce8ab3d956c0ULL, 0x0000000000000051ULL, 0x0000000000000000ULL },
+		{ 0x3c3667e5dd3c74e5ULL, 0x4e3e917524552dd6ULL, 0x0000000000000080ULL, 0x0000000000000000ULL }, { 0x6ff37192a56f3692ULL, 0x2d43a420a2da042fULL, 0x00000000000000cfULL, 0x0000000000000000ULL },
+		{ 0x69f4a3553769cf55ULL, 0x26e29a04535c8e61ULL, 0x000000000000007dULL, 0x0000000000000000ULL }, { 0x3a31b5224f3a8d22ULL, 0x459faf51d5d3a798ULL, 0x0000000000000032ULL, 0x0000000000000000ULL },
+		{ 0xcf638fbbc7cf4bbbULL, 0xe018f0ae425fdc8eULL, 0x00000000000000e3ULL, 0x0000000000000000ULL }, { 0x9ca699ccbf9c09ccULL, 0x8365c5fbc4d0f577ULL, 0x00000000000000acULL, 0x0000000000000000ULL },
+		{ 0x38c7fb94ca38da94ULL, 0xb70b4e4d715a2aa2ULL, 0x000000000000005cULL, 0x0000000000000000ULL }, { 0x6b02ede3b26b98e3ULL, 0xd4767b18f7d5035bULL, 0x0000000000000013ULL, 0x0000000000000000ULL },
+		{ 0x9e50d77a3a9e5e7aULL, 0x71f124e76059784dULL, 0x00000000000000c2ULL, 0x0000000000000000ULL }, { 0xcd95c10d42cd1c0dULL, 0x128c11b2e6d651b4ULL, 0x000000000000008dULL, 0x0000000000000000ULL },
+		{ 0x925e6ee90392b1e9ULL, 0x67ae58af9f4871d1ULL, 0x00000000000000bbULL, 0x0000000000000000ULL }, { 0xc19b789e7bc1f39eULL, 0x04d36dfa19c75828ULL, 0x00000000000000f4ULL, 0x0000000000000000ULL },
+		{ 0x34c94207f3343507ULL, 0xa15432058e4b233eULL, 0x0000000000000025ULL, 0x0000000000000000ULL }, { 0x670c54708b677770ULL, 0xc229075008c40ac7ULL, 0x000000000000006aULL, 0x0000000000000000ULL },
+		{ 0xc36d3628fec3a428ULL, 0xf6478ce6bd4ed512ULL, 0x000000000000009aULL, 0x0000000000000000ULL }, { 0x90a8205f8690e65fULL, 0x953ab9b33bc1fcebULL, 0x00000000000000d5ULL, 0x0000000000000000ULL },
+		{ 0x65fa1ac60e6520c6ULL, 0x30bde64cac4d87fdULL, 0x0000000000000004ULL, 0x0000000000000000ULL }, { 0x363f0cb1763662b1ULL, 0x53c0d3192ac2ae04ULL, 0x000000000000004bULL, 0x0000000000000000ULL },
+		{ 0x3038de76e4309b76ULL, 0x5861ed3ddb44244aULL, 0x00000000000000f9ULL, 0x0000000000000000ULL }, { 0x63fdc8019c63d901ULL, 0x3b1cd8685dcb0db3ULL, 0x00000000000000b6ULL, 0x0000000000000000ULL },
+		{ 0x96aff29814961f98ULL, 0x9e9b8797ca4776a5ULL, 0x0000000000000067ULL, 0x0000000000000000ULL }, { 0xc56ae4ef6cc55defULL, 0xfde6b2c24cc85f5cULL, 0x0000000000000028ULL, 0x0000000000000000ULL },
+		{ 0x610b86b719618eb7ULL, 0xc9883974f9428089ULL, 0x00000000000000d8ULL, 0x0000000000000000ULL }, { 0x32ce90c06132ccc0ULL, 0xaaf50c217fcda970ULL, 0x0000000000000097ULL, 0x0000000000000000ULL },
+		{ 0xc79caa59e9c70a59ULL, 0x0f7253dee841d266ULL, 0x0000000000000046ULL, 0x0000000000000000ULL }, { 0x9459bc2e9194482eULL, 0x6c0f668b6ecefb9fULL, 0x0000000000000009ULL, 0x0000000000000000ULL },
+		{ 0xf22ecf05d6f29a05ULL, 0xd76c9fd534c03945ULL, 0x0000000000000054ULL, 0x0000000000000000ULL }, { 0xa1ebd972aea1d872ULL, 0xb411aa80b24f10bcULL, 0x000000000000001bULL, 0x0000000000000000ULL },
+		{ 0x54b9e3eb26541eebULL, 0x1196f57f25c36baaULL, 0x00000000000000caULL, 0x0000000000000000ULL }, { 0x077cf59c5e075c9cULL, 0x72ebc02aa34c4253ULL, 0x0000000000000085ULL, 0x0000000000000000ULL },
+		{ 0xa31d97c42ba38fc4ULL, 0x46854b9c16c69d86ULL, 0x0000000000000075ULL, 0x0000000000000000ULL }, { 0xf0d881b353f0cdb3ULL, 0x25f87ec99049b47fULL, 0x000000000000003aULL, 0x0000000000000000ULL },
+		{ 0x058abb2adb050b2aULL, 0x807f213607c5cf69ULL, 0x00000000000000ebULL, 0x0000000000000000ULL }, { 0x564fad5da356495dULL, 0xe3021463814ae690ULL, 0x00000000000000a4ULL, 0x0000000000000000ULL },
+		{ 0x50487f9a3150b09aULL, 0xe8a32a4770cc6cdeULL, 0x0000000000000016ULL, 0x0000000000000000ULL }, { 0x038d69ed4903f2edULL, 0x8bde1f12f6434527ULL, 0x0000000000000059ULL, 0x0000000000000000ULL },
+		{ 0xf6df5374c1f63474ULL, 0x2e5940ed61cf3e31ULL, 0x0000000000000088ULL, 0x0000000000000000ULL }, { 0xa51a4503b9a57603ULL, 0x4d2475b8e74017c8ULL, 0x00000000000000c7ULL, 0x0000000000000000ULL },
+		{ 0x017b275bcc01a55bULL, 0x794afe0e52cac81dULL, 0x0000000000000037ULL, 0x0000000000000000ULL }, { 0x52be312cb452e72cULL, 0x1a37cb5bd445e1e4ULL, 0x0000000000000078ULL, 0x0000000000000000ULL },
+		{ 0xa7ec0bb53ca721b5ULL, 0xbfb094a443c99af2ULL, 0x00000000000000a9ULL, 0x0000000000000000ULL }, { 0xf4291dc244f463c2ULL, 0xdccda1f1c546b30bULL, 0x00000000000000e6ULL, 0x0000000000000000ULL },
+		{ 0xabe2b22605abce26ULL, 0xa9efe8ecbcd8936eULL, 0x00000000000000d0ULL, 0x0000000000000000ULL }, { 0xf827a4517df88c51ULL, 0xca92ddb93a57ba97ULL, 0x000000000000009fULL, 0x0000000000000000ULL },
+		{ 0x0d759ec8f50d4ac8ULL, 0x6f158246addbc181ULL, 0x000000000000004eULL, 0x0000000000000000ULL }, { 0x5eb088bf8d5e08bfULL, 0x0c68b7132b54e878ULL, 0x0000000000000001ULL, 0x0000000000000000ULL },
+		{ 0xfad1eae7f8fadbe7ULL, 0x38063ca59ede37adULL, 0x00000000000000f1ULL, 0x0000000000000000ULL }, { 0xa914fc9080a99990ULL, 0x5b7b09f018511e54ULL, 0x00000000000000beULL, 0x0000000000000000ULL },
+		{ 0x5c46c609085c5f09ULL, 0xfefc560f8fdd6542ULL, 0x000000000000006fULL, 0x0000000000000000ULL }, { 0x0f83d07e700f1d7eULL, 0x9d81635a09524cbbULL, 0x0000000000000020ULL, 0x0000000000000000ULL },
+		{ 0x098402b9e209e4b9ULL, 0x96205d7ef8d4c6f5ULL, 0x0000000000000092ULL, 0x0000000000000000ULL }, { 0x5a4114ce9a5aa6ceULL, 0xf55d682b7e5bef0cULL, 0x00000000000000ddULL, 0x0000000000000000ULL },
+		{ 0xaf132e5712af6057ULL, 0x50da37d4e9d7941aULL, 0x000000000000000cULL, 0x0000000000000000ULL }, { 0xfcd638206afc2220ULL, 0x33a702816f58bde3ULL, 0x0000000000000043ULL, 0x0000000000000000ULL },
+		{ 0x58b75a781f58f178ULL, 0x07c98937dad26236ULL, 0x00000000000000b3ULL, 0x0000000000000000ULL }, { 0x0b724c0f670bb30fULL, 0x64b4bc625c5d4bcfULL, 0x00000000000000fcULL, 0x0000000000000000ULL },
+		{ 0xfe207696effe7596ULL, 0xc133e39dcbd130d9ULL, 0x000000000000002dULL, 0x0000000000000000ULL }, { 0xade560e197ad37e1ULL, 0xa24ed6c84d5e1920ULL, 0x0000000000000062ULL, 0x0000000000000000ULL },
+		{ 0x40ab35436d403243ULL, 0x2b7771a739f07013ULL, 0x0000000000000041ULL, 0x0000000000000000ULL }, { 0x136e233415137034ULL, 0x480a44f2bf7f59eaULL, 0x000000000000000eULL, 0x0000000000000000ULL },
+		{ 0xe63c19ad9de6b6adULL, 0xed8d1b0d28f322fcULL, 0x00000000000000dfULL, 0x0000000000000000ULL }, { 0xb5f90fdae5b5f4daULL, 0x8ef02e58ae7c0b05ULL, 0x0000000000000090ULL, 0x0000000000000000ULL },
+		{ 0x11986d8290112782ULL, 0xba9ea5ee1bf6d4d0ULL, 0x0000000000000060ULL, 0x0000000000000000ULL }, { 0x425d7bf5e84265f5ULL, 0xd9e390bb9d79fd29ULL, 0x000000000000002fULL, 0x0000000000000000ULL },
+		{ 0xb70f416c60b7a36cULL, 0x7c64cf440af5863fULL, 0x00000000000000feULL, 0x0000000000000000ULL }, { 0xe4ca571b18e4e11bULL, 0x1f19fa118c7aafc6ULL, 0x00000000000000b1ULL, 0x0000000000000000ULL },
+		{ 0xe2cd85dc8ae218dcULL, 0x14b8c4357dfc2588ULL, 0x0000000000000003ULL, 0x0000000000000000ULL }, { 0xb10893abf2b15aabULL, 0x77c5f160fb730c71ULL, 0x000000000000004cULL, 0x0000000000000000ULL },
+		{ 0x445aa9327a449c32ULL, 0xd242ae9f6cff7767ULL, 0x000000000000009dULL, 0x0000000000000000ULL }, { 0x179fbf450217de45ULL, 0xb13f9bcaea705e9eULL, 0x00000000000000d2ULL, 0x0000000000000000ULL },
+		{ 0xb3fedd1d77b30d1dULL, 0x8551107c5ffa814bULL, 0x0000000000000022ULL, 0x0000000000000000ULL }, { 0xe03bcb6a0fe04f6aULL, 0xe62c2529d975a8b2ULL, 0x000000000000006dULL, 0x0000000000000000ULL },
+		{ 0x1569f1f3871589f3ULL, 0x43ab7ad64ef9d3a4ULL, 0x00000000000000bcULL, 0x0000000000000000ULL }, { 0x46ace784ff46cb84ULL, 0x20d64f83c876fa5dULL, 0x00000000000000f3ULL, 0x0000000000000000ULL },
+		{ 0x19674860be196660ULL, 0x55f4069eb1e8da38ULL, 0x00000000000000c5ULL, 0x0000000000000000ULL }, { 0x4aa25e17c64a2417ULL, 0x368933cb3767f3c1ULL, 0x000000000000008aULL, 0x0000000000000000ULL },
+		{ 0xbff0648e4ebfe28eULL, 0x930e6c34a0eb88d7ULL, 0x000000000000005bULL, 0x0000000000000000ULL }, { 0xec3572f936eca0f9ULL, 0xf07359612664a12eULL, 0x0000000000000014ULL, 0x0000000000000000ULL },
+		{ 0x485410a1434873a1ULL, 0xc41dd2d793ee7efbULL, 0x00000000000000e4ULL, 0x0000000000000000ULL }, { 0x1b9106d63b1b31d6ULL, 0xa760e78215615702ULL, 0x00000000000000abULL, 0x0000000000000000ULL },
+		{ 0xeec33c4fb3eef74fULL, 0x02e7b87d82ed2c14ULL, 0x000000000000007aULL, 0x0000000000000000ULL }, { 0xbd062a38cbbdb538ULL, 0x619a8d28046205edULL, 0x0000000000000035ULL, 0x0000000000000000ULL },
+		{ 0xbb01f8ff59bb4cffULL, 0x6a3bb30cf5e48fa3ULL, 0x0000000000000087ULL, 0x0000000000000000ULL }, { 0xe8c4ee8821e80e88ULL, 0x09468659736ba65aULL, 0x00000000000000c8ULL, 0x0000000000000000ULL },
+		{ 0x1d96d411a91dc811ULL, 0xacc1d9a6e4e7dd4cULL, 0x0000000000000019ULL, 0x0000000000000000ULL }, { 0x4e53c266d14e8a66ULL, 0xcfbcecf36268f4b5ULL, 0x0000000000000056ULL, 0x0000000000000000ULL },
+		{ 0xea32a03ea4ea593eULL, 0xfbd26745d7e22b60ULL, 0x00000000000000a6ULL, 0x0000000000000000ULL }, { 0xb9f7b649dcb91b49ULL, 0x98af5210516d0299ULL, 0x00000000000000e9ULL, 0x0000000000000000ULL },
+		{ 0x4ca58cd0544cddd0ULL, 0x3d280defc6e1798fULL, 0x0000000000000038ULL, 0x0000000000000000ULL }, { 0x1f609aa72c1f9fa7ULL, 0x5e5538ba406e5076ULL, 0x0000000000000077ULL, 0x0000000000000000ULL },
+		{ 0x8b392689bd8bd789ULL, 0x325a5e312ea0abe9ULL, 0x000000000000007eULL, 0x0000000000000000ULL }, { 0xd8fc30fec5d895feULL, 0x51276b64a82f8210ULL, 0x0000000000000031ULL, 0x0000000000000000ULL },
+		{ 0x2dae0a674d2d5367ULL, 0xf4a0349b3fa3f906ULL, 0x00000000000000e0ULL, 0x0000000000000000ULL }, { 0x7e6b1c10357e1110ULL, 0x97dd01ceb92cd0ffULL, 0x00000000000000afULL, 0x0000000000000000ULL },
+		{ 0xda0a7e4840dac248ULL, 0xa3b38a780ca60f2aULL, 0x000000000000005fULL, 0x0000000000000000ULL }, { 0x89cf683f3889803fULL, 0xc0cebf2d8a2926d3ULL, 0x0000000000000010ULL, 0x0000000000000000ULL },
+		{ 0x7c9d52a6b07c46a6ULL, 0x6549e0d21da55dc5ULL, 0x00000000000000c1ULL, 0x0000000000000000ULL }, { 0x2f5844d1c82f04d1ULL, 0x0634d5879b2a743cULL, 0x000000000000008eULL, 0x0000000000000000ULL },
+		{ 0x295f96165a29fd16ULL, 0x0d95eba36aacfe72ULL, 0x000000000000003cULL, 0x0000000000000000ULL }, { 0x7a9a8061227abf61ULL, 0x6ee8def6ec23d78bULL, 0x0000000000000073ULL, 0x0000000000000000ULL },
+		{ 0x8fc8baf8aa8f79f8ULL, 0xcb6f81097bafac9dULL, 0x00000000000000a2ULL, 0x0000000000000000ULL }, { 0xdc0dac8fd2dc3b8fULL, 0xa812b45cfd208564ULL, 0x00000000000000edULL, 0x0000000000000000ULL },
+		{ 0x786cced7a778e8d7ULL, 0x9c7c3fea48aa5ab1ULL, 0x000000000000001dULL, 0x0000000000000000ULL }, { 0x2ba9d8a0df2baaa0ULL, 0xff010abfce257348ULL, 0x0000000000000052ULL, 0x0000000000000000ULL },
+		{ 0xdefbe23957de6c39ULL, 0x5a86554059a9085eULL, 0x0000000000000083ULL, 0x0000000000000000ULL }, { 0x8d3ef44e2f8d2e4eULL, 0x39fb6015df2621a7ULL, 0x00000000000000ccULL, 0x0000000000000000ULL },
+		{ 0xd2f55baa6ed283aaULL, 0x4cd92908a6b801c2ULL, 0x00000000000000faULL, 0x0000000000000000ULL }, { 0x81304ddd1681c1ddULL, 0x2fa41c5d2037283bULL, 0x00000000000000b5ULL, 0x0000000000000000ULL },
+		{ 0x746277449e740744ULL, 0x8a2343a2b7bb532dULL, 0x0000000000000064ULL, 0x0000000000000000ULL }, { 0x27a76133e6274533ULL, 0xe95e76f731347ad4ULL, 0x000000000000002bULL, 0x0000000000000000ULL },
+		{ 0x83c6036b9383966bULL, 0xdd30fd4184bea501ULL, 0x00000000000000dbULL, 0x0000000000000000ULL }, { 0xd003151cebd0d41cULL, 0xbe4dc81402318cf8ULL, 0x0000000000000094ULL, 0x0000000000000000ULL },
+		{ 0x25512f8563251285ULL, 0x1bca97eb95bdf7eeULL, 0x0000000000000045ULL, 0x0000000000000000ULL }, { 0x769439f21b7650f2ULL, 0x78b7a2be1332de17ULL, 0x000000000000000aULL, 0x0000000000000000ULL },
+		{ 0x7093eb358970a935ULL, 0x73169c9ae2b45459ULL, 0x00000000000000b8ULL, 0x0000000000000000ULL }, { 0x2356fd42f123eb42ULL, 0x106ba9cf643b7da0ULL, 0x00000000000000f7ULL, 0x0000000000000000ULL },
+		{ 0xd604c7db79d62ddbULL, 0xb5ecf630f3b706b6ULL, 0x0000000000000026ULL, 0x0000000000000000ULL }, { 0x85c1d1ac01856facULL, 0xd691c36575382f4fULL, 0x0000000000000069ULL, 0x0000000000000000ULL },
+		{ 0x21a0b3f47421bcf4ULL, 0xe2ff48d3c0b2f09aULL, 0x0000000000000099ULL, 0x0000000000000000ULL }, { 0x7265a5830c72fe83ULL, 0x81827d86463dd963ULL, 0x00000000000000d6ULL, 0x0000000000000000ULL },
+		{ 0x87379f1a8487381aULL, 0x24052279d1b1a275ULL, 0x0000000000000007ULL, 0x0000000000000000ULL }, { 0xd4f2896dfcd47a6dULL, 0x4778172c573e8b8cULL, 0x0000000000000048ULL, 0x0000000000000000ULL },
+		{ 0x39bcdccf06397fcfULL, 0xce41b0432390e2bfULL, 0x000000000000006bULL, 0x0000000000000000ULL }, { 0x6a79cab87e6a3db8ULL, 0xad3c8516a51fcb46ULL, 0x0000000000000024ULL, 0x0000000000000000ULL },
+		{ 0x9f2bf021f69ffb21ULL, 0x08bbdae93293b050ULL, 0x00000000000000f5ULL, 0x0000000000000000ULL }, { 0xcceee6568eccb956ULL, 0x6bc6efbcb41c99a9ULL, 0x00000000000000baULL, 0x0000000000000000ULL },
+		{ 0x688f840efb686a0eULL, 0x5fa8640a0196467cULL, 0x000000000000004aULL, 0x0000000000000000ULL }, { 0x3b4a9279833b2879ULL, 0x3cd5515f87196f85ULL, 0x0000000000000005ULL, 0x0000000000000000ULL },
+		{ 0xce18a8e00bceeee0ULL, 0x99520ea010951493ULL, 0x00000000000000d4ULL, 0x0000000000000000ULL }, { 0x9dddbe97739dac97ULL, 0xfa2f3bf5961a3d6aULL, 0x000000000000009bULL, 0x0000000000000000ULL },
+		{ 0x9bda6c50e19b5550ULL, 0xf18e05d1679cb724ULL, 0x0000000000000029ULL, 0x0000000000000000ULL }, { 0xc81f7a2799c81727ULL, 0x92f33084e1139eddULL, 0x0000000000000066ULL, 0x0000000000000000ULL },
+		{ 0x3d4d40be113dd1beULL, 0x37746f7b769fe5cbULL, 0x00000000000000b7ULL, 0x0000000000000000ULL }, { 0x6e8856c9696e93c9ULL, 0x54095a2ef010cc32ULL, 0x00000000000000f8ULL, 0x0000000000000000ULL },
+		{ 0xcae934911cca4091ULL, 0x6067d198459a13e7ULL, 0x0000000000000008ULL, 0x0000000000000000ULL }, { 0x992c22e6649902e6ULL, 0x031ae4cdc3153a1eULL, 0x0000000000000047ULL, 0x0000000000000000ULL },
+		{ 0x6c7e187fec6cc47fULL, 0xa69dbb3254994108ULL, 0x0000000000000096ULL, 0x0000000000000000ULL }, { 0x3fbb0e08943f8608ULL, 0xc5e08e67d21668f1ULL, 0x00000000000000d9ULL, 0x0000000000000000ULL },
+		{ 0x6070a1ecd5602becULL, 0xb0c2c77aab884894ULL, 0x00000000000000efULL, 0x0000000000000000ULL }, { 0x33b5b79bad33699bULL, 0xd3bff22f2d07616dULL, 0x00000000000000a0ULL, 0x0000000000000000ULL },
+		{ 0xc6e78d0225c6af02ULL, 0x7638add0ba8b1a7bULL, 0x0000000000000071ULL, 0x0000000000000000ULL }, { 0x95229b755d95ed75ULL, 0x154598853c043382ULL, 0x000000000000003eULL, 0x0000000000000000ULL },
+		{ 0x3143f92d28313e2dULL, 0x212b1333898eec57ULL, 0x00000000000000ceULL, 0x0000000000000000ULL }, { 0x6286ef5a50627c5aULL, 0x425626660f01c5aeULL, 0x0000000000000081ULL, 0x0000000000000000ULL },
+		{ 0x97d4d5c3d897bac3ULL, 0xe7d17999988dbeb8ULL, 0x0000000000000050ULL, 0x0000000000000000ULL }, { 0xc411c3b4a0c4f8b4ULL, 0x84ac4ccc1e029741ULL, 0x000000000000001fULL, 0x0000000000000000ULL },
+		{ 0xc216117332c20173ULL, 0x8f0d72e8ef841d0fULL, 0x00000000000000adULL, 0x0000000000000000ULL }, { 0x91d307044a914304ULL, 0xec7047bd690b34f6ULL, 0x00000000000000e2ULL, 0x0000000000000000ULL },
+		{ 0x64813d9dc264859dULL, 0x49f71842fe874fe0ULL, 0x0000000000000033ULL, 0x0000000000000000ULL }, { 0x37442beaba37c7eaULL, 0x2a8a2d1778086619ULL, 0x000000000000007cULL, 0x0000000000000000ULL },
+		{ 0x932549b2cf9314b2ULL, 0x1ee4a6a1cd82b9ccULL, 0x000000000000008cULL, 0x0000000000000000ULL }, { 0xc0e05fc5b7c056c5ULL, 0x7d9993f44b0d9035ULL, 0x00000000000000c3ULL, 0x0000000000000000ULL },
+		{ 0x35b2655c3f35905cULL, 0xd81ecc0bdc81eb23ULL, 0x0000000000000012ULL, 0x0000000000000000ULL }, { 0x6677732b4766d22bULL, 0xbb63f95e5a0ec2daULL, 0x000000000000005dULL, 0x0000000000000000ULL },
+	},
+	{ // 18
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xd7c7af9571b7fbefULL, 0x43204bad5249dcf0ULL, 0x00000000000092d9ULL, 0x0000000000000000ULL },
+		{ 0xb3934337e273ebc3ULL, 0x86409647a492a5fdULL, 0x00000000000039afULL, 0x0000000000000000ULL }, { 0x6454eca293c4102cULL, 0xc560ddeaf6db790dULL, 0x000000000000ab76ULL, 0x0000000000000000ULL },
+		{ 0x7b3b866ed9e6cb9bULL, 0x1180318e553957e7ULL, 0x0000000000007243ULL, 0x0000000000000000ULL }, { 0xacfc29fba8513074ULL, 0x52a07a2307708b17ULL, 0x000000000000e09aULL, 0x0000000000000000ULL },
+		{ 0xc8a8c5593b952058ULL, 0x97c0a7c9f1abf21aULL, 0x0000000000004becULL, 0x0000000000000000ULL }, { 0x1f6f6acc4a22dbb7ULL, 0xd4e0ec64a3e22eeaULL, 0x000000000000d935ULL, 0x0000000000000000ULL },
+		{ 0xf67611dcafd18b2bULL, 0x221d6201aa72aed3ULL, 0x000000000000e486ULL, 0x0000000000000000ULL }, { 0x21b1be49de6670c4ULL, 0x613d29acf83b7223ULL, 0x000000000000765fULL, 0x0000000000000000ULL },
+		{ 0x45e552eb4da260e8ULL, 0xa45df4460ee00b2eULL, 0x000000000000dd29ULL, 0x0000000000000000ULL }, { 0x9222fd7e3c159b07ULL, 0xe77dbfeb5ca9d7deULL, 0x0000000000004ff0ULL, 0x0000000000000000ULL },
+		{ 0x8d4d97b2763740b0ULL, 0x339d538fff4bf934ULL, 0x00000000000096c5ULL, 0x0000000000000000ULL }, { 0x5a8a38270780bb5fULL, 0x70bd1822ad0225c4ULL, 0x000000000000041cULL, 0x0000000000000000ULL },
+		{ 0x3eded4859444ab73ULL, 0xb5ddc5c85bd95cc9ULL, 0x000000000000af6aULL, 0x0000000000000000ULL }, { 0xe9197b10e5f3509cULL, 0xf6fd8e6509908039ULL, 0x0000000000003db3ULL, 0x0000000000000000ULL },
+		{ 0xf1ec22a543bf0b56ULL, 0x443ac40249e441bbULL, 0x000000000000d511ULL, 0x0000000000000000ULL }, { 0x262b8d303208f0b9ULL, 0x071a8faf1bad9d4bULL, 0x00000000000047c8ULL, 0x0000000000000000ULL },
+		{ 0x427f6192a1cce095ULL, 0xc27a5245ed76e446ULL, 0x000000000000ecbeULL, 0x0000000000000000ULL }, { 0x95b8ce07d07b1b7aULL, 0x815a19e8bf3f38b6ULL, 0x0000000000007e67ULL, 0x0000000000000000ULL },
+		{ 0x8ad7a4cb9a59c0cdULL, 0x55baf58c1cdd165cULL, 0x000000000000a752ULL, 0x0000000000000000ULL }, { 0x5d100b5eebee3b22ULL, 0x169abe214e94caacULL, 0x000000000000358bULL, 0x0000000000000000ULL },
+		{ 0x3944e7fc782a2b0eULL, 0xd3fa63cbb84fb3a1ULL, 0x0000000000009efdULL, 0x0000000000000000ULL }, { 0xee834869099dd0e1ULL, 0x90da2866ea066f51ULL, 0x0000000000000c24ULL, 0x0000000000000000ULL },
+		{ 0x079a3379ec6e807dULL, 0x6627a603e396ef68ULL, 0x0000000000003197ULL, 0x0000000000000000ULL }, { 0xd05d9cec9dd97b92ULL, 0x2507edaeb1df3398ULL, 0x000000000000a34eULL, 0x0000000000000000ULL },
+		{ 0xb409704e0e1d6bbeULL, 0xe067304447044a95ULL, 0x0000000000000838ULL, 0x0000000000000000ULL }, { 0x63cedfdb7faa9051ULL, 0xa3477be9154d9665ULL, 0x0000000000009ae1ULL, 0x0000000000000000ULL },
+		{ 0x7ca1b51735884be6ULL, 0x77a7978db6afb88fULL, 0x00000000000043d4ULL, 0x0000000000000000ULL }, { 0xab661a82443fb009ULL, 0x3487dc20e4e6647fULL, 0x000000000000d10dULL, 0x0000000000000000ULL },
+		{ 0xcf32f620d7fba025ULL, 0xf1e701ca123d1d72ULL, 0x0000000000007a7bULL, 0x0000000000000000ULL }, { 0x18f559b5a64c5bcaULL, 0xb2c74a674074c182ULL, 0x000000000000e8a2ULL, 0x0000000000000000ULL },
+		{ 0xffc54457866316acULL, 0x8874950492d5826bULL, 0x000000000000b722ULL, 0x0000000000000000ULL }, { 0x2802ebc2f7d4ed43ULL, 0xcb54dea9c09c5e9bULL, 0x00000000000025fbULL, 0x0000000000000000ULL },
+		{ 0x4c5607606410fd6fULL, 0x0e34034336472796ULL, 0x0000000000008e8dULL, 0x0000000000000000ULL }, { 0x9b91a8f515a70680ULL, 0x4d1448ee640efb66ULL, 0x0000000000001c54ULL, 0x0000000000000000ULL },
+		{ 0x84fec2395f85dd37ULL, 0x99f4a48ac7ecd58cULL, 0x000000000000c561ULL, 0x0000000000000000ULL }, { 0x53396dac2e3226d8ULL, 0xdad4ef2795a5097cULL, 0x00000000000057b8ULL, 0x0000000000000000ULL },
+		{ 0x376d810ebdf636f4ULL, 0x1fb432cd637e7071ULL, 0x000000000000fcceULL, 0x0000000000000000ULL }, { 0xe0aa2e9bcc41cd1bULL, 0x5c9479603137ac81ULL, 0x0000000000006e17ULL, 0x0000000000000000ULL },
+		{ 0x09b3558b29b29d87ULL, 0xaa69f70538a72cb8ULL, 0x00000000000053a4ULL, 0x0000000000000000ULL }, { 0xde74fa1e58056668ULL, 0xe949bca86aeef048ULL, 0x000000000000c17dULL, 0x0000000000000000ULL },
+		{ 0xba2016bccbc17644ULL, 0x2c2961429c358945ULL, 0x0000000000006a0bULL, 0x0000000000000000ULL }, { 0x6de7b929ba768dabULL, 0x6f092aefce7c55b5ULL, 0x000000000000f8d2ULL, 0x0000000000000000ULL },
+		{ 0x7288d3e5f054561cULL, 0xbbe9c68b6d9e7b5fULL, 0x00000000000021e7ULL, 0x0000000000000000ULL }, { 0xa54f7c7081e3adf3ULL, 0xf8c98d263fd7a7afULL, 0x000000000000b33eULL, 0x0000000000000000ULL },
+		{ 0xc11b90d21227bddfULL, 0x3da950ccc90cdea2ULL, 0x0000000000001848ULL, 0x0000000000000000ULL }, { 0x16dc3f4763904630ULL, 0x7e891b619b450252ULL, 0x0000000000008a91ULL, 0x0000000000000000ULL },
+		{ 0x0e2966f2c5dc1dfaULL, 0xcc4e5106db31c3d0ULL, 0x0000000000006233ULL, 0x0000000000000000ULL }, { 0xd9eec967b46be615ULL, 0x8f6e1aab89781f20ULL, 0x000000000000f0eaULL, 0x0000000000000000ULL },
+		{ 0xbdba25c527aff639ULL, 0x4a0ec7417fa3662dULL, 0x0000000000005b9cULL, 0x0000000000000000ULL }, { 0x6a7d8a5056180dd6ULL, 0x092e8cec2deabaddULL, 0x000000000000c945ULL, 0x0000000000000000ULL },
+		{ 0x7512e09c1c3ad661ULL, 0xddce60888e089437ULL, 0x0000000000001070ULL, 0x0000000000000000ULL }, { 0xa2d54f096d8d2d8eULL, 0x9eee2b25dc4148c7ULL, 0x00000000000082a9ULL, 0x0000000000000000ULL },
+		{ 0xc681a3abfe493da2ULL, 0x5b8ef6cf2a9a31caULL, 0x00000000000029dfULL, 0x0000000000000000ULL }, { 0x11460c3e8ffec64dULL, 0x18aebd6278d3ed3aULL, 0x000000000000bb06ULL, 0x0000000000000000ULL },
+		{ 0xf85f772e6a0d96d1ULL, 0xee53330771436d03ULL, 0x00000000000086b5ULL, 0x0000000000000000ULL }, { 0x2f98d8bb1bba6d3eULL, 0xad7378aa230ab1f3ULL, 0x000000000000146cULL, 0x0000000000000000ULL },
+		{ 0x4bcc3419887e7d12ULL, 0x6813a540d5d1c8feULL, 0x000000000000bf1aULL, 0x0000000000000000ULL }, { 0x9c0b9b8cf9c986fdULL, 0x2b33eeed8798140eULL, 0x0000000000002dc3ULL, 0x0000000000000000ULL },
+		{ 0x8364f140b3eb5d4aULL, 0xffd30289247a3ae4ULL, 0x000000000000f4f6ULL, 0x0000000000000000ULL }, { 0x54a35ed5c25ca6a5ULL, 0xbcf349247633e614ULL, 0x000000000000662fULL, 0x0000000000000000ULL },
+		{ 0x30f7b2775198b689ULL, 0x799394ce80e89f19ULL, 0x000000000000cd59ULL, 0x0000000000000000ULL }, { 0xe7301de2202f4d66ULL, 0x3ab3df63d2a143e9ULL, 0x0000000000005f80ULL, 0x0000000000000000ULL },
+		{ 0xe39788ae11c62c45ULL, 0x0de8370839b719d6ULL, 0x0000000000007344ULL, 0x0000000000000000ULL }, { 0x3450273b6071d7aaULL, 0x4ec87ca56bfec526ULL, 0x000000000000e19dULL, 0x0000000000000000ULL },
+		{ 0x5004cb99f3b5c786ULL, 0x8ba8a14f9d25bc2bULL, 0x0000000000004aebULL, 0x0000000000000000ULL }, { 0x87c3640c82023c69ULL, 0xc888eae2cf6c60dbULL, 0x000000000000d832ULL, 0x0000000000000000ULL },
+		{ 0x98ac0ec0c820e7deULL, 0x1c6806866c8e4e31ULL, 0x0000000000000107ULL, 0x0000000000000000ULL }, { 0x4f6ba155b9971c31ULL, 0x5f484d2b3ec792c1ULL, 0x00000000000093deULL, 0x0000000000000000ULL },
+		{ 0x2b3f4df72a530c1dULL, 0x9a2890c1c81cebccULL, 0x00000000000038a8ULL, 0x0000000000000000ULL }, { 0xfcf8e2625be4f7f2ULL, 0xd908db6c9a55373cULL, 0x000000000000aa71ULL, 0x0000000000000000ULL },
+		{ 0x15e19972be17a76eULL, 0x2ff5550993c5b705ULL, 0x00000000000097c2ULL, 0x0000000000000000ULL }, { 0xc22636e7cfa05c81ULL, 0x6cd51ea4c18c6bf5ULL, 0x000000000000051bULL, 0x0000000000000000ULL },
+		{ 0xa672da455c644cadULL, 0xa9b5c34e375712f8ULL, 0x000000000000ae6dULL, 0x0000000000000000ULL }, { 0x71b575d02dd3b742ULL, 0xea9588e3651ece08ULL, 0x0000000000003cb4ULL, 0x0000000000000000ULL },
+		{ 0x6eda1f1c67f16cf5ULL, 0x3e756487c6fce0e2ULL, 0x000000000000e581ULL, 0x0000000000000000ULL }, { 0xb91db0891646971aULL, 0x7d552f2a94b53c12ULL, 0x0000000000007758ULL, 0x0000000000000000ULL },
+		{ 0xdd495c2b85828736ULL, 0xb835f2c0626e451fULL, 0x000000000000dc2eULL, 0x0000000000000000ULL }, { 0x0a8ef3bef4357cd9ULL, 0xfb15b96d302799efULL, 0x0000000000004ef7ULL, 0x0000000000000000ULL },
+		{ 0x127baa0b52792713ULL, 0x49d2f30a7053586dULL, 0x000000000000a655ULL, 0x0000000000000000ULL }, { 0xc5bc059e23cedcfcULL, 0x0af2b8a7221a849dULL, 0x000000000000348cULL, 0x0000000000000000ULL },
+		{ 0xa1e8e93cb00accd0ULL, 0xcf92654dd4c1fd90ULL, 0x0000000000009ffaULL, 0x0000000000000000ULL }, { 0x762f46a9c1bd373fULL, 0x8cb22ee086882160ULL, 0x0000000000000d23ULL, 0x0000000000000000ULL },
+		{ 0x69402c658b9fec88ULL, 0x5852c284256a0f8aULL, 0x000000000000d416ULL, 0x0000000000000000ULL }, { 0xbe8783f0fa281767ULL, 0x1b7289297723d37aULL, 0x00000000000046cfULL, 0x0000000000000000ULL },
+		{ 0xdad36f5269ec074bULL, 0xde1254c381f8aa77ULL, 0x000000000000edb9ULL, 0x0000000000000000ULL }, { 0x0d14c0c7185bfca4ULL, 0x9d321f6ed3b17687ULL, 0x0000000000007f60ULL, 0x0000000000000000ULL },
+		{ 0xe40dbbd7fda8ac38ULL, 0x6bcf910bda21f6beULL, 0x00000000000042d3ULL, 0x0000000000000000ULL }, { 0x33ca14428c1f57d7ULL, 0x28efdaa688682a4eULL, 0x000000000000d00aULL, 0x0000000000000000ULL },
+		{ 0x579ef8e01fdb47fbULL, 0xed8f074c7eb35343ULL, 0x0000000000007b7cULL, 0x0000000000000000ULL }, { 0x805957756e6cbc14ULL, 0xaeaf4ce12cfa8fb3ULL, 0x000000000000e9a5ULL, 0x0000000000000000ULL },
+		{ 0x9f363db9244e67a3ULL, 0x7a4fa0858f18a159ULL, 0x0000000000003090ULL, 0x0000000000000000ULL }, { 0x48f1922c55f99c4cULL, 0x396feb28dd517da9ULL, 0x000000000000a249ULL, 0x0000000000000000ULL },
+		{ 0x2ca57e8ec63d8c60ULL, 0xfc0f36c22b8a04a4ULL, 0x000000000000093fULL, 0x0000000000000000ULL }, { 0xfb62d11bb78a778fULL, 0xbf2f7d6f79c3d854ULL, 0x0000000000009be6ULL, 0x0000000000000000ULL },
+		{ 0x1c52ccf997a53ae9ULL, 0x859ca20cab629bbdULL, 0x000000000000c466ULL, 0x0000000000000000ULL }, { 0xcb95636ce612c106ULL, 0xc6bce9a1f92b474dULL, 0x00000000000056bfULL, 0x0000000000000000ULL },
+		{ 0xafc18fce75d6d12aULL, 0x03dc344b0ff03e40ULL, 0x000000000000fdc9ULL, 0x0000000000000000ULL }, { 0x7806205b04612ac5ULL, 0x40fc7fe65db9e2b0ULL, 0x0000000000006f10ULL, 0x0000000000000000ULL },
+		{ 0x67694a974e43f172ULL, 0x941c9382fe5bcc5aULL, 0x000000000000b625ULL, 0x0000000000000000ULL }, { 0xb0aee5023ff40a9dULL, 0xd73cd82fac1210aaULL, 0x00000000000024fcULL, 0x0000000000000000ULL },
+		{ 0xd4fa09a0ac301ab1ULL, 0x125c05c55ac969a7ULL, 0x0000000000008f8aULL, 0x0000000000000000ULL }, { 0x033da635dd87e15eULL, 0x517c4e680880b557ULL, 0x0000000000001d53ULL, 0x0000000000000000ULL },
+		{ 0xea24dd253874b1c2ULL, 0xa781c00d0110356eULL, 0x00000000000020e0ULL, 0x0000000000000000ULL }, { 0x3de372b049c34a2dULL, 0xe4a18ba05359e99eULL, 0x000000000000b239ULL, 0x0000000000000000ULL },
+		{ 0x59b79e12da075a01ULL, 0x21c1564aa5829093ULL, 0x000000000000194fULL, 0x0000000000000000ULL }, { 0x8e703187abb0a1eeULL, 0x62e11de7f7cb4c63ULL, 0x0000000000008b96ULL, 0x0000000000000000ULL },
+		{ 0x911f5b4be1927a59ULL, 0xb601f18354296289ULL, 0x00000000000052a3ULL, 0x0000000000000000ULL }, { 0x46d8f4de902581b6ULL, 0xf521ba2e0660be79ULL, 0x000000000000c07aULL, 0x0000000000000000ULL },
+		{ 0x228c187c03e1919aULL, 0x304167c4f0bbc774ULL, 0x0000000000006b0cULL, 0x0000000000000000ULL }, { 0xf54bb7e972566a75ULL, 0x73612c69a2f21b84ULL, 0x000000000000f9d5ULL, 0x0000000000000000ULL },
+		{ 0xedbeee5cd41a31bfULL, 0xc1a6660ee286da06ULL, 0x0000000000001177ULL, 0x0000000000000000ULL }, { 0x3a7941c9a5adca50ULL, 0x82862da3b0cf06f6ULL, 0x00000000000083aeULL, 0x0000000000000000ULL },
+		{ 0x5e2dad6b3669da7cULL, 0x47e6f04946147ffbULL, 0x00000000000028d8ULL, 0x0000000000000000ULL }, { 0x89ea02fe47de2193ULL, 0x04c6bbe4145da30bULL, 0x000000000000ba01ULL, 0x0000000000000000ULL },
+		{ 0x968568320dfcfa24ULL, 0xd0265780b7bf8de1ULL, 0x0000000000006334ULL, 0x0000000000000000ULL }, { 0x4142c7a77c4b01cbULL, 0x93061c2de5f65111ULL, 0x000000000000f1edULL, 0x0000000000000000ULL },
+		{ 0x25162b05ef8f11e7ULL, 0x5666c1c7132d281cULL, 0x0000000000005a9bULL, 0x0000000000000000ULL }, { 0xf2d184909e38ea08ULL, 0x15468a6a4164f4ecULL, 0x000000000000c842ULL, 0x0000000000000000ULL },
+		{ 0x1bc8ff807bcbba94ULL, 0xe3bb040f48f474d5ULL, 0x000000000000f5f1ULL, 0x0000000000000000ULL }, { 0xcc0f50150a7c417bULL, 0xa09b4fa21abda825ULL, 0x0000000000006728ULL, 0x0000000000000000ULL },
+		{ 0xa85bbcb799b85157ULL, 0x65fb9248ec66d128ULL, 0x000000000000cc5eULL, 0x0000000000000000ULL }, { 0x7f9c1322e80faab8ULL, 0x26dbd9e5be2f0dd8ULL, 0x0000000000005e87ULL, 0x0000000000000000ULL },
+		{ 0x60f379eea22d710fULL, 0xf23b35811dcd2332ULL, 0x00000000000087b2ULL, 0x0000000000000000ULL }, { 0xb734d67bd39a8ae0ULL, 0xb11b7e2c4f84ffc2ULL, 0x000000000000156bULL, 0x0000000000000000ULL },
+		{ 0xd3603ad9405e9accULL, 0x747ba3c6b95f86cfULL, 0x000000000000be1dULL, 0x0000000000000000ULL }, { 0x04a7954c31e96123ULL, 0x375be86beb165a3fULL, 0x0000000000002cc4ULL, 0x0000000000000000ULL },
+		{ 0xdb330d412291588aULL, 0x1acd6e10727332b1ULL, 0x000000000000e688ULL, 0x0000000000000000ULL }, { 0x0cf4a2d45326a365ULL, 0x59ed25bd203aee41ULL, 0x0000000000007451ULL, 0x0000000000000000ULL },
+		{ 0x68a04e76c0e2b349ULL, 0x9c8df857d6e1974cULL, 0x000000000000df27ULL, 0x0000000000000000ULL }, { 0xbf67e1e3b15548a6ULL, 0xdfadb3fa84a84bbcULL, 0x0000000000004dfeULL, 0x0000000000000000ULL },
+		{ 0xa0088b2ffb779311ULL, 0x0b4d5f9e274a6556ULL, 0x00000000000094cbULL, 0x0000000000000000ULL }, { 0x77cf24ba8ac068feULL, 0x486d14337503b9a6ULL, 0x0000000000000612ULL, 0x0000000000000000ULL },
+		{ 0x139bc818190478d2ULL, 0x8d0dc9d983d8c0abULL, 0x000000000000ad64ULL, 0x0000000000000000ULL }, { 0xc45c678d68b3833dULL, 0xce2d8274d1911c5bULL, 0x0000000000003fbdULL, 0x0000000000000000ULL },
+		{ 0x2d451c9d8d40d3a1ULL, 0x38d00c11d8019c62ULL, 0x000000000000020eULL, 0x0000000000000000ULL }, { 0xfa82b308fcf7284eULL, 0x7bf047bc8a484092ULL, 0x00000000000090d7ULL, 0x0000000000000000ULL },
+		{ 0x9ed65faa6f333862ULL, 0xbe909a567c93399fULL, 0x0000000000003ba1ULL, 0x0000000000000000ULL }, { 0x4911f03f1e84c38dULL, 0xfdb0d1fb2edae56fULL, 0x000000000000a978ULL, 0x0000000000000000ULL },
+		{ 0x567e9af354a6183aULL, 0x29503d9f8d38cb85ULL, 0x000000000000704dULL, 0x0000000000000000ULL }, { 0x81b935662511e3d5ULL, 0x6a707632df711775ULL, 0x000000000000e294ULL, 0x0000000000000000ULL },
+		{ 0xe5edd9c4b6d5f3f9ULL, 0xaf10abd829aa6e78ULL, 0x00000000000049e2ULL, 0x0000000000000000ULL }, { 0x322a7651c7620816ULL, 0xec30e0757be3b288ULL, 0x000000000000db3bULL, 0x0000000000000000ULL },
+		{ 0x2adf2fe4612e53dcULL, 0x5ef7aa123b97730aULL, 0x0000000000003399ULL, 0x0000000000000000ULL }, { 0xfd1880711099a833ULL, 0x1dd7e1bf69deaffaULL, 0x000000000000a140ULL, 0x0000000000000000ULL },
+		{ 0x994c6cd3835db81fULL, 0xd8b73c559f05d6f7ULL, 0x0000000000000a36ULL, 0x0000000000000000ULL }, { 0x4e8bc346f2ea43f0ULL, 0x9b9777f8cd4c0a07ULL, 0x00000000000098efULL, 0x0000000000000000ULL },
+		{ 0x51e4a98ab8c89847ULL, 0x4f779b9c6eae24edULL, 0x00000000000041daULL, 0x0000000000000000ULL }, { 0x8623061fc97f63a8ULL, 0x0c57d0313ce7f81dULL, 0x000000000000d303ULL, 0x0000000000000000ULL },
+		{ 0xe277eabd5abb7384ULL, 0xc9370ddbca3c8110ULL, 0x0000000000007875ULL, 0x0000000000000000ULL }, { 0x35b045282b0c886bULL, 0x8a17467698755de0ULL, 0x000000000000eaacULL, 0x0000000000000000ULL },
+		{ 0xdca93e38ceffd8f7ULL, 0x7ceac81391e5ddd9ULL, 0x000000000000d71fULL, 0x0000000000000000ULL }, { 0x0b6e91adbf482318ULL, 0x3fca83bec3ac0129ULL, 0x00000000000045c6ULL, 0x0000000000000000ULL },
+		{ 0x6f3a7d0f2c8c3334ULL, 0xfaaa5e5435777824ULL, 0x000000000000eeb0ULL, 0x0000000000000000ULL }, { 0xb8fdd29a5d3bc8dbULL, 0xb98a15f9673ea4d4ULL, 0x0000000000007c69ULL, 0x0000000000000000ULL },
+		{ 0xa792b8561719136cULL, 0x6d6af99dc4dc8a3eULL, 0x000000000000a55cULL, 0x0000000000000000ULL }, { 0x705517c366aee883ULL, 0x2e4ab230969556ceULL, 0x0000000000003785ULL, 0x0000000000000000ULL },
+		{ 0x1401fb61f56af8afULL, 0xeb2a6fda604e2fc3ULL, 0x0000000000009cf3ULL, 0x0000000000000000ULL }, { 0xc3c654f484dd0340ULL, 0xa80a24773207f333ULL, 0x0000000000000e2aULL, 0x0000000000000000ULL },
+		{ 0x24f64916a4f24e26ULL, 0x92b9fb14e0a6b0daULL, 0x00000000000051aaULL, 0x0000000000000000ULL }, { 0xf331e683d545b5c9ULL, 0xd199b0b9b2ef6c2aULL, 0x000000000000c373ULL, 0x0000000000000000ULL },
+		{ 0x97650a214681a5e5ULL, 0x14f96d5344341527ULL, 0x0000000000006805ULL, 0x0000000000000000ULL }, { 0x40a2a5b437365e0aULL, 0x57d926fe167dc9d7ULL, 0x000000000000fadcULL, 0x0000000000000000ULL },
+		{ 0x5fcdcf787d1485bdULL, 0x8339ca9ab59fe73dULL, 0x00000000000023e9ULL, 0x0000000000000000ULL }, { 0x880a60ed0ca37e52ULL, 0xc0198137e7d63bcdULL, 0x000000000000b130ULL, 0x0000000000000000ULL },
+		{ 0xec5e8c4f9f676e7eULL, 0x05795cdd110d42c0ULL, 0x0000000000001a46ULL, 0x0000000000000000ULL }, { 0x3b9923daeed09591ULL, 0x4659177043449e30ULL, 0x000000000000889fULL, 0x0000000000000000ULL },
+		{ 0xd28058ca0b23c50dULL, 0xb0a499154ad41e09ULL, 0x000000000000b52cULL, 0x0000000000000000ULL }, { 0x0547f75f7a943ee2ULL, 0xf384d2b8189dc2f9ULL, 0x00000000000027f5ULL, 0x0000000000000000ULL },
+		{ 0x61131bfde9502eceULL, 0x36e40f52ee46bbf4ULL, 0x0000000000008c83ULL, 0x0000000000000000ULL }, { 0xb6d4b46898e7d521ULL, 0x75c444ffbc0f6704ULL, 0x0000000000001e5aULL, 0x0000000000000000ULL },
+		{ 0xa9bbdea4d2c50e96ULL, 0xa124a89b1fed49eeULL, 0x000000000000c76fULL, 0x0000000000000000ULL }, { 0x7e7c7131a372f579ULL, 0xe204e3364da4951eULL, 0x00000000000055b6ULL, 0x0000000000000000ULL },
+		{ 0x1a289d9330b6e555ULL, 0x27643edcbb7fec13ULL, 0x000000000000fec0ULL, 0x0000000000000000ULL }, { 0xcdef320641011ebaULL, 0x64447571e93630e3ULL, 0x0000000000006c19ULL, 0x0000000000000000ULL },
+		{ 0xd51a6bb3e74d4570ULL, 0xd6833f16a942f161ULL, 0x00000000000084bbULL, 0x0000000000000000ULL }, { 0x02ddc42696fabe9fULL, 0x95a374bbfb0b2d91ULL, 0x0000000000001662ULL, 0x0000000000000000ULL },
+		{ 0x66892884053eaeb3ULL, 0x50c3a9510dd0549cULL, 0x000000000000bd14ULL, 0x0000000000000000ULL }, { 0xb14e87117489555cULL, 0x13e3e2fc5f99886cULL, 0x0000000000002fcdULL, 0x0000000000000000ULL },
+		{ 0xae21eddd3eab8eebULL, 0xc7030e98fc7ba686ULL, 0x000000000000f6f8ULL, 0x0000000000000000ULL }, { 0x79e642484f1c7504ULL, 0x84234535ae327a76ULL, 0x0000000000006421ULL, 0x0000000000000000ULL },
+		{ 0x1db2aeeadcd86528ULL, 0x414398df58e9037bULL, 0x000000000000cf57ULL, 0x0000000000000000ULL }, { 0xca75017fad6f9ec7ULL, 0x0263d3720aa0df8bULL, 0x0000000000005d8eULL, 0x0000000000000000ULL },
+		{ 0x236c7a6f489cce5bULL, 0xf49e5d1703305fb2ULL, 0x000000000000603dULL, 0x0000000000000000ULL }, { 0xf4abd5fa392b35b4ULL, 0xb7be16ba51798342ULL, 0x000000000000f2e4ULL, 0x0000000000000000ULL },
+		{ 0x90ff3958aaef2598ULL, 0x72decb50a7a2fa4fULL, 0x0000000000005992ULL, 0x0000000000000000ULL }, { 0x473896cddb58de77ULL, 0x31fe80fdf5eb26bfULL, 0x000000000000cb4bULL, 0x0000000000000000ULL },
+		{ 0x5857fc01917a05c0ULL, 0xe51e6c9956090855ULL, 0x000000000000127eULL, 0x0000000000000000ULL }, { 0x8f905394e0cdfe2fULL, 0xa63e27340440d4a5ULL, 0x00000000000080a7ULL, 0x0000000000000000ULL },
+		{ 0xebc4bf367309ee03ULL, 0x635efadef29bada8ULL, 0x0000000000002bd1ULL, 0x0000000000000000ULL }, { 0x3c0310a302be15ecULL, 0x207eb173a0d27158ULL, 0x000000000000b908ULL, 0x0000000000000000ULL },
+		{ 0x38a485ef335774cfULL, 0x172559184bc42b67ULL, 0x00000000000095ccULL, 0x0000000000000000ULL }, { 0xef632a7a42e08f20ULL, 0x540512b5198df797ULL, 0x0000000000000715ULL, 0x0000000000000000ULL },
+		{ 0x8b37c6d8d1249f0cULL, 0x9165cf5fef568e9aULL, 0x000000000000ac63ULL, 0x0000000000000000ULL }, { 0x5cf0694da09364e3ULL, 0xd24584f2bd1f526aULL, 0x0000000000003ebaULL, 0x0000000000000000ULL },
+		{ 0x439f0381eab1bf54ULL, 0x06a568961efd7c80ULL, 0x000000000000e78fULL, 0x0000000000000000ULL }, { 0x9458ac149b0644bbULL, 0x4585233b4cb4a070ULL, 0x0000000000007556ULL, 0x0000000000000000ULL },
+		{ 0xf00c40b608c25497ULL, 0x80e5fed1ba6fd97dULL, 0x000000000000de20ULL, 0x0000000000000000ULL }, { 0x27cbef237975af78ULL, 0xc3c5b57ce826058dULL, 0x0000000000004cf9ULL, 0x0000000000000000ULL },
+		{ 0xced294339c86ffe4ULL, 0x35383b19e1b685b4ULL, 0x000000000000714aULL, 0x0000000000000000ULL }, { 0x19153ba6ed31040bULL, 0x761870b4b3ff5944ULL, 0x000000000000e393ULL, 0x0000000000000000ULL },
+		{ 0x7d41d7047ef51427ULL, 0xb378ad5e45242049ULL, 0x00000000000048e5ULL, 0x0000000000000000ULL }, { 0xaa8678910f42efc8ULL, 0xf058e6f3176dfcb9ULL, 0x000000000000da3cULL, 0x0000000000000000ULL },
+		{ 0xb5e9125d4560347fULL, 0x24b80a97b48fd253ULL, 0x0000000000000309ULL, 0x0000000000000000ULL }, { 0x622ebdc834d7cf90ULL, 0x6798413ae6c60ea3ULL, 0x00000000000091d0ULL, 0x0000000000000000ULL },
+		{ 0x067a516aa713dfbcULL, 0xa2f89cd0101d77aeULL, 0x0000000000003aa6ULL, 0x0000000000000000ULL }, { 0xd1bdfeffd6a42453ULL, 0xe1d8d77d4254ab5eULL, 0x000000000000a87fULL, 0x0000000000000000ULL },
+		{ 0xc948a74a70e87f99ULL, 0x531f9d1a02206adcULL, 0x00000000000040ddULL, 0x0000000000000000ULL }, { 0x1e8f08df015f8476ULL, 0x103fd6b75069b62cULL, 0x000000000000d204ULL, 0x0000000000000000ULL },
+		{ 0x7adbe47d929b945aULL, 0xd55f0b5da6b2cf21ULL, 0x0000000000007972ULL, 0x0000000000000000ULL }, { 0xad1c4be8e32c6fb5ULL, 0x967f40f0f4fb13d1ULL, 0x000000000000ebabULL, 0x0000000000000000ULL },
+		{ 0xb2732124a90eb402ULL, 0x429fac9457193d3bULL, 0x000000000000329eULL, 0x0000000000000000ULL }, { 0x65b48eb1d8b94fedULL, 0x01bfe7390550e1cbULL, 0x000000000000a047ULL, 0x0000000000000000ULL },
+		{ 0x01e062134b7d5fc1ULL, 0xc4df3ad3f38b98c6ULL, 0x0000000000000b31ULL, 0x0000000000000000ULL }, { 0xd627cd863acaa42eULL, 0x87ff717ea1c24436ULL, 0x00000000000099e8ULL, 0x0000000000000000ULL },
+		{ 0x3f3eb696df39f4b2ULL, 0x7102ff1ba852c40fULL, 0x000000000000a45bULL, 0x0000000000000000ULL }, { 0xe8f91903ae8e0f5dULL, 0x3222b4b6fa1b18ffULL, 0x0000000000003682ULL, 0x0000000000000000ULL },
+		{ 0x8cadf5a13d4a1f71ULL, 0xf742695c0cc061f2ULL, 0x0000000000009df4ULL, 0x0000000000000000ULL }, { 0x5b6a5a344cfde49eULL, 0xb46222f15e89bd02ULL, 0x0000000000000f2dULL, 0x0000000000000000ULL },
+		{ 0x440530f806df3f29ULL, 0x6082ce95fd6b93e8ULL, 0x000000000000d618ULL, 0x0000000000000000ULL }, { 0x93c29f6d7768c4c6ULL, 0x23a28538af224f18ULL, 0x00000000000044c1ULL, 0x0000000000000000ULL },
+		{ 0xf79673cfe4acd4eaULL, 0xe6c258d259f93615ULL, 0x000000000000efb7ULL, 0x0000000000000000ULL }, { 0x2051dc5a951b2f05ULL, 0xa5e2137f0bb0eae5ULL, 0x0000000000007d6eULL, 0x0000000000000000ULL },
+		{ 0xc761c1b8b5346263ULL, 0x9f51cc1cd911a90cULL, 0x00000000000022eeULL, 0x0000000000000000ULL }, { 0x10a66e2dc483998cULL, 0xdc7187b18b5875fcULL, 0x000000000000b037ULL, 0x0000000000000000ULL },
+		{ 0x74f2828f574789a0ULL, 0x19115a5b7d830cf1ULL, 0x0000000000001b41ULL, 0x0000000000000000ULL }, { 0xa3352d1a26f0724fULL, 0x5a3111f62fcad001ULL, 0x0000000000008998ULL, 0x0000000000000000ULL },
+		{ 0xbc5a47d66cd2a9f8ULL, 0x8ed1fd928c28feebULL, 0x00000000000050adULL, 0x0000000000000000ULL }, { 0x6b9de8431d655217ULL, 0xcdf1b63fde61221bULL, 0x000000000000c274ULL, 0x0000000000000000ULL },
+		{ 0x0fc904e18ea1423bULL, 0x08916bd528ba5b16ULL, 0x0000000000006902ULL, 0x0000000000000000ULL }, { 0xd80eab74ff16b9d4ULL, 0x4bb120787af387e6ULL, 0x000000000000fbdbULL, 0x0000000000000000ULL },
+		{ 0x3117d0641ae5e948ULL, 0xbd4cae1d736307dfULL, 0x000000000000c668ULL, 0x0000000000000000ULL }, { 0xe6d07ff16b5212a7ULL, 0xfe6ce5b0212adb2fULL, 0x00000000000054b1ULL, 0x0000000000000000ULL },
+		{ 0x82849353f896028bULL, 0x3b0c385ad7f1a222ULL, 0x000000000000ffc7ULL, 0x0000000000000000ULL }, { 0x55433cc68921f964ULL, 0x782c73f785b87ed2ULL, 0x0000000000006d1eULL, 0x0000000000000000ULL },
+		{ 0x4a2c560ac30322d3ULL, 0xaccc9f93265a5038ULL, 0x000000000000b42bULL, 0x0000000000000000ULL }, { 0x9debf99fb2b4d93cULL, 0xefecd43e74138cc8ULL, 0x00000000000026f2ULL, 0x0000000000000000ULL },
+		{ 0xf9bf153d2170c910ULL, 0x2a8c09d482c8f5c5ULL, 0x0000000000008d84ULL, 0x0000000000000000ULL }, { 0x2e78baa850c732ffULL, 0x69ac4279d0812935ULL, 0x0000000000001f5dULL, 0x0000000000000000ULL },
+		{ 0x368de31df68b6935ULL, 0xdb6b081e90f5e8b7ULL, 0x000000000000f7ffULL, 0x0000000000000000ULL }, { 0xe14a4c88873c92daULL, 0x984b43b3c2bc3447ULL, 0x0000000000006526ULL, 0x0000000000000000ULL },
+		{ 0x851ea02a14f882f6ULL, 0x5d2b9e5934674d4aULL, 0x000000000000ce50ULL, 0x0000000000000000ULL }, { 0x52d90fbf654f7919ULL, 0x1e0bd5f4662e91baULL, 0x0000000000005c89ULL, 0x0000000000000000ULL },
+		{ 0x4db665732f6da2aeULL, 0xcaeb3990c5ccbf50ULL, 0x00000000000085bcULL, 0x0000000000000000ULL }, { 0x9a71cae65eda5941ULL, 0x89cb723d978563a0ULL, 0x0000000000001765ULL, 0x0000000000000000ULL },
+		{ 0xfe252644cd1e496dULL, 0x4cabafd7615e1aadULL, 0x000000000000bc13ULL, 0x0000000000000000ULL }, { 0x29e289d1bca9b282ULL, 0x0f8be47a3317c65dULL, 0x0000000000002ecaULL, 0x0000000000000000ULL },
+		{ 0xc0fbf2c1595ae21eULL, 0xf9766a1f3a874664ULL, 0x0000000000001379ULL, 0x0000000000000000ULL }, { 0x173c5d5428ed19f1ULL, 0xba5621b268ce9a94ULL, 0x00000000000081a0ULL, 0x0000000000000000ULL },
+		{ 0x7368b1f6bb2909ddULL, 0x7f36fc589e15e399ULL, 0x0000000000002ad6ULL, 0x0000000000000000ULL }, { 0xa4af1e63ca9ef232ULL, 0x3c16b7f5cc5c3f69ULL, 0x000000000000b80fULL, 0x0000000000000000ULL },
+		{ 0xbbc074af80bc2985ULL, 0xe8f65b916fbe1183ULL, 0x000000000000613aULL, 0x0000000000000000ULL }, { 0x6c07db3af10bd26aULL, 0xabd6103c3df7cd73ULL, 0x000000000000f3e3ULL, 0x0000000000000000ULL },
+		{ 0x0853379862cfc246ULL, 0x6eb6cdd6cb2cb47eULL, 0x0000000000005895ULL, 0x0000000000000000ULL }, { 0xdf94980d137839a9ULL, 0x2d96867b9965688eULL, 0x000000000000ca4cULL, 0x0000000000000000ULL },
+	},
+	{ // 20
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xdc06636f05f0b998ULL, 0xc6e416bb24459670ULL, 0x00000000aea57979ULL, 0x0000000000000000ULL },
+		{ 0xa50cc6de0afd6f2dULL, 0x91d52c6b488a31e0ULL, 0x000000004157f2f2ULL, 0x0000000000000000ULL }, { 0x790aa5b10f0dd6b5ULL, 0x57313ad06ccfa790ULL, 0x00000000eff28b8bULL, 0x0000000000000000ULL },
+		{ 0x571891a114e7de5aULL, 0x3fb758d6900962ddULL, 0x0000000082aef9f9ULL, 0x0000000000000000ULL }, { 0x8b1ef2ce111767c2ULL, 0xf9534e6db44cf4adULL, 0x000000002c0b8080ULL, 0x0000000000000000ULL },
+		{ 0xf214577f1e1ab177ULL, 0xae6274bdd883533dULL, 0x00000000c3f90b0bULL, 0x0000000000000000ULL }, { 0x2e1234101bea08efULL, 0x68866206fcc6c54dULL, 0x000000006d5c7272ULL, 0x0000000000000000ULL },
+		{ 0xae303f5f28d3a1b4ULL, 0x7e73b0b13d12c4a7ULL, 0x000000001941efefULL, 0x0000000000000000ULL }, { 0x72365c302d23182cULL, 0xb897a60a195752d7ULL, 0x00000000b7e49696ULL, 0x0000000000000000ULL },
+		{ 0x0b3cf981222ece99ULL, 0xefa69cda7598f547ULL, 0x0000000058161d1dULL, 0x0000000000000000ULL }, { 0xd73a9aee27de7701ULL, 0x29428a6151dd6337ULL, 0x00000000f6b36464ULL, 0x0000000000000000ULL },
+		{ 0xf928aefe3c347feeULL, 0x41c4e867ad1ba67aULL, 0x000000009bef1616ULL, 0x0000000000000000ULL }, { 0x252ecd9139c4c676ULL, 0x8720fedc895e300aULL, 0x00000000354a6f6fULL, 0x0000000000000000ULL },
+		{ 0x5c24682036c910c3ULL, 0xd011c40ce591979aULL, 0x00000000dab8e4e4ULL, 0x0000000000000000ULL }, { 0x80220b4f3339a95bULL, 0x16f5d2b7c1d401eaULL, 0x00000000741d9d9dULL, 0x0000000000000000ULL },
+		{ 0x41607ebe50bb5f75ULL, 0xfce67d7f7a249553ULL, 0x000000003282c3c3ULL, 0x0000000000000000ULL }, { 0x9d661dd1554be6edULL, 0x3a026bc45e610323ULL, 0x000000009c27babaULL, 0x0000000000000000ULL },
+		{ 0xe46cb8605a463058ULL, 0x6d33511432aea4b3ULL, 0x0000000073d53131ULL, 0x0000000000000000ULL }, { 0x386adb0f5fb689c0ULL, 0xabd747af16eb32c3ULL, 0x00000000dd704848ULL, 0x0000000000000000ULL },
+		{ 0x1678ef1f445c812fULL, 0xc35125a9ea2df78eULL, 0x00000000b02c3a3aULL, 0x0000000000000000ULL }, { 0xca7e8c7041ac38b7ULL, 0x05b53312ce6861feULL, 0x000000001e894343ULL, 0x0000000000000000ULL },
+		{ 0xb37429c14ea1ee02ULL, 0x528409c2a2a7c66eULL, 0x00000000f17bc8c8ULL, 0x0000000000000000ULL }, { 0x6f724aae4b51579aULL, 0x94601f7986e2501eULL, 0x000000005fdeb1b1ULL, 0x0000000000000000ULL },
+		{ 0xef5041e17868fec1ULL, 0x8295cdce473651f4ULL, 0x000000002bc32c2cULL, 0x0000000000000000ULL }, { 0x3356228e7d984759ULL, 0x4471db756373c784ULL, 0x0000000085665555ULL, 0x0000000000000000ULL },
+		{ 0x4a5c873f729591ecULL, 0x1340e1a50fbc6014ULL, 0x000000006a94dedeULL, 0x0000000000000000ULL }, { 0x965ae45077652874ULL, 0xd5a4f71e2bf9f664ULL, 0x00000000c431a7a7ULL, 0x0000000000000000ULL },
+		{ 0xb848d0406c8f209bULL, 0xbd229518d73f3329ULL, 0x00000000a96dd5d5ULL, 0x0000000000000000ULL }, { 0x644eb32f697f9903ULL, 0x7bc683a3f37aa559ULL, 0x0000000007c8acacULL, 0x0000000000000000ULL },
+		{ 0x1d44169e66724fb6ULL, 0x2cf7b9739fb502c9ULL, 0x00000000e83a2727ULL, 0x0000000000000000ULL }, { 0xc14275f16382f62eULL, 0xea13afc8bbf094b9ULL, 0x00000000469f5e5eULL, 0x0000000000000000ULL },
+		{ 0x82c0fc61a06bbeeaULL, 0xe5d1fafef44837a6ULL, 0x0000000064199b9bULL, 0x0000000000000000ULL }, { 0x5ec69f0ea59b0772ULL, 0x2335ec45d00da1d6ULL, 0x00000000cabce2e2ULL, 0x0000000000000000ULL },
+		{ 0x27cc3abfaa96d1c7ULL, 0x7404d695bcc20646ULL, 0x00000000254e6969ULL, 0x0000000000000000ULL }, { 0xfbca59d0af66685fULL, 0xb2e0c02e98879036ULL, 0x000000008beb1010ULL, 0x0000000000000000ULL },
+		{ 0xd5d86dc0b48c60b0ULL, 0xda66a2286441557bULL, 0x00000000e6b76262ULL, 0x0000000000000000ULL }, { 0x09de0eafb17cd928ULL, 0x1c82b4934004c30bULL, 0x0000000048121b1bULL, 0x0000000000000000ULL },
+		{ 0x70d4ab1ebe710f9dULL, 0x4bb38e432ccb649bULL, 0x00000000a7e09090ULL, 0x0000000000000000ULL }, { 0xacd2c871bb81b605ULL, 0x8d5798f8088ef2ebULL, 0x000000000945e9e9ULL, 0x0000000000000000ULL },
+		{ 0x2cf0c33e88b81f5eULL, 0x9ba24a4fc95af301ULL, 0x000000007d587474ULL, 0x0000000000000000ULL }, { 0xf0f6a0518d48a6c6ULL, 0x5d465cf4ed1f6571ULL, 0x00000000d3fd0d0dULL, 0x0000000000000000ULL },
+		{ 0x89fc05e082457073ULL, 0x0a77662481d0c2e1ULL, 0x000000003c0f8686ULL, 0x0000000000000000ULL }, { 0x55fa668f87b5c9ebULL, 0xcc93709fa5955491ULL, 0x0000000092aaffffULL, 0x0000000000000000ULL },
+		{ 0x7be8529f9c5fc104ULL, 0xa4151299595391dcULL, 0x00000000fff68d8dULL, 0x0000000000000000ULL }, { 0xa7ee31f099af789cULL, 0x62f104227d1607acULL, 0x000000005153f4f4ULL, 0x0000000000000000ULL },
+		{ 0xdee4944196a2ae29ULL, 0x35c03ef211d9a03cULL, 0x00000000bea17f7fULL, 0x0000000000000000ULL }, { 0x02e2f72e935217b1ULL, 0xf3242849359c364cULL, 0x0000000010040606ULL, 0x0000000000000000ULL },
+		{ 0xc3a082dff0d0e19fULL, 0x193787818e6ca2f5ULL, 0x00000000569b5858ULL, 0x0000000000000000ULL }, { 0x1fa6e1b0f5205807ULL, 0xdfd3913aaa293485ULL, 0x00000000f83e2121ULL, 0x0000000000000000ULL },
+		{ 0x66ac4401fa2d8eb2ULL, 0x88e2abeac6e69315ULL, 0x0000000017ccaaaaULL, 0x0000000000000000ULL }, { 0xbaaa276effdd372aULL, 0x4e06bd51e2a30565ULL, 0x00000000b969d3d3ULL, 0x0000000000000000ULL },
+		{ 0x94b8137ee4373fc5ULL, 0x2680df571e65c028ULL, 0x00000000d435a1a1ULL, 0x0000000000000000ULL }, { 0x48be7011e1c7865dULL, 0xe064c9ec3a205658ULL, 0x000000007a90d8d8ULL, 0x0000000000000000ULL },
+		{ 0x31b4d5a0eeca50e8ULL, 0xb755f33c56eff1c8ULL, 0x0000000095625353ULL, 0x0000000000000000ULL }, { 0xedb2b6cfeb3ae970ULL, 0x71b1e58772aa67b8ULL, 0x000000003bc72a2aULL, 0x0000000000000000ULL },
+		{ 0x6d90bd80d803402bULL, 0x67443730b37e6652ULL, 0x000000004fdab7b7ULL, 0x0000000000000000ULL }, { 0xb196deefddf3f9b3ULL, 0xa1a0218b973bf022ULL, 0x00000000e17fceceULL, 0x0000000000000000ULL },
+		{ 0xc89c7b5ed2fe2f06ULL, 0xf6911b5bfbf457b2ULL, 0x000000000e8d4545ULL, 0x0000000000000000ULL }, { 0x149a1831d70e969eULL, 0x30750de0dfb1c1c2ULL, 0x00000000a0283c3cULL, 0x0000000000000000ULL },
+		{ 0x3a882c21cce49e71ULL, 0x58f36fe62377048fULL, 0x00000000cd744e4eULL, 0x0000000000000000ULL }, { 0xe68e4f4ec91427e9ULL, 0x9e17795d073292ffULL, 0x0000000063d13737ULL, 0x0000000000000000ULL },
+		{ 0x9f84eaffc619f15cULL, 0xc926438d6bfd356fULL, 0x000000008c23bcbcULL, 0x0000000000000000ULL }, { 0x43828990c3e948c4ULL, 0x0fc255364fb8a31fULL, 0x000000002286c5c5ULL, 0x0000000000000000ULL },
+		{ 0x199de5c25dd661c9ULL, 0xd7bfe9e1f5906e51ULL, 0x00000000c8322b2bULL, 0x0000000000000000ULL }, { 0xc59b86ad5826d851ULL, 0x115bff5ad1d5f821ULL, 0x0000000066975252ULL, 0x0000000000000000ULL },
+		{ 0xbc91231c572b0ee4ULL, 0x466ac58abd1a5fb1ULL, 0x000000008965d9d9ULL, 0x0000000000000000ULL }, { 0x6097407352dbb77cULL, 0x808ed331995fc9c1ULL, 0x0000000027c0a0a0ULL, 0x0000000000000000ULL },
+		{ 0x4e8574634931bf93ULL, 0xe808b13765990c8cULL, 0x000000004a9cd2d2ULL, 0x0000000000000000ULL }, { 0x9283170c4cc1060bULL, 0x2eeca78c41dc9afcULL, 0x00000000e439ababULL, 0x0000000000000000ULL },
+		{ 0xeb89b2bd43ccd0beULL, 0x79dd9d5c2d133d6cULL, 0x000000000bcb2020ULL, 0x0000000000000000ULL }, { 0x378fd1d2463c6926ULL, 0xbf398be70956ab1cULL, 0x00000000a56e5959ULL, 0x0000000000000000ULL },
+		{ 0xb7adda9d7505c07dULL, 0xa9cc5950c882aaf6ULL, 0x00000000d173c4c4ULL, 0x0000000000000000ULL }, { 0x6babb9f270f579e5ULL, 0x6f284febecc73c86ULL, 0x000000007fd6bdbdULL, 0x0000000000000000ULL },
+		{ 0x12a11c437ff8af50ULL, 0x3819753b80089b16ULL, 0x0000000090243636ULL, 0x0000000000000000ULL }, { 0xcea77f2c7a0816c8ULL, 0xfefd6380a44d0d66ULL, 0x000000003e814f4fULL, 0x0000000000000000ULL },
+		{ 0xe0b54b3c61e21e27ULL, 0x967b0186588bc82bULL, 0x0000000053dd3d3dULL, 0x0000000000000000ULL }, { 0x3cb328536412a7bfULL, 0x509f173d7cce5e5bULL, 0x00000000fd784444ULL, 0x0000000000000000ULL },
+		{ 0x45b98de26b1f710aULL, 0x07ae2ded1001f9cbULL, 0x00000000128acfcfULL, 0x0000000000000000ULL }, { 0x99bfee8d6eefc892ULL, 0xc14a3b5634446fbbULL, 0x00000000bc2fb6b6ULL, 0x0000000000000000ULL },
+		{ 0x58fd9b7c0d6d3ebcULL, 0x2b59949e8fb4fb02ULL, 0x00000000fab0e8e8ULL, 0x0000000000000000ULL }, { 0x84fbf813089d8724ULL, 0xedbd8225abf16d72ULL, 0x0000000054159191ULL, 0x0000000000000000ULL },
+		{ 0xfdf15da207905191ULL, 0xba8cb8f5c73ecae2ULL, 0x00000000bbe71a1aULL, 0x0000000000000000ULL }, { 0x21f73ecd0260e809ULL, 0x7c68ae4ee37b5c92ULL, 0x0000000015426363ULL, 0x0000000000000000ULL },
+		{ 0x0fe50add198ae0e6ULL, 0x14eecc481fbd99dfULL, 0x00000000781e1111ULL, 0x0000000000000000ULL }, { 0xd3e369b21c7a597eULL, 0xd20adaf33bf80fafULL, 0x00000000d6bb6868ULL, 0x0000000000000000ULL },
+		{ 0xaae9cc0313778fcbULL, 0x853be0235737a83fULL, 0x000000003949e3e3ULL, 0x0000000000000000ULL }, { 0x76efaf6c16873653ULL, 0x43dff69873723e4fULL, 0x0000000097ec9a9aULL, 0x0000000000000000ULL },
+		{ 0xf6cda42325be9f08ULL, 0x552a242fb2a63fa5ULL, 0x00000000e3f10707ULL, 0x0000000000000000ULL }, { 0x2acbc74c204e2690ULL, 0x93ce329496e3a9d5ULL, 0x000000004d547e7eULL, 0x0000000000000000ULL },
+		{ 0x53c162fd2f43f025ULL, 0xc4ff0844fa2c0e45ULL, 0x00000000a2a6f5f5ULL, 0x0000000000000000ULL }, { 0x8fc701922ab349bdULL, 0x021b1effde699835ULL, 0x000000000c038c8cULL, 0x0000000000000000ULL },
+		{ 0xa1d5358231594152ULL, 0x6a9d7cf922af5d78ULL, 0x00000000615ffefeULL, 0x0000000000000000ULL }, { 0x7dd356ed34a9f8caULL, 0xac796a4206eacb08ULL, 0x00000000cffa8787ULL, 0x0000000000000000ULL },
+		{ 0x04d9f35c3ba42e7fULL, 0xfb4850926a256c98ULL, 0x0000000020080c0cULL, 0x0000000000000000ULL }, { 0xd8df90333e5497e7ULL, 0x3dac46294e60fae8ULL, 0x000000008ead7575ULL, 0x0000000000000000ULL },
+		{ 0x9b5d19a3fdbddf23ULL, 0x326e131f01d859f7ULL, 0x00000000ac2bb0b0ULL, 0x0000000000000000ULL }, { 0x475b7accf84d66bbULL, 0xf48a05a4259dcf87ULL, 0x00000000028ec9c9ULL, 0x0000000000000000ULL },
+		{ 0x3e51df7df740b00eULL, 0xa3bb3f7449526817ULL, 0x00000000ed7c4242ULL, 0x0000000000000000ULL }, { 0xe257bc12f2b00996ULL, 0x655f29cf6d17fe67ULL, 0x0000000043d93b3bULL, 0x0000000000000000ULL },
+		{ 0xcc458802e95a0179ULL, 0x0dd94bc991d13b2aULL, 0x000000002e854949ULL, 0x0000000000000000ULL }, { 0x1043eb6decaab8e1ULL, 0xcb3d5d72b594ad5aULL, 0x0000000080203030ULL, 0x0000000000000000ULL },
+		{ 0x69494edce3a76e54ULL, 0x9c0c67a2d95b0acaULL, 0x000000006fd2bbbbULL, 0x0000000000000000ULL }, { 0xb54f2db3e657d7ccULL, 0x5ae87119fd1e9cbaULL, 0x00000000c177c2c2ULL, 0x0000000000000000ULL },
+		{ 0x356d26fcd56e7e97ULL, 0x4c1da3ae3cca9d50ULL, 0x00000000b56a5f5fULL, 0x0000000000000000ULL }, { 0xe96b4593d09ec70fULL, 0x8af9b515188f0b20ULL, 0x000000001bcf2626ULL, 0x0000000000000000ULL },
+		{ 0x9061e022df9311baULL, 0xddc88fc57440acb0ULL, 0x00000000f43dadadULL, 0x0000000000000000ULL }, { 0x4c67834dda63a822ULL, 0x1b2c997e50053ac0ULL, 0x000000005a98d4d4ULL, 0x0000000000000000ULL },
+		{ 0x6275b75dc189a0cdULL, 0x73aafb78acc3ff8dULL, 0x0000000037c4a6a6ULL, 0x0000000000000000ULL }, { 0xbe73d432c4791955ULL, 0xb54eedc3888669fdULL, 0x000000009961dfdfULL, 0x0000000000000000ULL },
+		{ 0xc7797183cb74cfe0ULL, 0xe27fd713e449ce6dULL, 0x0000000076935454ULL, 0x0000000000000000ULL }, { 0x1b7f12ecce847678ULL, 0x249bc1a8c00c581dULL, 0x00000000d8362d2dULL, 0x0000000000000000ULL },
+		{ 0xda3d671dad068056ULL, 0xce886e607bfccca4ULL, 0x000000009ea97373ULL, 0x0000000000000000ULL }, { 0x063b0472a8f639ceULL, 0x086c78db5fb95ad4ULL, 0x00000000300c0a0aULL, 0x0000000000000000ULL },
+		{ 0x7f31a1c3a7fbef7bULL, 0x5f5d420b3376fd44ULL, 0x00000000dffe8181ULL, 0x0000000000000000ULL }, { 0xa337c2aca20b56e3ULL, 0x99b954b017336b34ULL, 0x00000000715bf8f8ULL, 0x0000000000000000ULL },
+		{ 0x8d25f6bcb9e15e0cULL, 0xf13f36b6ebf5ae79ULL, 0x000000001c078a8aULL, 0x0000000000000000ULL }, { 0x512395d3bc11e794ULL, 0x37db200dcfb03809ULL, 0x00000000b2a2f3f3ULL, 0x0000000000000000ULL },
+		{ 0x28293062b31c3121ULL, 0x60ea1adda37f9f99ULL, 0x000000005d507878ULL, 0x0000000000000000ULL }, { 0xf42f530db6ec88b9ULL, 0xa60e0c66873a09e9ULL, 0x00000000f3f50101ULL, 0x0000000000000000ULL },
+		{ 0x740d584285d521e2ULL, 0xb0fbded146ee0803ULL, 0x0000000087e89c9cULL, 0x0000000000000000ULL }, { 0xa80b3b2d8025987aULL, 0x761fc86a62ab9e73ULL, 0x00000000294de5e5ULL, 0x0000000000000000ULL },
+		{ 0xd1019e9c8f284ecfULL, 0x212ef2ba0e6439e3ULL, 0x00000000c6bf6e6eULL, 0x0000000000000000ULL }, { 0x0d07fdf38ad8f757ULL, 0xe7cae4012a21af93ULL, 0x00000000681a1717ULL, 0x0000000000000000ULL },
+		{ 0x2315c9e39132ffb8ULL, 0x8f4c8607d6e76adeULL, 0x0000000005466565ULL, 0x0000000000000000ULL }, { 0xff13aa8c94c24620ULL, 0x49a890bcf2a2fcaeULL, 0x00000000abe31c1cULL, 0x0000000000000000ULL },
+		{ 0x86190f3d9bcf9095ULL, 0x1e99aa6c9e6d5b3eULL, 0x0000000044119797ULL, 0x0000000000000000ULL }, { 0x5a1f6c529e3f290dULL, 0xd87dbcd7ba28cd4eULL, 0x00000000eab4eeeeULL, 0x0000000000000000ULL },
+		{ 0x3227d799bab1c28fULL, 0xb363cfdff73ddca2ULL, 0x000000008d645656ULL, 0x0000000000000000ULL }, { 0xee21b4f6bf417b17ULL, 0x7587d964d3784ad2ULL, 0x0000000023c12f2fULL, 0x0000000000000000ULL },
+		{ 0x972b1147b04cada2ULL, 0x22b6e3b4bfb7ed42ULL, 0x00000000cc33a4a4ULL, 0x0000000000000000ULL }, { 0x4b2d7228b5bc143aULL, 0xe452f50f9bf27b32ULL, 0x000000006296ddddULL, 0x0000000000000000ULL },
+		{ 0x653f4638ae561cd5ULL, 0x8cd497096734be7fULL, 0x000000000fcaafafULL, 0x0000000000000000ULL }, { 0xb9392557aba6a54dULL, 0x4a3081b24371280fULL, 0x00000000a16fd6d6ULL, 0x0000000000000000ULL },
+		{ 0xc03380e6a4ab73f8ULL, 0x1d01bb622fbe8f9fULL, 0x000000004e9d5d5dULL, 0x0000000000000000ULL }, { 0x1c35e389a15bca60ULL, 0xdbe5add90bfb19efULL, 0x00000000e0382424ULL, 0x0000000000000000ULL },
+		{ 0x9c17e8c69262633bULL, 0xcd107f6eca2f1805ULL, 0x000000009425b9b9ULL, 0x0000000000000000ULL }, { 0x40118ba99792daa3ULL, 0x0bf469d5ee6a8e75ULL, 0x000000003a80c0c0ULL, 0x0000000000000000ULL },
+		{ 0x391b2e18989f0c16ULL, 0x5cc5530582a529e5ULL, 0x00000000d5724b4bULL, 0x0000000000000000ULL }, { 0xe51d4d779d6fb58eULL, 0x9a2145bea6e0bf95ULL, 0x000000007bd73232ULL, 0x0000000000000000ULL },
+		{ 0xcb0f79678685bd61ULL, 0xf2a727b85a267ad8ULL, 0x00000000168b4040ULL, 0x0000000000000000ULL }, { 0x17091a08837504f9ULL, 0x344331037e63eca8ULL, 0x00000000b82e3939ULL, 0x0000000000000000ULL },
+		{ 0x6e03bfb98c78d24cULL, 0x63720bd312ac4b38ULL, 0x0000000057dcb2b2ULL, 0x0000000000000000ULL }, { 0xb205dcd689886bd4ULL, 0xa5961d6836e9dd48ULL, 0x00000000f979cbcbULL, 0x0000000000000000ULL },
+		{ 0x7347a927ea0a9dfaULL, 0x4f85b2a08d1949f1ULL, 0x00000000bfe69595ULL, 0x0000000000000000ULL }, { 0xaf41ca48effa2462ULL, 0x8961a41ba95cdf81ULL, 0x000000001143ececULL, 0x0000000000000000ULL },
+		{ 0xd64b6ff9e0f7f2d7ULL, 0xde509ecbc5937811ULL, 0x00000000feb16767ULL, 0x0000000000000000ULL }, { 0x0a4d0c96e5074b4fULL, 0x18b48870e1d6ee61ULL, 0x0000000050141e1eULL, 0x0000000000000000ULL },
+		{ 0x245f3886feed43a0ULL, 0x7032ea761d102b2cULL, 0x000000003d486c6cULL, 0x0000000000000000ULL }, { 0xf8595be9fb1dfa38ULL, 0xb6d6fccd3955bd5cULL, 0x0000000093ed1515ULL, 0x0000000000000000ULL },
+		{ 0x8153fe58f4102c8dULL, 0xe1e7c61d559a1accULL, 0x000000007c1f9e9eULL, 0x0000000000000000ULL }, { 0x5d559d37f1e09515ULL, 0x2703d0a671df8cbcULL, 0x00000000d2bae7e7ULL, 0x0000000000000000ULL },
+		{ 0xdd779678c2d93c4eULL, 0x31f60211b00b8d56ULL, 0x00000000a6a77a7aULL, 0x0000000000000000ULL }, { 0x0171f517c72985d6ULL, 0xf71214aa944e1b26ULL, 0x0000000008020303ULL, 0x0000000000000000ULL },
+		{ 0x787b50a6c8245363ULL, 0xa0232e7af881bcb6ULL, 0x00000000e7f08888ULL, 0x0000000000000000ULL }, { 0xa47d33c9cdd4eafbULL, 0x66c738c1dcc42ac6ULL, 0x000000004955f1f1ULL, 0x0000000000000000ULL },
+		{ 0x8a6f07d9d63ee214ULL, 0x0e415ac72002ef8bULL, 0x0000000024098383ULL, 0x0000000000000000ULL }, { 0x566964b6d3ce5b8cULL, 0xc8a54c7c044779fbULL, 0x000000008aacfafaULL, 0x0000000000000000ULL },
+		{ 0x2f63c107dcc38d39ULL, 0x9f9476ac6888de6bULL, 0x00000000655e7171ULL, 0x0000000000000000ULL }, { 0xf365a268d93334a1ULL, 0x597060174ccd481bULL, 0x00000000cbfb0808ULL, 0x0000000000000000ULL },
+		{ 0xb0e72bf81ada7c65ULL, 0x56b235210375eb04ULL, 0x00000000e97dcdcdULL, 0x0000000000000000ULL }, { 0x6ce148971f2ac5fdULL, 0x9056239a27307d74ULL, 0x0000000047d8b4b4ULL, 0x0000000000000000ULL },
+		{ 0x15ebed2610271348ULL, 0xc767194a4bffdae4ULL, 0x00000000a82a3f3fULL, 0x0000000000000000ULL }, { 0xc9ed8e4915d7aad0ULL, 0x01830ff16fba4c94ULL, 0x00000000068f4646ULL, 0x0000000000000000ULL },
+		{ 0xe7ffba590e3da23fULL, 0x69056df7937c89d9ULL, 0x000000006bd33434ULL, 0x0000000000000000ULL }, { 0x3bf9d9360bcd1ba7ULL, 0xafe17b4cb7391fa9ULL, 0x00000000c5764d4dULL, 0x0000000000000000ULL },
+		{ 0x42f37c8704c0cd12ULL, 0xf8d0419cdbf6b839ULL, 0x000000002a84c6c6ULL, 0x0000000000000000ULL }, { 0x9ef51fe80130748aULL, 0x3e345727ffb32e49ULL, 0x000000008421bfbfULL, 0x0000000000000000ULL },
+		{ 0x1ed714a73209ddd1ULL, 0x28c185903e672fa3ULL, 0x00000000f03c2222ULL, 0x0000000000000000ULL }, { 0xc2d177c837f96449ULL, 0xee25932b1a22b9d3ULL, 0x000000005e995b5bULL, 0x0000000000000000ULL },
+		{ 0xbbdbd27938f4b2fcULL, 0xb914a9fb76ed1e43ULL, 0x00000000b16bd0d0ULL, 0x0000000000000000ULL }, { 0x67ddb1163d040b64ULL, 0x7ff0bf4052a88833ULL, 0x000000001fcea9a9ULL, 0x0000000000000000ULL },
+		{ 0x49cf850626ee038bULL, 0x1776dd46ae6e4d7eULL, 0x000000007292dbdbULL, 0x0000000000000000ULL }, { 0x95c9e669231eba13ULL, 0xd192cbfd8a2bdb0eULL, 0x00000000dc37a2a2ULL, 0x0000000000000000ULL },
+		{ 0xecc343d82c136ca6ULL, 0x86a3f12de6e47c9eULL, 0x0000000033c52929ULL, 0x0000000000000000ULL }, { 0x30c520b729e3d53eULL, 0x4047e796c2a1eaeeULL, 0x000000009d605050ULL, 0x0000000000000000ULL },
+		{ 0xf18755464a612310ULL, 0xaa54485e79517e57ULL, 0x00000000dbff0e0eULL, 0x0000000000000000ULL }, { 0x2d8136294f919a88ULL, 0x6cb05ee55d14e827ULL, 0x00000000755a7777ULL, 0x0000000000000000ULL },
+		{ 0x548b9398409c4c3dULL, 0x3b81643531db4fb7ULL, 0x000000009aa8fcfcULL, 0x0000000000000000ULL }, { 0x888df0f7456cf5a5ULL, 0xfd65728e159ed9c7ULL, 0x00000000340d8585ULL, 0x0000000000000000ULL },
+		{ 0xa69fc4e75e86fd4aULL, 0x95e31088e9581c8aULL, 0x000000005951f7f7ULL, 0x0000000000000000ULL }, { 0x7a99a7885b7644d2ULL, 0x53070633cd1d8afaULL, 0x00000000f7f48e8eULL, 0x0000000000000000ULL },
+		{ 0x03930239547b9267ULL, 0x04363ce3a1d22d6aULL, 0x0000000018060505ULL, 0x0000000000000000ULL }, { 0xdf956156518b2bffULL, 0xc2d22a588597bb1aULL, 0x00000000b6a37c7cULL, 0x0000000000000000ULL },
+		{ 0x5fb76a1962b282a4ULL, 0xd427f8ef4443baf0ULL, 0x00000000c2bee1e1ULL, 0x0000000000000000ULL }, { 0x83b1097667423b3cULL, 0x12c3ee5460062c80ULL, 0x000000006c1b9898ULL, 0x0000000000000000ULL },
+		{ 0xfabbacc7684fed89ULL, 0x45f2d4840cc98b10ULL, 0x0000000083e91313ULL, 0x0000000000000000ULL }, { 0x26bdcfa86dbf5411ULL, 0x8316c23f288c1d60ULL, 0x000000002d4c6a6aULL, 0x0000000000000000ULL },
+		{ 0x08affbb876555cfeULL, 0xeb90a039d44ad82dULL, 0x0000000040101818ULL, 0x0000000000000000ULL }, { 0xd4a998d773a5e566ULL, 0x2d74b682f00f4e5dULL, 0x00000000eeb56161ULL, 0x0000000000000000ULL },
+		{ 0xada33d667ca833d3ULL, 0x7a458c529cc0e9cdULL, 0x000000000147eaeaULL, 0x0000000000000000ULL }, { 0x71a55e0979588a4bULL, 0xbca19ae9b8857fbdULL, 0x00000000afe29393ULL, 0x0000000000000000ULL },
+		{ 0x2bba325be767a346ULL, 0x64dc263e02adb2f3ULL, 0x0000000045567d7dULL, 0x0000000000000000ULL }, { 0xf7bc5134e2971adeULL, 0xa238308526e82483ULL, 0x00000000ebf30404ULL, 0x0000000000000000ULL },
+		{ 0x8eb6f485ed9acc6bULL, 0xf5090a554a278313ULL, 0x0000000004018f8fULL, 0x0000000000000000ULL }, { 0x52b097eae86a75f3ULL, 0x33ed1cee6e621563ULL, 0x00000000aaa4f6f6ULL, 0x0000000000000000ULL },
+		{ 0x7ca2a3faf3807d1cULL, 0x5b6b7ee892a4d02eULL, 0x00000000c7f88484ULL, 0x0000000000000000ULL }, { 0xa0a4c095f670c484ULL, 0x9d8f6853b6e1465eULL, 0x00000000695dfdfdULL, 0x0000000000000000ULL },
+		{ 0xd9ae6524f97d1231ULL, 0xcabe5283da2ee1ceULL, 0x0000000086af7676ULL, 0x0000000000000000ULL }, { 0x05a8064bfc8daba9ULL, 0x0c5a4438fe6b77beULL, 0x00000000280a0f0fULL, 0x0000000000000000ULL },
+		{ 0x858a0d04cfb402f2ULL, 0x1aaf968f3fbf7654ULL, 0x000000005c179292ULL, 0x0000000000000000ULL }, { 0x598c6e6bca44bb6aULL, 0xdc4b80341bfae024ULL, 0x00000000f2b2ebebULL, 0x0000000000000000ULL },
+		{ 0x2086cbdac5496ddfULL, 0x8b7abae4773547b4ULL, 0x000000001d406060ULL, 0x0000000000000000ULL }, { 0xfc80a8b5c0b9d447ULL, 0x4d9eac5f5370d1c4ULL, 0x00000000b3e51919ULL, 0x0000000000000000ULL },
+		{ 0xd2929ca5db53dca8ULL, 0x2518ce59afb61489ULL, 0x00000000deb96b6bULL, 0x0000000000000000ULL }, { 0x0e94ffcadea36530ULL, 0xe3fcd8e28bf382f9ULL, 0x00000000701c1212ULL, 0x0000000000000000ULL },
+		{ 0x779e5a7bd1aeb385ULL, 0xb4cde232e73c2569ULL, 0x000000009fee9999ULL, 0x0000000000000000ULL }, { 0xab983914d45e0a1dULL, 0x7229f489c379b319ULL, 0x00000000314be0e0ULL, 0x0000000000000000ULL },
+		{ 0x6ada4ce5b7dcfc33ULL, 0x983a5b41788927a0ULL, 0x0000000077d4bebeULL, 0x0000000000000000ULL }, { 0xb6dc2f8ab22c45abULL, 0x5ede4dfa5cccb1d0ULL, 0x00000000d971c7c7ULL, 0x0000000000000000ULL },
+		{ 0xcfd68a3bbd21931eULL, 0x09ef772a30031640ULL, 0x0000000036834c4cULL, 0x0000000000000000ULL }, { 0x13d0e954b8d12a86ULL, 0xcf0b619114468030ULL, 0x0000000098263535ULL, 0x0000000000000000ULL },
+		{ 0x3dc2dd44a33b2269ULL, 0xa78d0397e880457dULL, 0x00000000f57a4747ULL, 0x0000000000000000ULL }, { 0xe1c4be2ba6cb9bf1ULL, 0x6169152cccc5d30dULL, 0x000000005bdf3e3eULL, 0x0000000000000000ULL },
+		{ 0x98ce1b9aa9c64d44ULL, 0x36582ffca00a749dULL, 0x00000000b42db5b5ULL, 0x0000000000000000ULL }, { 0x44c878f5ac36f4dcULL, 0xf0bc3947844fe2edULL, 0x000000001a88ccccULL, 0x0000000000000000ULL },
+		{ 0xc4ea73ba9f0f5d87ULL, 0xe649ebf0459be307ULL, 0x000000006e955151ULL, 0x0000000000000000ULL }, { 0x18ec10d59affe41fULL, 0x20adfd4b61de7577ULL, 0x00000000c0302828ULL, 0x0000000000000000ULL },
+		{ 0x61e6b56495f232aaULL, 0x779cc79b0d11d2e7ULL, 0x000000002fc2a3a3ULL, 0x0000000000000000ULL }, { 0xbde0d60b90028b32ULL, 0xb178d12029544497ULL, 0x000000008167dadaULL, 0x0000000000000000ULL },
+		{ 0x93f2e21b8be883ddULL, 0xd9feb326d59281daULL, 0x00000000ec3ba8a8ULL, 0x0000000000000000ULL }, { 0x4ff481748e183a45ULL, 0x1f1aa59df1d717aaULL, 0x00000000429ed1d1ULL, 0x0000000000000000ULL },
+		{ 0x36fe24c58115ecf0ULL, 0x482b9f4d9d18b03aULL, 0x00000000ad6c5a5aULL, 0x0000000000000000ULL }, { 0xeaf847aa84e55568ULL, 0x8ecf89f6b95d264aULL, 0x0000000003c92323ULL, 0x0000000000000000ULL },
+		{ 0xa97ace3a470c1dacULL, 0x810ddcc0f6e58555ULL, 0x00000000214fe6e6ULL, 0x0000000000000000ULL }, { 0x757cad5542fca434ULL, 0x47e9ca7bd2a01325ULL, 0x000000008fea9f9fULL, 0x0000000000000000ULL },
+		{ 0x0c7608e44df17281ULL, 0x10d8f0abbe6fb4b5ULL, 0x0000000060181414ULL, 0x0000000000000000ULL }, { 0xd0706b8b4801cb19ULL, 0xd63ce6109a2a22c5ULL, 0x00000000cebd6d6dULL, 0x0000000000000000ULL },
+		{ 0xfe625f9b53ebc3f6ULL, 0xbeba841666ece788ULL, 0x00000000a3e11f1fULL, 0x0000000000000000ULL }, { 0x22643cf4561b7a6eULL, 0x785e92ad42a971f8ULL, 0x000000000d446666ULL, 0x0000000000000000ULL },
+		{ 0x5b6e99455916acdbULL, 0x2f6fa87d2e66d668ULL, 0x00000000e2b6ededULL, 0x0000000000000000ULL }, { 0x8768fa2a5ce61543ULL, 0xe98bbec60a234018ULL, 0x000000004c139494ULL, 0x0000000000000000ULL },
+		{ 0x074af1656fdfbc18ULL, 0xff7e6c71cbf741f2ULL, 0x00000000380e0909ULL, 0x0000000000000000ULL }, { 0xdb4c920a6a2f0580ULL, 0x399a7acaefb2d782ULL, 0x0000000096ab7070ULL, 0x0000000000000000ULL },
+		{ 0xa24637bb6522d335ULL, 0x6eab401a837d7012ULL, 0x000000007959fbfbULL, 0x0000000000000000ULL }, { 0x7e4054d460d26aadULL, 0xa84f56a1a738e662ULL, 0x00000000d7fc8282ULL, 0x0000000000000000ULL },
+		{ 0x505260c47b386242ULL, 0xc0c934a75bfe232fULL, 0x00000000baa0f0f0ULL, 0x0000000000000000ULL }, { 0x8c5403ab7ec8dbdaULL, 0x062d221c7fbbb55fULL, 0x0000000014058989ULL, 0x0000000000000000ULL },
+		{ 0xf55ea61a71c50d6fULL, 0x511c18cc137412cfULL, 0x00000000fbf70202ULL, 0x0000000000000000ULL }, { 0x2958c5757435b4f7ULL, 0x97f80e77373184bfULL, 0x0000000055527b7bULL, 0x0000000000000000ULL },
+		{ 0xe81ab08417b742d9ULL, 0x7deba1bf8cc11006ULL, 0x0000000013cd2525ULL, 0x0000000000000000ULL }, { 0x341cd3eb1247fb41ULL, 0xbb0fb704a8848676ULL, 0x00000000bd685c5cULL, 0x0000000000000000ULL },
+		{ 0x4d16765a1d4a2df4ULL, 0xec3e8dd4c44b21e6ULL, 0x00000000529ad7d7ULL, 0x0000000000000000ULL }, { 0x9110153518ba946cULL, 0x2ada9b6fe00eb796ULL, 0x00000000fc3faeaeULL, 0x0000000000000000ULL },
+		{ 0xbf02212503509c83ULL, 0x425cf9691cc872dbULL, 0x000000009163dcdcULL, 0x0000000000000000ULL }, { 0x6304424a06a0251bULL, 0x84b8efd2388de4abULL, 0x000000003fc6a5a5ULL, 0x0000000000000000ULL },
+		{ 0x1a0ee7fb09adf3aeULL, 0xd389d5025442433bULL, 0x00000000d0342e2eULL, 0x0000000000000000ULL }, { 0xc60884940c5d4a36ULL, 0x156dc3b97007d54bULL, 0x000000007e915757ULL, 0x0000000000000000ULL },
+		{ 0x462a8fdb3f64e36dULL, 0x0398110eb1d3d4a1ULL, 0x000000000a8ccacaULL, 0x0000000000000000ULL }, { 0x9a2cecb43a945af5ULL, 0xc57c07b5959642d1ULL, 0x00000000a429b3b3ULL, 0x0000000000000000ULL },
+		{ 0xe326490535998c40ULL, 0x924d3d65f959e541ULL, 0x000000004bdb3838ULL, 0x0000000000000000ULL }, { 0x3f202a6a306935d8ULL, 0x54a92bdedd1c7331ULL, 0x00000000e57e4141ULL, 0x0000000000000000ULL },
+		{ 0x11321e7a2b833d37ULL, 0x3c2f49d821dab67cULL, 0x0000000088223333ULL, 0x0000000000000000ULL }, { 0xcd347d152e7384afULL, 0xfacb5f63059f200cULL, 0x0000000026874a4aULL, 0x0000000000000000ULL },
+		{ 0xb43ed8a4217e521aULL, 0xadfa65b36950879cULL, 0x00000000c975c1c1ULL, 0x0000000000000000ULL }, { 0x6838bbcb248eeb82ULL, 0x6b1e73084d1511ecULL, 0x0000000067d0b8b8ULL, 0x0000000000000000ULL },
+	},
+	{ // 22
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0xbd13f4b6b083b359ULL, 0xfd437b1d891c2845ULL, 0x0000f5911ae6da56ULL, 0x0000000000000000ULL },
+		{ 0x6726f5717d1b7bb2ULL, 0xe786f63a0f38508aULL, 0x0000f73f34d1a9acULL, 0x0000000000000000ULL }, { 0xda3501c7cd98c8ebULL, 0x1ac58d27862478cfULL, 0x000002ae2e3773faULL, 0x0000000000000000ULL },
+		{ 0xce4cf7e2fa36f679ULL, 0xd311f1741e70a009ULL, 0x0000f37e68bf4f45ULL, 0x0000000000000000ULL }, { 0x735f03544ab54520ULL, 0x2e528a69976c884cULL, 0x000006ef72599513ULL, 0x0000000000000000ULL },
+		{ 0xa96a0293872d8dcbULL, 0x3497074e1148f083ULL, 0x000004415c6ee6e9ULL, 0x0000000000000000ULL }, { 0x1479f62537ae3e92ULL, 0xc9d47c539854d8c6ULL, 0x0000f1d046883cbfULL, 0x0000000000000000ULL },
+		{ 0x8198f3d9e96cf1f2ULL, 0xbb22ffe83ce05d12ULL, 0x0000fbfcd0639e8aULL, 0x0000000000000000ULL }, { 0x3c8b076f59ef42abULL, 0x466184f5b5fc7557ULL, 0x00000e6dca8544dcULL, 0x0000000000000000ULL },
+		{ 0xe6be06a894778a40ULL, 0x5ca409d233d80d98ULL, 0x00000cc3e4b23726ULL, 0x0000000000000000ULL }, { 0x5badf21e24f43919ULL, 0xa1e772cfbac425ddULL, 0x0000f952fe54ed70ULL, 0x0000000000000000ULL },
+		{ 0x4fd4043b135a078bULL, 0x68330e9c2290fd1bULL, 0x00000882b8dcd1cfULL, 0x0000000000000000ULL }, { 0xf2c7f08da3d9b4d2ULL, 0x95707581ab8cd55eULL, 0x0000fd13a23a0b99ULL, 0x0000000000000000ULL },
+		{ 0x28f2f14a6e417c39ULL, 0x8fb5f8a62da8ad91ULL, 0x0000ffbd8c0d7863ULL, 0x0000000000000000ULL }, { 0x95e105fcdec2cf60ULL, 0x72f683bba4b485d4ULL, 0x00000a2c96eba235ULL, 0x0000000000000000ULL },
+		{ 0x1f2dfbafcfd8fff9ULL, 0x6b44e3cd78ddba24ULL, 0x0000ebe5bdc62109ULL, 0x0000000000000000ULL }, { 0xa23e0f197f5b4ca0ULL, 0x960798d0f1c19261ULL, 0x00001e74a720fb5fULL, 0x0000000000000000ULL },
+		{ 0x780b0edeb2c3844bULL, 0x8cc215f777e5eaaeULL, 0x00001cda891788a5ULL, 0x0000000000000000ULL }, { 0xc518fa6802403712ULL, 0x71816eeafef9c2ebULL, 0x0000e94b93f152f3ULL, 0x0000000000000000ULL },
+		{ 0xd1610c4d35ee0980ULL, 0xb85512b966ad1a2dULL, 0x0000189bd5796e4cULL, 0x0000000000000000ULL }, { 0x6c72f8fb856dbad9ULL, 0x451669a4efb13268ULL, 0x0000ed0acf9fb41aULL, 0x0000000000000000ULL },
+		{ 0xb647f93c48f57232ULL, 0x5fd3e48369954aa7ULL, 0x0000efa4e1a8c7e0ULL, 0x0000000000000000ULL }, { 0x0b540d8af876c16bULL, 0xa2909f9ee08962e2ULL, 0x00001a35fb4e1db6ULL, 0x0000000000000000ULL },
+		{ 0x9eb5087626b40e0bULL, 0xd0661c25443de736ULL, 0x000010196da5bf83ULL, 0x0000000000000000ULL }, { 0x23a6fcc09637bd52ULL, 0x2d256738cd21cf73ULL, 0x0000e588774365d5ULL, 0x0000000000000000ULL },
+		{ 0xf993fd075baf75b9ULL, 0x37e0ea1f4b05b7bcULL, 0x0000e7265974162fULL, 0x0000000000000000ULL }, { 0x448009b1eb2cc6e0ULL, 0xcaa39102c2199ff9ULL, 0x000012b74392cc79ULL, 0x0000000000000000ULL },
+		{ 0x50f9ff94dc82f872ULL, 0x0377ed515a4d473fULL, 0x0000e367051af0c6ULL, 0x0000000000000000ULL }, { 0xedea0b226c014b2bULL, 0xfe34964cd3516f7aULL, 0x000016f61ffc2a90ULL, 0x0000000000000000ULL },
+		{ 0x37df0ae5a19983c0ULL, 0xe4f11b6b557517b5ULL, 0x0000145831cb596aULL, 0x0000000000000000ULL }, { 0x8accfe53111a3099ULL, 0x19b26076dc693ff0ULL, 0x0000e1c92b2d833cULL, 0x0000000000000000ULL },
+		{ 0x3e5aeb4383ade3efULL, 0xd688db87f0a76948ULL, 0x0000cbd767914212ULL, 0x0000000000000000ULL }, { 0x83491ff5332e50b6ULL, 0x2bcba09a79bb410dULL, 0x00003e467d779844ULL, 0x0000000000000000ULL },
+		{ 0x597c1e32feb6985dULL, 0x310e2dbdff9f39c2ULL, 0x00003ce85340ebbeULL, 0x0000000000000000ULL }, { 0xe46fea844e352b04ULL, 0xcc4d56a076831187ULL, 0x0000c97949a631e8ULL, 0x0000000000000000ULL },
+		{ 0xf0161ca1799b1596ULL, 0x05992af3eed7c941ULL, 0x000038a90f2e0d57ULL, 0x0000000000000000ULL }, { 0x4d05e817c918a6cfULL, 0xf8da51ee67cbe104ULL, 0x0000cd3815c8d701ULL, 0x0000000000000000ULL },
+		{ 0x9730e9d004806e24ULL, 0xe21fdcc9e1ef99cbULL, 0x0000cf963bffa4fbULL, 0x0000000000000000ULL }, { 0x2a231d66b403dd7dULL, 0x1f5ca7d468f3b18eULL, 0x00003a0721197eadULL, 0x0000000000000000ULL },
+		{ 0xbfc2189a6ac1121dULL, 0x6daa246fcc47345aULL, 0x0000302bb7f2dc98ULL, 0x0000000000000000ULL }, { 0x02d1ec2cda42a144ULL, 0x90e95f72455b1c1fULL, 0x0000c5baad1406ceULL, 0x0000000000000000ULL },
+		{ 0xd8e4edeb17da69afULL, 0x8a2cd255c37f64d0ULL, 0x0000c71483237534ULL, 0x0000000000000000ULL }, { 0x65f7195da759daf6ULL, 0x776fa9484a634c95ULL, 0x0000328599c5af62ULL, 0x0000000000000000ULL },
+		{ 0x718eef7890f7e464ULL, 0xbebbd51bd2379453ULL, 0x0000c355df4d93ddULL, 0x0000000000000000ULL }, { 0xcc9d1bce2074573dULL, 0x43f8ae065b2bbc16ULL, 0x000036c4c5ab498bULL, 0x0000000000000000ULL },
+		{ 0x16a81a09edec9fd6ULL, 0x593d2321dd0fc4d9ULL, 0x0000346aeb9c3a71ULL, 0x0000000000000000ULL }, { 0xabbbeebf5d6f2c8fULL, 0xa47e583c5413ec9cULL, 0x0000c1fbf17ae027ULL, 0x0000000000000000ULL },
+		{ 0x217710ec4c751c16ULL, 0xbdcc384a887ad36cULL, 0x00002032da57631bULL, 0x0000000000000000ULL }, { 0x9c64e45afcf6af4fULL, 0x408f43570166fb29ULL, 0x0000d5a3c0b1b94dULL, 0x0000000000000000ULL },
+		{ 0x4651e59d316e67a4ULL, 0x5a4ace70874283e6ULL, 0x0000d70dee86cab7ULL, 0x0000000000000000ULL }, { 0xfb42112b81edd4fdULL, 0xa709b56d0e5eaba3ULL, 0x0000229cf46010e1ULL, 0x0000000000000000ULL },
+		{ 0xef3be70eb643ea6fULL, 0x6eddc93e960a7365ULL, 0x0000d34cb2e82c5eULL, 0x0000000000000000ULL }, { 0x522813b806c05936ULL, 0x939eb2231f165b20ULL, 0x000026dda80ef608ULL, 0x0000000000000000ULL },
+		{ 0x881d127fcb5891ddULL, 0x895b3f04993223efULL, 0x00002473863985f2ULL, 0x0000000000000000ULL }, { 0x350ee6c97bdb2284ULL, 0x74184419102e0baaULL, 0x0000d1e29cdf5fa4ULL, 0x0000000000000000ULL },
+		{ 0xa0efe335a519ede4ULL, 0x06eec7a2b49a8e7eULL, 0x0000dbce0a34fd91ULL, 0x0000000000000000ULL }, { 0x1dfc1783159a5ebdULL, 0xfbadbcbf3d86a63bULL, 0x00002e5f10d227c7ULL, 0x0000000000000000ULL },
+		{ 0xc7c91644d8029656ULL, 0xe1683198bba2def4ULL, 0x00002cf13ee5543dULL, 0x0000000000000000ULL }, { 0x7adae2f26881250fULL, 0x1c2b4a8532bef6b1ULL, 0x0000d96024038e6bULL, 0x0000000000000000ULL },
+		{ 0x6ea314d75f2f1b9dULL, 0xd5ff36d6aaea2e77ULL, 0x000028b0628bb2d4ULL, 0x0000000000000000ULL }, { 0xd3b0e061efaca8c4ULL, 0x28bc4dcb23f60632ULL, 0x0000dd21786d6882ULL, 0x0000000000000000ULL },
+		{ 0x0985e1a62234602fULL, 0x3279c0eca5d27efdULL, 0x0000df8f565a1b78ULL, 0x0000000000000000ULL }, { 0xb496151092b7d376ULL, 0xcf3abbf12cce56b8ULL, 0x00002a1e4cbcc12eULL, 0x0000000000000000ULL },
+		{ 0x7cb4cb861b47dbc3ULL, 0xb10dab13fd53d290ULL, 0x00008bb3ce3f8424ULL, 0x0000000000000000ULL }, { 0xc1a73f30abc4689aULL, 0x4c4ed00e744ffad5ULL, 0x00007e22d4d95e72ULL, 0x0000000000000000ULL },
+		{ 0x1b923ef7665ca071ULL, 0x568b5d29f26b821aULL, 0x00007c8cfaee2d88ULL, 0x0000000000000000ULL }, { 0xa681ca41d6df1328ULL, 0xabc826347b77aa5fULL, 0x0000891de008f7deULL, 0x0000000000000000ULL },
+		{ 0xb2f83c64e1712dbaULL, 0x621c5a67e3237299ULL, 0x000078cda680cb61ULL, 0x0000000000000000ULL }, { 0x0febc8d251f29ee3ULL, 0x9f5f217a6a3f5adcULL, 0x00008d5cbc661137ULL, 0x0000000000000000ULL },
+		{ 0xd5dec9159c6a5608ULL, 0x859aac5dec1b2213ULL, 0x00008ff2925162cdULL, 0x0000000000000000ULL }, { 0x68cd3da32ce9e551ULL, 0x78d9d74065070a56ULL, 0x00007a6388b7b89bULL, 0x0000000000000000ULL },
+		{ 0xfd2c385ff22b2a31ULL, 0x0a2f54fbc1b38f82ULL, 0x0000704f1e5c1aaeULL, 0x0000000000000000ULL }, { 0x403fcce942a89968ULL, 0xf76c2fe648afa7c7ULL, 0x000085de04bac0f8ULL, 0x0000000000000000ULL },
+		{ 0x9a0acd2e8f305183ULL, 0xeda9a2c1ce8bdf08ULL, 0x000087702a8db302ULL, 0x0000000000000000ULL }, { 0x271939983fb3e2daULL, 0x10ead9dc4797f74dULL, 0x000072e1306b6954ULL, 0x0000000000000000ULL },
+		{ 0x3360cfbd081ddc48ULL, 0xd93ea58fdfc32f8bULL, 0x0000833176e355ebULL, 0x0000000000000000ULL }, { 0x8e733b0bb89e6f11ULL, 0x247dde9256df07ceULL, 0x000076a06c058fbdULL, 0x0000000000000000ULL },
+		{ 0x54463acc7506a7faULL, 0x3eb853b5d0fb7f01ULL, 0x0000740e4232fc47ULL, 0x0000000000000000ULL }, { 0xe955ce7ac58514a3ULL, 0xc3fb28a859e75744ULL, 0x0000819f58d42611ULL, 0x0000000000000000ULL },
+		{ 0x63993029d49f243aULL, 0xda4948de858e68b4ULL, 0x0000605673f9a52dULL, 0x0000000000000000ULL }, { 0xde8ac49f641c9763ULL, 0x270a33c30c9240f1ULL, 0x000095c7691f7f7bULL, 0x0000000000000000ULL },
+		{ 0x04bfc558a9845f88ULL, 0x3dcfbee48ab6383eULL, 0x0000976947280c81ULL, 0x0000000000000000ULL }, { 0xb9ac31ee1907ecd1ULL, 0xc08cc5f903aa107bULL, 0x000062f85dced6d7ULL, 0x0000000000000000ULL },
+		{ 0xadd5c7cb2ea9d243ULL, 0x0958b9aa9bfec8bdULL, 0x000093281b46ea68ULL, 0x0000000000000000ULL }, { 0x10c6337d9e2a611aULL, 0xf41bc2b712e2e0f8ULL, 0x000066b901a0303eULL, 0x0000000000000000ULL },
+		{ 0xcaf332ba53b2a9f1ULL, 0xeede4f9094c69837ULL, 0x000064172f9743c4ULL, 0x0000000000000000ULL }, { 0x77e0c60ce3311aa8ULL, 0x139d348d1ddab072ULL, 0x0000918635719992ULL, 0x0000000000000000ULL },
+		{ 0xe201c3f03df3d5c8ULL, 0x616bb736b96e35a6ULL, 0x00009baaa39a3ba7ULL, 0x0000000000000000ULL }, { 0x5f1237468d706691ULL, 0x9c28cc2b30721de3ULL, 0x00006e3bb97ce1f1ULL, 0x0000000000000000ULL },
+		{ 0x8527368140e8ae7aULL, 0x86ed410cb656652cULL, 0x00006c95974b920bULL, 0x0000000000000000ULL }, { 0x3834c237f06b1d23ULL, 0x7bae3a113f4a4d69ULL, 0x000099048dad485dULL, 0x0000000000000000ULL },
+		{ 0x2c4d3412c7c523b1ULL, 0xb27a4642a71e95afULL, 0x000068d4cb2574e2ULL, 0x0000000000000000ULL }, { 0x915ec0a4774690e8ULL, 0x4f393d5f2e02bdeaULL, 0x00009d45d1c3aeb4ULL, 0x0000000000000000ULL },
+		{ 0x4b6bc163bade5803ULL, 0x55fcb078a826c525ULL, 0x00009febfff4dd4eULL, 0x0000000000000000ULL }, { 0xf67835d50a5deb5aULL, 0xa8bfcb65213aed60ULL, 0x00006a7ae5120718ULL, 0x0000000000000000ULL },
+		{ 0x42ee20c598ea382cULL, 0x678570940df4bbd8ULL, 0x00004064a9aec636ULL, 0x0000000000000000ULL }, { 0xfffdd47328698b75ULL, 0x9ac60b8984e8939dULL, 0x0000b5f5b3481c60ULL, 0x0000000000000000ULL },
+		{ 0x25c8d5b4e5f1439eULL, 0x800386ae02cceb52ULL, 0x0000b75b9d7f6f9aULL, 0x0000000000000000ULL }, { 0x98db21025572f0c7ULL, 0x7d40fdb38bd0c317ULL, 0x000042ca8799b5ccULL, 0x0000000000000000ULL },
+		{ 0x8ca2d72762dcce55ULL, 0xb49481e013841bd1ULL, 0x0000b31ac1118973ULL, 0x0000000000000000ULL }, { 0x31b12391d25f7d0cULL, 0x49d7fafd9a983394ULL, 0x0000468bdbf75325ULL, 0x0000000000000000ULL },
+		{ 0xeb8422561fc7b5e7ULL, 0x531277da1cbc4b5bULL, 0x00004425f5c020dfULL, 0x0000000000000000ULL }, { 0x5697d6e0af4406beULL, 0xae510cc795a0631eULL, 0x0000b1b4ef26fa89ULL, 0x0000000000000000ULL },
+		{ 0xc376d31c7186c9deULL, 0xdca78f7c3114e6caULL, 0x0000bb9879cd58bcULL, 0x0000000000000000ULL }, { 0x7e6527aac1057a87ULL, 0x21e4f461b808ce8fULL, 0x00004e09632b82eaULL, 0x0000000000000000ULL },
+		{ 0xa450266d0c9db26cULL, 0x3b2179463e2cb640ULL, 0x00004ca74d1cf110ULL, 0x0000000000000000ULL }, { 0x1943d2dbbc1e0135ULL, 0xc662025bb7309e05ULL, 0x0000b93657fa2b46ULL, 0x0000000000000000ULL },
+		{ 0x0d3a24fe8bb03fa7ULL, 0x0fb67e082f6446c3ULL, 0x000048e6117217f9ULL, 0x0000000000000000ULL }, { 0xb029d0483b338cfeULL, 0xf2f50515a6786e86ULL, 0x0000bd770b94cdafULL, 0x0000000000000000ULL },
+		{ 0x6a1cd18ff6ab4415ULL, 0xe8308832205c1649ULL, 0x0000bfd925a3be55ULL, 0x0000000000000000ULL }, { 0xd70f25394628f74cULL, 0x1573f32fa9403e0cULL, 0x00004a483f456403ULL, 0x0000000000000000ULL },
+		{ 0x5dc3db6a5732c7d5ULL, 0x0cc19359752901fcULL, 0x0000ab811468e73fULL, 0x0000000000000000ULL }, { 0xe0d02fdce7b1748cULL, 0xf182e844fc3529b9ULL, 0x00005e100e8e3d69ULL, 0x0000000000000000ULL },
+		{ 0x3ae52e1b2a29bc67ULL, 0xeb4765637a115176ULL, 0x00005cbe20b94e93ULL, 0x0000000000000000ULL }, { 0x87f6daad9aaa0f3eULL, 0x16041e7ef30d7933ULL, 0x0000a92f3a5f94c5ULL, 0x0000000000000000ULL },
+		{ 0x938f2c88ad0431acULL, 0xdfd0622d6b59a1f5ULL, 0x000058ff7cd7a87aULL, 0x0000000000000000ULL }, { 0x2e9cd83e1d8782f5ULL, 0x22931930e24589b0ULL, 0x0000ad6e6631722cULL, 0x0000000000000000ULL },
+		{ 0xf4a9d9f9d01f4a1eULL, 0x385694176461f17fULL, 0x0000afc0480601d6ULL, 0x0000000000000000ULL }, { 0x49ba2d4f609cf947ULL, 0xc515ef0aed7dd93aULL, 0x00005a5152e0db80ULL, 0x0000000000000000ULL },
+		{ 0xdc5b28b3be5e3627ULL, 0xb7e36cb149c95ceeULL, 0x0000507dc40b79b5ULL, 0x0000000000000000ULL }, { 0x6148dc050edd857eULL, 0x4aa017acc0d574abULL, 0x0000a5ecdeeda3e3ULL, 0x0000000000000000ULL },
+		{ 0xbb7dddc2c3454d95ULL, 0x50659a8b46f10c64ULL, 0x0000a742f0dad019ULL, 0x0000000000000000ULL }, { 0x066e297473c6feccULL, 0xad26e196cfed2421ULL, 0x000052d3ea3c0a4fULL, 0x0000000000000000ULL },
+		{ 0x1217df514468c05eULL, 0x64f29dc557b9fce7ULL, 0x0000a303acb436f0ULL, 0x0000000000000000ULL }, { 0xaf042be7f4eb7307ULL, 0x99b1e6d8dea5d4a2ULL, 0x00005692b652eca6ULL, 0x0000000000000000ULL },
+		{ 0x75312a203973bbecULL, 0x83746bff5881ac6dULL, 0x0000543c98659f5cULL, 0x0000000000000000ULL }, { 0xc822de9689f008b5ULL, 0x7e3710e2d19d8428ULL, 0x0000a1ad8283450aULL, 0x0000000000000000ULL },
+		{ 0xf8758b11368eab9bULL, 0x7f1a4b26e7a6b93dULL, 0x00000b7b817e1548ULL, 0x0000000000000000ULL }, { 0x45667fa7860d18c2ULL, 0x8259303b6eba9178ULL, 0x0000feea9b98cf1eULL, 0x0000000000000000ULL },
+		{ 0x9f537e604b95d029ULL, 0x989cbd1ce89ee9b7ULL, 0x0000fc44b5afbce4ULL, 0x0000000000000000ULL }, { 0x22408ad6fb166370ULL, 0x65dfc6016182c1f2ULL, 0x000009d5af4966b2ULL, 0x0000000000000000ULL },
+		{ 0x36397cf3ccb85de2ULL, 0xac0bba52f9d61934ULL, 0x0000f805e9c15a0dULL, 0x0000000000000000ULL }, { 0x8b2a88457c3beebbULL, 0x5148c14f70ca3171ULL, 0x00000d94f327805bULL, 0x0000000000000000ULL },
+		{ 0x511f8982b1a32650ULL, 0x4b8d4c68f6ee49beULL, 0x00000f3add10f3a1ULL, 0x0000000000000000ULL }, { 0xec0c7d3401209509ULL, 0xb6ce37757ff261fbULL, 0x0000faabc7f629f7ULL, 0x0000000000000000ULL },
+		{ 0x79ed78c8dfe25a69ULL, 0xc438b4cedb46e42fULL, 0x0000f087511d8bc2ULL, 0x0000000000000000ULL }, { 0xc4fe8c7e6f61e930ULL, 0x397bcfd3525acc6aULL, 0x000005164bfb5194ULL, 0x0000000000000000ULL },
+		{ 0x1ecb8db9a2f921dbULL, 0x23be42f4d47eb4a5ULL, 0x000007b865cc226eULL, 0x0000000000000000ULL }, { 0xa3d8790f127a9282ULL, 0xdefd39e95d629ce0ULL, 0x0000f2297f2af838ULL, 0x0000000000000000ULL },
+		{ 0xb7a18f2a25d4ac10ULL, 0x172945bac5364426ULL, 0x000003f939a2c487ULL, 0x0000000000000000ULL }, { 0x0ab27b9c95571f49ULL, 0xea6a3ea74c2a6c63ULL, 0x0000f66823441ed1ULL, 0x0000000000000000ULL },
+		{ 0xd0877a5b58cfd7a2ULL, 0xf0afb380ca0e14acULL, 0x0000f4c60d736d2bULL, 0x0000000000000000ULL }, { 0x6d948eede84c64fbULL, 0x0decc89d43123ce9ULL, 0x000001571795b77dULL, 0x0000000000000000ULL },
+		{ 0xe75870bef9565462ULL, 0x145ea8eb9f7b0319ULL, 0x0000e09e3cb83441ULL, 0x0000000000000000ULL }, { 0x5a4b840849d5e73bULL, 0xe91dd3f616672b5cULL, 0x0000150f265eee17ULL, 0x0000000000000000ULL },
+		{ 0x807e85cf844d2fd0ULL, 0xf3d85ed190435393ULL, 0x000017a108699dedULL, 0x0000000000000000ULL }, { 0x3d6d717934ce9c89ULL, 0x0e9b25cc195f7bd6ULL, 0x0000e230128f47bbULL, 0x0000000000000000ULL },
+		{ 0x2914875c0360a21bULL, 0xc74f599f810ba310ULL, 0x000013e054077b04ULL, 0x0000000000000000ULL }, { 0x940773eab3e31142ULL, 0x3a0c228208178b55ULL, 0x0000e6714ee1a152ULL, 0x0000000000000000ULL },
+		{ 0x4e32722d7e7bd9a9ULL, 0x20c9afa58e33f39aULL, 0x0000e4df60d6d2a8ULL, 0x0000000000000000ULL }, { 0xf321869bcef86af0ULL, 0xdd8ad4b8072fdbdfULL, 0x0000114e7a3008feULL, 0x0000000000000000ULL },
+		{ 0x66c08367103aa590ULL, 0xaf7c5703a39b5e0bULL, 0x00001b62ecdbaacbULL, 0x0000000000000000ULL }, { 0xdbd377d1a0b916c9ULL, 0x523f2c1e2a87764eULL, 0x0000eef3f63d709dULL, 0x0000000000000000ULL },
+		{ 0x01e676166d21de22ULL, 0x48faa139aca30e81ULL, 0x0000ec5dd80a0367ULL, 0x0000000000000000ULL }, { 0xbcf582a0dda26d7bULL, 0xb5b9da2425bf26c4ULL, 0x000019ccc2ecd931ULL, 0x0000000000000000ULL },
+		{ 0xa88c7485ea0c53e9ULL, 0x7c6da677bdebfe02ULL, 0x0000e81c8464e58eULL, 0x0000000000000000ULL }, { 0x159f80335a8fe0b0ULL, 0x812edd6a34f7d647ULL, 0x00001d8d9e823fd8ULL, 0x0000000000000000ULL },
+		{ 0xcfaa81f49717285bULL, 0x9beb504db2d3ae88ULL, 0x00001f23b0b54c22ULL, 0x0000000000000000ULL }, { 0x72b9754227949b02ULL, 0x66a82b503bcf86cdULL, 0x0000eab2aa539674ULL, 0x0000000000000000ULL },
+		{ 0xc62f6052b5234874ULL, 0xa99290a11701d075ULL, 0x0000c0ace6ef575aULL, 0x0000000000000000ULL }, { 0x7b3c94e405a0fb2dULL, 0x54d1ebbc9e1df830ULL, 0x0000353dfc098d0cULL, 0x0000000000000000ULL },
+		{ 0xa1099523c83833c6ULL, 0x4e14669b183980ffULL, 0x00003793d23efef6ULL, 0x0000000000000000ULL }, { 0x1c1a619578bb809fULL, 0xb3571d869125a8baULL, 0x0000c202c8d824a0ULL, 0x0000000000000000ULL },
+		{ 0x086397b04f15be0dULL, 0x7a8361d50971707cULL, 0x000033d28e50181fULL, 0x0000000000000000ULL }, { 0xb5706306ff960d54ULL, 0x87c01ac8806d5839ULL, 0x0000c64394b6c249ULL, 0x0000000000000000ULL },
+		{ 0x6f4562c1320ec5bfULL, 0x9d0597ef064920f6ULL, 0x0000c4edba81b1b3ULL, 0x0000000000000000ULL }, { 0xd2569677828d76e6ULL, 0x6046ecf28f5508b3ULL, 0x0000317ca0676be5ULL, 0x0000000000000000ULL },
+		{ 0x47b7938b5c4fb986ULL, 0x12b06f492be18d67ULL, 0x00003b50368cc9d0ULL, 0x0000000000000000ULL }, { 0xfaa4673deccc0adfULL, 0xeff31454a2fda522ULL, 0x0000cec12c6a1386ULL, 0x0000000000000000ULL },
+		{ 0x209166fa2154c234ULL, 0xf536997324d9ddedULL, 0x0000cc6f025d607cULL, 0x0000000000000000ULL }, { 0x9d82924c91d7716dULL, 0x0875e26eadc5f5a8ULL, 0x000039fe18bbba2aULL, 0x0000000000000000ULL },
+		{ 0x89fb6469a6794fffULL, 0xc1a19e3d35912d6eULL, 0x0000c82e5e338695ULL, 0x0000000000000000ULL }, { 0x34e890df16fafca6ULL, 0x3ce2e520bc8d052bULL, 0x00003dbf44d55cc3ULL, 0x0000000000000000ULL },
+		{ 0xeedd9118db62344dULL, 0x262768073aa97de4ULL, 0x00003f116ae22f39ULL, 0x0000000000000000ULL }, { 0x53ce65ae6be18714ULL, 0xdb64131ab3b555a1ULL, 0x0000ca807004f56fULL, 0x0000000000000000ULL },
+		{ 0xd9029bfd7afbb78dULL, 0xc2d6736c6fdc6a51ULL, 0x00002b495b297653ULL, 0x0000000000000000ULL }, { 0x64116f4bca7804d4ULL, 0x3f950871e6c04214ULL, 0x0000ded841cfac05ULL, 0x0000000000000000ULL },
+		{ 0xbe246e8c07e0cc3fULL, 0x2550855660e43adbULL, 0x0000dc766ff8dfffULL, 0x0000000000000000ULL }, { 0x03379a3ab7637f66ULL, 0xd813fe4be9f8129eULL, 0x000029e7751e05a9ULL, 0x0000000000000000ULL },
+		{ 0x174e6c1f80cd41f4ULL, 0x11c7821871acca58ULL, 0x0000d83733963916ULL, 0x0000000000000000ULL }, { 0xaa5d98a9304ef2adULL, 0xec84f905f8b0e21dULL, 0x00002da62970e340ULL, 0x0000000000000000ULL },
+		{ 0x7068996efdd63a46ULL, 0xf64174227e949ad2ULL, 0x00002f08074790baULL, 0x0000000000000000ULL }, { 0xcd7b6dd84d55891fULL, 0x0b020f3ff788b297ULL, 0x0000da991da14aecULL, 0x0000000000000000ULL },
+		{ 0x589a68249397467fULL, 0x79f48c84533c3743ULL, 0x0000d0b58b4ae8d9ULL, 0x0000000000000000ULL }, { 0xe5899c922314f526ULL, 0x84b7f799da201f06ULL, 0x0000252491ac328fULL, 0x0000000000000000ULL },
+		{ 0x3fbc9d55ee8c3dcdULL, 0x9e727abe5c0467c9ULL, 0x0000278abf9b4175ULL, 0x0000000000000000ULL }, { 0x82af69e35e0f8e94ULL, 0x633101a3d5184f8cULL, 0x0000d21ba57d9b23ULL, 0x0000000000000000ULL },
+		{ 0x96d69fc669a1b006ULL, 0xaae57df04d4c974aULL, 0x000023cbe3f5a79cULL, 0x0000000000000000ULL }, { 0x2bc56b70d922035fULL, 0x57a606edc450bf0fULL, 0x0000d65af9137dcaULL, 0x0000000000000000ULL },
+		{ 0xf1f06ab714bacbb4ULL, 0x4d638bca4274c7c0ULL, 0x0000d4f4d7240e30ULL, 0x0000000000000000ULL }, { 0x4ce39e01a43978edULL, 0xb020f0d7cb68ef85ULL, 0x00002165cdc2d466ULL, 0x0000000000000000ULL },
+		{ 0x84c140972dc97058ULL, 0xce17e0351af56badULL, 0x000080c84f41916cULL, 0x0000000000000000ULL }, { 0x39d2b4219d4ac301ULL, 0x33549b2893e943e8ULL, 0x0000755955a74b3aULL, 0x0000000000000000ULL },
+		{ 0xe3e7b5e650d20beaULL, 0x2991160f15cd3b27ULL, 0x000077f77b9038c0ULL, 0x0000000000000000ULL }, { 0x5ef44150e051b8b3ULL, 0xd4d26d129cd11362ULL, 0x000082666176e296ULL, 0x0000000000000000ULL },
+		{ 0x4a8db775d7ff8621ULL, 0x1d0611410485cba4ULL, 0x000073b627fede29ULL, 0x0000000000000000ULL }, { 0xf79e43c3677c3578ULL, 0xe0456a5c8d99e3e1ULL, 0x000086273d18047fULL, 0x0000000000000000ULL },
+		{ 0x2dab4204aae4fd93ULL, 0xfa80e77b0bbd9b2eULL, 0x00008489132f7785ULL, 0x0000000000000000ULL }, { 0x90b8b6b21a674ecaULL, 0x07c39c6682a1b36bULL, 0x0000711809c9add3ULL, 0x0000000000000000ULL },
+		{ 0x0559b34ec4a581aaULL, 0x75351fdd261536bfULL, 0x00007b349f220fe6ULL, 0x0000000000000000ULL }, { 0xb84a47f8742632f3ULL, 0x887664c0af091efaULL, 0x00008ea585c4d5b0ULL, 0x0000000000000000ULL },
+		{ 0x627f463fb9befa18ULL, 0x92b3e9e7292d6635ULL, 0x00008c0babf3a64aULL, 0x0000000000000000ULL }, { 0xdf6cb289093d4941ULL, 0x6ff092faa0314e70ULL, 0x0000799ab1157c1cULL, 0x0000000000000000ULL },
+		{ 0xcb1544ac3e9377d3ULL, 0xa624eea9386596b6ULL, 0x0000884af79d40a3ULL, 0x0000000000000000ULL }, { 0x7606b01a8e10c48aULL, 0x5b6795b4b179bef3ULL, 0x00007ddbed7b9af5ULL, 0x0000000000000000ULL },
+		{ 0xac33b1dd43880c61ULL, 0x41a21893375dc63cULL, 0x00007f75c34ce90fULL, 0x0000000000000000ULL }, { 0x1120456bf30bbf38ULL, 0xbce1638ebe41ee79ULL, 0x00008ae4d9aa3359ULL, 0x0000000000000000ULL },
+		{ 0x9becbb38e2118fa1ULL, 0xa55303f86228d189ULL, 0x00006b2df287b065ULL, 0x0000000000000000ULL }, { 0x26ff4f8e52923cf8ULL, 0x581078e5eb34f9ccULL, 0x00009ebce8616a33ULL, 0x0000000000000000ULL },
+		{ 0xfcca4e499f0af413ULL, 0x42d5f5c26d108103ULL, 0x00009c12c65619c9ULL, 0x0000000000000000ULL }, { 0x41d9baff2f89474aULL, 0xbf968edfe40ca946ULL, 0x00006983dcb0c39fULL, 0x0000000000000000ULL },
+		{ 0x55a04cda182779d8ULL, 0x7642f28c7c587180ULL, 0x000098539a38ff20ULL, 0x0000000000000000ULL }, { 0xe8b3b86ca8a4ca81ULL, 0x8b018991f54459c5ULL, 0x00006dc280de2576ULL, 0x0000000000000000ULL },
+		{ 0x3286b9ab653c026aULL, 0x91c404b67360210aULL, 0x00006f6caee9568cULL, 0x0000000000000000ULL }, { 0x8f954d1dd5bfb133ULL, 0x6c877fabfa7c094fULL, 0x00009afdb40f8cdaULL, 0x0000000000000000ULL },
+		{ 0x1a7448e10b7d7e53ULL, 0x1e71fc105ec88c9bULL, 0x000090d122e42eefULL, 0x0000000000000000ULL }, { 0xa767bc57bbfecd0aULL, 0xe332870dd7d4a4deULL, 0x000065403802f4b9ULL, 0x0000000000000000ULL },
+		{ 0x7d52bd90766605e1ULL, 0xf9f70a2a51f0dc11ULL, 0x000067ee16358743ULL, 0x0000000000000000ULL }, { 0xc0414926c6e5b6b8ULL, 0x04b47137d8ecf454ULL, 0x0000927f0cd35d15ULL, 0x0000000000000000ULL },
+		{ 0xd438bf03f14b882aULL, 0xcd600d6440b82c92ULL, 0x000063af4a5b61aaULL, 0x0000000000000000ULL }, { 0x692b4bb541c83b73ULL, 0x30237679c9a404d7ULL, 0x0000963e50bdbbfcULL, 0x0000000000000000ULL },
+		{ 0xb31e4a728c50f398ULL, 0x2ae6fb5e4f807c18ULL, 0x000094907e8ac806ULL, 0x0000000000000000ULL }, { 0x0e0dbec43cd340c1ULL, 0xd7a58043c69c545dULL, 0x00006101646c1250ULL, 0x0000000000000000ULL },
+		{ 0xba9babd4ae6493b7ULL, 0x189f3bb2ea5202e5ULL, 0x00004b1f28d0d37eULL, 0x0000000000000000ULL }, { 0x07885f621ee720eeULL, 0xe5dc40af634e2aa0ULL, 0x0000be8e32360928ULL, 0x0000000000000000ULL },
+		{ 0xddbd5ea5d37fe805ULL, 0xff19cd88e56a526fULL, 0x0000bc201c017ad2ULL, 0x0000000000000000ULL }, { 0x60aeaa1363fc5b5cULL, 0x025ab6956c767a2aULL, 0x000049b106e7a084ULL, 0x0000000000000000ULL },
+		{ 0x74d75c36545265ceULL, 0xcb8ecac6f422a2ecULL, 0x0000b861406f9c3bULL, 0x0000000000000000ULL }, { 0xc9c4a880e4d1d697ULL, 0x36cdb1db7d3e8aa9ULL, 0x00004df05a89466dULL, 0x0000000000000000ULL },
+		{ 0x13f1a94729491e7cULL, 0x2c083cfcfb1af266ULL, 0x00004f5e74be3597ULL, 0x0000000000000000ULL }, { 0xaee25df199caad25ULL, 0xd14b47e17206da23ULL, 0x0000bacf6e58efc1ULL, 0x0000000000000000ULL },
+		{ 0x3b03580d47086245ULL, 0xa3bdc45ad6b25ff7ULL, 0x0000b0e3f8b34df4ULL, 0x0000000000000000ULL }, { 0x8610acbbf78bd11cULL, 0x5efebf475fae77b2ULL, 0x00004572e25597a2ULL, 0x0000000000000000ULL },
+		{ 0x5c25ad7c3a1319f7ULL, 0x443b3260d98a0f7dULL, 0x000047dccc62e458ULL, 0x0000000000000000ULL }, { 0xe13659ca8a90aaaeULL, 0xb978497d50962738ULL, 0x0000b24dd6843e0eULL, 0x0000000000000000ULL },
+		{ 0xf54fafefbd3e943cULL, 0x70ac352ec8c2fffeULL, 0x0000439d900c02b1ULL, 0x0000000000000000ULL }, { 0x485c5b590dbd2765ULL, 0x8def4e3341ded7bbULL, 0x0000b60c8aead8e7ULL, 0x0000000000000000ULL },
+		{ 0x92695a9ec025ef8eULL, 0x972ac314c7faaf74ULL, 0x0000b4a2a4ddab1dULL, 0x0000000000000000ULL }, { 0x2f7aae2870a65cd7ULL, 0x6a69b8094ee68731ULL, 0x00004133be3b714bULL, 0x0000000000000000ULL },
+		{ 0xa5b6507b61bc6c4eULL, 0x73dbd87f928fb8c1ULL, 0x0000a0fa9516f277ULL, 0x0000000000000000ULL }, { 0x18a5a4cdd13fdf17ULL, 0x8e98a3621b939084ULL, 0x0000556b8ff02821ULL, 0x0000000000000000ULL },
+		{ 0xc290a50a1ca717fcULL, 0x945d2e459db7e84bULL, 0x000057c5a1c75bdbULL, 0x0000000000000000ULL }, { 0x7f8351bcac24a4a5ULL, 0x691e555814abc00eULL, 0x0000a254bb21818dULL, 0x0000000000000000ULL },
+		{ 0x6bfaa7999b8a9a37ULL, 0xa0ca290b8cff18c8ULL, 0x00005384fda9bd32ULL, 0x0000000000000000ULL }, { 0xd6e9532f2b09296eULL, 0x5d89521605e3308dULL, 0x0000a615e74f6764ULL, 0x0000000000000000ULL },
+		{ 0x0cdc52e8e691e185ULL, 0x474cdf3183c74842ULL, 0x0000a4bbc978149eULL, 0x0000000000000000ULL }, { 0xb1cfa65e561252dcULL, 0xba0fa42c0adb6007ULL, 0x0000512ad39ecec8ULL, 0x0000000000000000ULL },
+		{ 0x242ea3a288d09dbcULL, 0xc8f92797ae6fe5d3ULL, 0x00005b0645756cfdULL, 0x0000000000000000ULL }, { 0x993d571438532ee5ULL, 0x35ba5c8a2773cd96ULL, 0x0000ae975f93b6abULL, 0x0000000000000000ULL },
+		{ 0x430856d3f5cbe60eULL, 0x2f7fd1ada157b559ULL, 0x0000ac3971a4c551ULL, 0x0000000000000000ULL }, { 0xfe1ba26545485557ULL, 0xd23caab0284b9d1cULL, 0x000059a86b421f07ULL, 0x0000000000000000ULL },
+		{ 0xea62544072e66bc5ULL, 0x1be8d6e3b01f45daULL, 0x0000a8782dca23b8ULL, 0x0000000000000000ULL }, { 0x5771a0f6c265d89cULL, 0xe6abadfe39036d9fULL, 0x00005de9372cf9eeULL, 0x0000000000000000ULL },
+		{ 0x8d44a1310ffd1077ULL, 0xfc6e20d9bf271550ULL, 0x00005f47191b8a14ULL, 0x0000000000000000ULL }, { 0x30575587bf7ea32eULL, 0x012d5bc4363b3d15ULL, 0x0000aad603fd5042ULL, 0x0000000000000000ULL },
+	},
+	{ // 24
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x66d8edb246a9767aULL, 0x2b3d488249e59673ULL, 0x7590d97ff7ed01ceULL, 0x0000000000000000ULL },
+		{ 0xccadc7798c4fecf4ULL, 0x567a901992d731e6ULL, 0xea3daffef3c70281ULL, 0x0000000000000000ULL }, { 0xaa752acbcae69a8eULL, 0x7d47d89bdb32a795ULL, 0x9fad7681042a034fULL, 0x0000000000000000ULL },
+		{ 0x854793f2059ec5f5ULL, 0xacf43d3239b362d1ULL, 0xc97a43e1fb93041fULL, 0x0000000000000000ULL }, { 0xe39f7e404337b38fULL, 0x87c975b07056f4a2ULL, 0xbcea9a9e0c7e05d1ULL, 0x0000000000000000ULL },
+		{ 0x49ea548b89d12901ULL, 0xfa8ead2bab645337ULL, 0x2347ec1f0854069eULL, 0x0000000000000000ULL }, { 0x2f32b939cf785f7bULL, 0xd1b3e5a9e281c544ULL, 0x56d73560ffb90750ULL, 0x0000000000000000ULL },
+		{ 0x178e3bf90a2197f7ULL, 0x45f57a64727bc4bfULL, 0x8ff486dfeb3b083eULL, 0x0000000000000000ULL }, { 0x7156d64b4c88e18dULL, 0x6ec832e63b9e52ccULL, 0xfa645fa01cd609f0ULL, 0x0000000000000000ULL },
+		{ 0xdb23fc80866e7b03ULL, 0x138fea7de0acf559ULL, 0x65c9292118fc0abfULL, 0x0000000000000000ULL }, { 0xbdfb1132c0c70d79ULL, 0x38b2a2ffa949632aULL, 0x1059f05eef110b71ULL, 0x0000000000000000ULL },
+		{ 0x92c9a80b0fbf5202ULL, 0xe90147564bc8a66eULL, 0x468ec53e10a80c21ULL, 0x0000000000000000ULL }, { 0xf41145b949162478ULL, 0xc23c0fd4022d301dULL, 0x331e1c41e7450defULL, 0x0000000000000000ULL },
+		{ 0x5e646f7283f0bef6ULL, 0xbf7bd74fd91f9788ULL, 0xacb36ac0e36f0ea0ULL, 0x0000000000000000ULL }, { 0x38bc82c0c559c88cULL, 0x94469fcd90fa01fbULL, 0xd923b3bf14820f6eULL, 0x0000000000000000ULL },
+		{ 0x2e0176ef144233f3ULL, 0x8af7f4c8e4f69563ULL, 0x03f511a3cb76107cULL, 0x0000000000000000ULL }, { 0x48d99b5d52eb4589ULL, 0xa1cabc4aad130310ULL, 0x7665c8dc3c9b11b2ULL, 0x0000000000000000ULL },
+		{ 0xe2acb196980ddf07ULL, 0xdc8d64d17621a485ULL, 0xe9c8be5d38b112fdULL, 0x0000000000000000ULL }, { 0x84745c24dea4a97dULL, 0xf7b02c533fc432f6ULL, 0x9c586722cf5c1333ULL, 0x0000000000000000ULL },
+		{ 0xab46e51d11dcf606ULL, 0x2603c9fadd45f7b2ULL, 0xca8f524230e51463ULL, 0x0000000000000000ULL }, { 0xcd9e08af5775807cULL, 0x0d3e817894a061c1ULL, 0xbf1f8b3dc70815adULL, 0x0000000000000000ULL },
+		{ 0x67eb22649d931af2ULL, 0x707959e34f92c654ULL, 0x20b2fdbcc32216e2ULL, 0x0000000000000000ULL }, { 0x0133cfd6db3a6c88ULL, 0x5b44116106775027ULL, 0x552224c334cf172cULL, 0x0000000000000000ULL },
+		{ 0x398f4d161e63a404ULL, 0xcf028eac968d51dcULL, 0x8c01977c204d1842ULL, 0x0000000000000000ULL }, { 0x5f57a0a458cad27eULL, 0xe43fc62edf68c7afULL, 0xf9914e03d7a0198cULL, 0x0000000000000000ULL },
+		{ 0xf5228a6f922c48f0ULL, 0x99781eb5045a603aULL, 0x663c3882d38a1ac3ULL, 0x0000000000000000ULL }, { 0x93fa67ddd4853e8aULL, 0xb24556374dbff649ULL, 0x13ace1fd24671b0dULL, 0x0000000000000000ULL },
+		{ 0xbcc8dee41bfd61f1ULL, 0x63f6b39eaf3e330dULL, 0x457bd49ddbde1c5dULL, 0x0000000000000000ULL }, { 0xda1033565d54178bULL, 0x48cbfb1ce6dba57eULL, 0x30eb0de22c331d93ULL, 0x0000000000000000ULL },
+		{ 0x7065199d97b28d05ULL, 0x358c23873de902ebULL, 0xaf467b6328191edcULL, 0x0000000000000000ULL }, { 0x16bdf42fd11bfb7fULL, 0x1eb16b05740c9498ULL, 0xdad6a21cdff41f12ULL, 0x0000000000000000ULL },
+		{ 0x5c02ecc3288466fbULL, 0x09f3f58dd5f137c6ULL, 0x06f7225b8bec20f8ULL, 0x0000000000000000ULL }, { 0x3ada01716e2d1081ULL, 0x22cebd0f9c14a1b5ULL, 0x7367fb247c012136ULL, 0x0000000000000000ULL },
+		{ 0x90af2bbaa4cb8a0fULL, 0x5f89659447260620ULL, 0xecca8da5782b2279ULL, 0x0000000000000000ULL }, { 0xf677c608e262fc75ULL, 0x74b42d160ec39053ULL, 0x995a54da8fc623b7ULL, 0x0000000000000000ULL },
+		{ 0xd9457f312d1aa30eULL, 0xa507c8bfec425517ULL, 0xcf8d61ba707f24e7ULL, 0x0000000000000000ULL }, { 0xbf9d92836bb3d574ULL, 0x8e3a803da5a7c364ULL, 0xba1db8c587922529ULL, 0x0000000000000000ULL },
+		{ 0x15e8b848a1554ffaULL, 0xf37d58a67e9564f1ULL, 0x25b0ce4483b82666ULL, 0x0000000000000000ULL }, { 0x733055fae7fc3980ULL, 0xd84010243770f282ULL, 0x5020173b745527a8ULL, 0x0000000000000000ULL },
+		{ 0x4b8cd73a22a5f10cULL, 0x4c068fe9a78af379ULL, 0x8903a48460d728c6ULL, 0x0000000000000000ULL }, { 0x2d543a88640c8776ULL, 0x673bc76bee6f650aULL, 0xfc937dfb973a2908ULL, 0x0000000000000000ULL },
+		{ 0x87211043aeea1df8ULL, 0x1a7c1ff0355dc29fULL, 0x633e0b7a93102a47ULL, 0x0000000000000000ULL }, { 0xe1f9fdf1e8436b82ULL, 0x314157727cb854ecULL, 0x16aed20564fd2b89ULL, 0x0000000000000000ULL },
+		{ 0xcecb44c8273b34f9ULL, 0xe0f2b2db9e3991a8ULL, 0x4079e7659b442cd9ULL, 0x0000000000000000ULL }, { 0xa813a97a61924283ULL, 0xcbcffa59d7dc07dbULL, 0x35e93e1a6ca92d17ULL, 0x0000000000000000ULL },
+		{ 0x026683b1ab74d80dULL, 0xb68822c20ceea04eULL, 0xaa44489b68832e58ULL, 0x0000000000000000ULL }, { 0x64be6e03edddae77ULL, 0x9db56a40450b363dULL, 0xdfd491e49f6e2f96ULL, 0x0000000000000000ULL },
+		{ 0x72039a2c3cc65508ULL, 0x830401453107a2a5ULL, 0x050233f8409a3084ULL, 0x0000000000000000ULL }, { 0x14db779e7a6f2372ULL, 0xa83949c778e234d6ULL, 0x7092ea87b777314aULL, 0x0000000000000000ULL },
+		{ 0xbeae5d55b089b9fcULL, 0xd57e915ca3d09343ULL, 0xef3f9c06b35d3205ULL, 0x0000000000000000ULL }, { 0xd876b0e7f620cf86ULL, 0xfe43d9deea350530ULL, 0x9aaf457944b033cbULL, 0x0000000000000000ULL },
+		{ 0xf74409de395890fdULL, 0x2ff03c7708b4c074ULL, 0xcc787019bb09349bULL, 0x0000000000000000ULL }, { 0x919ce46c7ff1e687ULL, 0x04cd74f541515607ULL, 0xb9e8a9664ce43555ULL, 0x0000000000000000ULL },
+		{ 0x3be9cea7b5177c09ULL, 0x798aac6e9a63f192ULL, 0x2645dfe748ce361aULL, 0x0000000000000000ULL }, { 0x5d312315f3be0a73ULL, 0x52b7e4ecd38667e1ULL, 0x53d50698bf2337d4ULL, 0x0000000000000000ULL },
+		{ 0x658da1d536e7c2ffULL, 0xc6f17b21437c661aULL, 0x8af6b527aba138baULL, 0x0000000000000000ULL }, { 0x03554c67704eb485ULL, 0xedcc33a30a99f069ULL, 0xff666c585c4c3974ULL, 0x0000000000000000ULL },
+		{ 0xa92066acbaa82e0bULL, 0x908beb38d1ab57fcULL, 0x60cb1ad958663a3bULL, 0x0000000000000000ULL }, { 0xcff88b1efc015871ULL, 0xbbb6a3ba984ec18fULL, 0x155bc3a6af8b3bf5ULL, 0x0000000000000000ULL },
+		{ 0xe0ca32273379070aULL, 0x6a0546137acf04cbULL, 0x438cf6c650323ca5ULL, 0x0000000000000000ULL }, { 0x8612df9575d07170ULL, 0x41380e91332a92b8ULL, 0x361c2fb9a7df3d6bULL, 0x0000000000000000ULL },
+		{ 0x2c67f55ebf36ebfeULL, 0x3c7fd60ae818352dULL, 0xa9b15938a3f53e24ULL, 0x0000000000000000ULL }, { 0x4abf18ecf99f9d84ULL, 0x17429e88a1fda35eULL, 0xdc21804754183feaULL, 0x0000000000000000ULL },
+		{ 0xb804c59b5015ccebULL, 0x12fbf707b7ff6e91ULL, 0x0cf344b60bc540edULL, 0x0000000000000000ULL }, { 0xdedc282916bcba91ULL, 0x39c6bf85fe1af8e2ULL, 0x79639dc9fc284123ULL, 0x0000000000000000ULL },
+		{ 0x74a902e2dc5a201fULL, 0x4481671e25285f77ULL, 0xe6ceeb48f802426cULL, 0x0000000000000000ULL }, { 0x1271ef509af35665ULL, 0x6fbc2f9c6ccdc904ULL, 0x935e32370fef43a2ULL, 0x0000000000000000ULL },
+		{ 0x3d435669558b091eULL, 0xbe0fca358e4c0c40ULL, 0xc5890757f05644f2ULL, 0x0000000000000000ULL }, { 0x5b9bbbdb13227f64ULL, 0x953282b7c7a99a33ULL, 0xb019de2807bb453cULL, 0x0000000000000000ULL },
+		{ 0xf1ee9110d9c4e5eaULL, 0xe8755a2c1c9b3da6ULL, 0x2fb4a8a903914673ULL, 0x0000000000000000ULL }, { 0x97367ca29f6d9390ULL, 0xc34812ae557eabd5ULL, 0x5a2471d6f47c47bdULL, 0x0000000000000000ULL },
+		{ 0xaf8afe625a345b1cULL, 0x570e8d63c584aa2eULL, 0x8307c269e0fe48d3ULL, 0x0000000000000000ULL }, { 0xc95213d01c9d2d66ULL, 0x7c33c5e18c613c5dULL, 0xf6971b161713491dULL, 0x0000000000000000ULL },
+		{ 0x6327391bd67bb7e8ULL, 0x01741d7a57539bc8ULL, 0x693a6d9713394a52ULL, 0x0000000000000000ULL }, { 0x05ffd4a990d2c192ULL, 0x2a4955f81eb60dbbULL, 0x1caab4e8e4d44b9cULL, 0x0000000000000000ULL },
+		{ 0x2acd6d905faa9ee9ULL, 0xfbfab051fc37c8ffULL, 0x4a7d81881b6d4cccULL, 0x0000000000000000ULL }, { 0x4c1580221903e893ULL, 0xd0c7f8d3b5d25e8cULL, 0x3fed58f7ec804d02ULL, 0x0000000000000000ULL },
+		{ 0xe660aae9d3e5721dULL, 0xad8020486ee0f919ULL, 0xa0402e76e8aa4e4dULL, 0x0000000000000000ULL }, { 0x80b8475b954c0467ULL, 0x86bd68ca27056f6aULL, 0xd5d0f7091f474f83ULL, 0x0000000000000000ULL },
+		{ 0x9605b3744457ff18ULL, 0x980c03cf5309fbf2ULL, 0x0f065515c0b35091ULL, 0x0000000000000000ULL }, { 0xf0dd5ec602fe8962ULL, 0xb3314b4d1aec6d81ULL, 0x7a968c6a375e515fULL, 0x0000000000000000ULL },
+		{ 0x5aa8740dc81813ecULL, 0xce7693d6c1deca14ULL, 0xe53bfaeb33745210ULL, 0x0000000000000000ULL }, { 0x3c7099bf8eb16596ULL, 0xe54bdb54883b5c67ULL, 0x90ab2394c49953deULL, 0x0000000000000000ULL },
+		{ 0x1342208641c93aedULL, 0x34f83efd6aba9923ULL, 0xc67c16f43b20548eULL, 0x0000000000000000ULL }, { 0x759acd3407604c97ULL, 0x1fc5767f235f0f50ULL, 0xb3eccf8bcccd5540ULL, 0x0000000000000000ULL },
+		{ 0xdfefe7ffcd86d619ULL, 0x6282aee4f86da8c5ULL, 0x2c41b90ac8e7560fULL, 0x0000000000000000ULL }, { 0xb9370a4d8b2fa063ULL, 0x49bfe666b1883eb6ULL, 0x59d160753f0a57c1ULL, 0x0000000000000000ULL },
+		{ 0x818b888d4e7668efULL, 0xddf979ab21723f4dULL, 0x80f2d3ca2b8858afULL, 0x0000000000000000ULL }, { 0xe753653f08df1e95ULL, 0xf6c431296897a93eULL, 0xf5620ab5dc655961ULL, 0x0000000000000000ULL },
+		{ 0x4d264ff4c239841bULL, 0x8b83e9b2b3a50eabULL, 0x6acf7c34d84f5a2eULL, 0x0000000000000000ULL }, { 0x2bfea2468490f261ULL, 0xa0bea130fa4098d8ULL, 0x1f5fa54b2fa25be0ULL, 0x0000000000000000ULL },
+		{ 0x04cc1b7f4be8ad1aULL, 0x710d449918c15d9cULL, 0x4988902bd01b5cb0ULL, 0x0000000000000000ULL }, { 0x6214f6cd0d41db60ULL, 0x5a300c1b5124cbefULL, 0x3c18495427f65d7eULL, 0x0000000000000000ULL },
+		{ 0xc861dc06c7a741eeULL, 0x2777d4808a166c7aULL, 0xa3b53fd523dc5e31ULL, 0x0000000000000000ULL }, { 0xaeb931b4810e3794ULL, 0x0c4a9c02c3f3fa09ULL, 0xd625e6aad4315fffULL, 0x0000000000000000ULL },
+		{ 0xe40629587891aa10ULL, 0x1b08028a620e5957ULL, 0x0a0466ed80296015ULL, 0x0000000000000000ULL }, { 0x82dec4ea3e38dc6aULL, 0x30354a082bebcf24ULL, 0x7f94bf9277c461dbULL, 0x0000000000000000ULL },
+		{ 0x28abee21f4de46e4ULL, 0x4d729293f0d968b1ULL, 0xe039c91373ee6294ULL, 0x0000000000000000ULL }, { 0x4e730393b277309eULL, 0x664fda11b93cfec2ULL, 0x95a9106c8403635aULL, 0x0000000000000000ULL },
+		{ 0x6141baaa7d0f6fe5ULL, 0xb7fc3fb85bbd3b86ULL, 0xc37e250c7bba640aULL, 0x0000000000000000ULL }, { 0x079957183ba6199fULL, 0x9cc1773a1258adf5ULL, 0xb6eefc738c5765c4ULL, 0x0000000000000000ULL },
+		{ 0xadec7dd3f1408311ULL, 0xe186afa1c96a0a60ULL, 0x29438af2887d668bULL, 0x0000000000000000ULL }, { 0xcb349061b7e9f56bULL, 0xcabbe723808f9c13ULL, 0x5cd3538d7f906745ULL, 0x0000000000000000ULL },
+		{ 0xf38812a172b03de7ULL, 0x5efd78ee10759de8ULL, 0x85f0e0326b12682bULL, 0x0000000000000000ULL }, { 0x9550ff1334194b9dULL, 0x75c0306c59900b9bULL, 0xf060394d9cff69e5ULL, 0x0000000000000000ULL },
+		{ 0x3f25d5d8feffd113ULL, 0x0887e8f782a2ac0eULL, 0x6fcd4fcc98d56aaaULL, 0x0000000000000000ULL }, { 0x59fd386ab856a769ULL, 0x23baa075cb473a7dULL, 0x1a5d96b36f386b64ULL, 0x0000000000000000ULL },
+		{ 0x76cf8153772ef812ULL, 0xf20945dc29c6ff39ULL, 0x4c8aa3d390816c34ULL, 0x0000000000000000ULL }, { 0x10176ce131878e68ULL, 0xd9340d5e6023694aULL, 0x391a7aac676c6dfaULL, 0x0000000000000000ULL },
+		{ 0xba62462afb6114e6ULL, 0xa473d5c5bb11cedfULL, 0xa6b70c2d63466eb5ULL, 0x0000000000000000ULL }, { 0xdcbaab98bdc8629cULL, 0x8f4e9d47f2f458acULL, 0xd327d55294ab6f7bULL, 0x0000000000000000ULL },
+		{ 0xca075fb76cd399e3ULL, 0x91fff64286f8cc34ULL, 0x09f1774e4b5f7069ULL, 0x0000000000000000ULL }, { 0xacdfb2052a7aef99ULL, 0xbac2bec0cf1d5a47ULL, 0x7c61ae31bcb271a7ULL, 0x0000000000000000ULL },
+		{ 0x06aa98cee09c7517ULL, 0xc785665b142ffdd2ULL, 0xe3ccd8b0b89872e8ULL, 0x0000000000000000ULL }, { 0x6072757ca635036dULL, 0xecb82ed95dca6ba1ULL, 0x965c01cf4f757326ULL, 0x0000000000000000ULL },
+		{ 0x4f40cc45694d5c16ULL, 0x3d0bcb70bf4baee5ULL, 0xc08b34afb0cc7476ULL, 0x0000000000000000ULL }, { 0x299821f72fe42a6cULL, 0x163683f2f6ae3896ULL, 0xb51bedd0472175b8ULL, 0x0000000000000000ULL },
+		{ 0x83ed0b3ce502b0e2ULL, 0x6b715b692d9c9f03ULL, 0x2ab69b51430b76f7ULL, 0x0000000000000000ULL }, { 0xe535e68ea3abc698ULL, 0x404c13eb64790970ULL, 0x5f26422eb4e67739ULL, 0x0000000000000000ULL },
+		{ 0xdd89644e66f20e14ULL, 0xd40a8c26f483088bULL, 0x8605f191a0647857ULL, 0x0000000000000000ULL }, { 0xbb5189fc205b786eULL, 0xff37c4a4bd669ef8ULL, 0xf39528ee57897999ULL, 0x0000000000000000ULL },
+		{ 0x1124a337eabde2e0ULL, 0x82701c3f6654396dULL, 0x6c385e6f53a37ad6ULL, 0x0000000000000000ULL }, { 0x77fc4e85ac14949aULL, 0xa94d54bd2fb1af1eULL, 0x19a88710a44e7b18ULL, 0x0000000000000000ULL },
+		{ 0x58cef7bc636ccbe1ULL, 0x78feb114cd306a5aULL, 0x4f7fb2705bf77c48ULL, 0x0000000000000000ULL }, { 0x3e161a0e25c5bd9bULL, 0x53c3f99684d5fc29ULL, 0x3aef6b0fac1a7d86ULL, 0x0000000000000000ULL },
+		{ 0x946330c5ef232715ULL, 0x2e84210d5fe75bbcULL, 0xa5421d8ea8307ec9ULL, 0x0000000000000000ULL }, { 0xf2bbdd77a98a516fULL, 0x05b9698f1602cdcfULL, 0xd0d2c4f15fdd7f07ULL, 0x0000000000000000ULL },
+		{ 0x6d08972ba02a85cbULL, 0x24ebf30e73e3dc3fULL, 0x18fb8871169780c7ULL, 0x0000000000000000ULL }, { 0x0bd07a99e683f3b1ULL, 0x0fd6bb8c3a064a4cULL, 0x6d6b510ee17a8109ULL, 0x0000000000000000ULL },
+		{ 0xa1a550522c65693fULL, 0x72916317e134edd9ULL, 0xf2c6278fe5508246ULL, 0x0000000000000000ULL }, { 0xc77dbde06acc1f45ULL, 0x59ac2b95a8d17baaULL, 0x8756fef012bd8388ULL, 0x0000000000000000ULL },
+		{ 0xe84f04d9a5b4403eULL, 0x881fce3c4a50beeeULL, 0xd181cb90ed0484d8ULL, 0x0000000000000000ULL }, { 0x8e97e96be31d3644ULL, 0xa32286be03b5289dULL, 0xa41112ef1ae98516ULL, 0x0000000000000000ULL },
+		{ 0x24e2c3a029fbaccaULL, 0xde655e25d8878f08ULL, 0x3bbc646e1ec38659ULL, 0x0000000000000000ULL }, { 0x423a2e126f52dab0ULL, 0xf55816a79162197bULL, 0x4e2cbd11e92e8797ULL, 0x0000000000000000ULL },
+		{ 0x7a86acd2aa0b123cULL, 0x611e896a01981880ULL, 0x970f0eaefdac88f9ULL, 0x0000000000000000ULL }, { 0x1c5e4160eca26446ULL, 0x4a23c1e8487d8ef3ULL, 0xe29fd7d10a418937ULL, 0x0000000000000000ULL },
+		{ 0xb62b6bab2644fec8ULL, 0x37641973934f2966ULL, 0x7d32a1500e6b8a78ULL, 0x0000000000000000ULL }, { 0xd0f3861960ed88b2ULL, 0x1c5951f1daaabf15ULL, 0x08a2782ff9868bb6ULL, 0x0000000000000000ULL },
+		{ 0xffc13f20af95d7c9ULL, 0xcdeab458382b7a51ULL, 0x5e754d4f063f8ce6ULL, 0x0000000000000000ULL }, { 0x9919d292e93ca1b3ULL, 0xe6d7fcda71ceec22ULL, 0x2be59430f1d28d28ULL, 0x0000000000000000ULL },
+		{ 0x336cf85923da3b3dULL, 0x9b902441aafc4bb7ULL, 0xb448e2b1f5f88e67ULL, 0x0000000000000000ULL }, { 0x55b415eb65734d47ULL, 0xb0ad6cc3e319ddc4ULL, 0xc1d83bce02158fa9ULL, 0x0000000000000000ULL },
+		{ 0x4309e1c4b468b638ULL, 0xae1c07c69715495cULL, 0x1b0e99d2dde190bbULL, 0x0000000000000000ULL }, { 0x25d10c76f2c1c042ULL, 0x85214f44def0df2fULL, 0x6e9e40ad2a0c9175ULL, 0x0000000000000000ULL },
+		{ 0x8fa426bd38275accULL, 0xf86697df05c278baULL, 0xf133362c2e26923aULL, 0x0000000000000000ULL }, { 0xe97ccb0f7e8e2cb6ULL, 0xd35bdf5d4c27eec9ULL, 0x84a3ef53d9cb93f4ULL, 0x0000000000000000ULL },
+		{ 0xc64e7236b1f673cdULL, 0x02e83af4aea62b8dULL, 0xd274da33267294a4ULL, 0x0000000000000000ULL }, { 0xa0969f84f75f05b7ULL, 0x29d57276e743bdfeULL, 0xa7e4034cd19f956aULL, 0x0000000000000000ULL },
+		{ 0x0ae3b54f3db99f39ULL, 0x5492aaed3c711a6bULL, 0x384975cdd5b59625ULL, 0x0000000000000000ULL }, { 0x6c3b58fd7b10e943ULL, 0x7fafe26f75948c18ULL, 0x4dd9acb2225897ebULL, 0x0000000000000000ULL },
+		{ 0x5487da3dbe4921cfULL, 0xebe97da2e56e8de3ULL, 0x94fa1f0d36da9885ULL, 0x0000000000000000ULL }, { 0x325f378ff8e057b5ULL, 0xc0d43520ac8b1b90ULL, 0xe16ac672c137994bULL, 0x0000000000000000ULL },
+		{ 0x982a1d443206cd3bULL, 0xbd93edbb77b9bc05ULL, 0x7ec7b0f3c51d9a04ULL, 0x0000000000000000ULL }, { 0xfef2f0f674afbb41ULL, 0x96aea5393e5c2a76ULL, 0x0b57698c32f09bcaULL, 0x0000000000000000ULL },
+		{ 0xd1c049cfbbd7e43aULL, 0x471d4090dcddef32ULL, 0x5d805ceccd499c9aULL, 0x0000000000000000ULL }, { 0xb718a47dfd7e9240ULL, 0x6c20081295387941ULL, 0x281085933aa49d54ULL, 0x0000000000000000ULL },
+		{ 0x1d6d8eb6379808ceULL, 0x1167d0894e0aded4ULL, 0xb7bdf3123e8e9e1bULL, 0x0000000000000000ULL }, { 0x7bb5630471317eb4ULL, 0x3a5a980b07ef48a7ULL, 0xc22d2a6dc9639fd5ULL, 0x0000000000000000ULL },
+		{ 0x310a7be888aee330ULL, 0x2d180683a612ebf9ULL, 0x1e0caa2a9d7ba03fULL, 0x0000000000000000ULL }, { 0x57d2965ace07954aULL, 0x06254e01eff77d8aULL, 0x6b9c73556a96a1f1ULL, 0x0000000000000000ULL },
+		{ 0xfda7bc9104e10fc4ULL, 0x7b62969a34c5da1fULL, 0xf43105d46ebca2beULL, 0x0000000000000000ULL }, { 0x9b7f5123424879beULL, 0x505fde187d204c6cULL, 0x81a1dcab9951a370ULL, 0x0000000000000000ULL },
+		{ 0xb44de81a8d3026c5ULL, 0x81ec3bb19fa18928ULL, 0xd776e9cb66e8a420ULL, 0x0000000000000000ULL }, { 0xd29505a8cb9950bfULL, 0xaad17333d6441f5bULL, 0xa2e630b49105a5eeULL, 0x0000000000000000ULL },
+		{ 0x78e02f63017fca31ULL, 0xd796aba80d76b8ceULL, 0x3d4b4635952fa6a1ULL, 0x0000000000000000ULL }, { 0x1e38c2d147d6bc4bULL, 0xfcabe32a44932ebdULL, 0x48db9f4a62c2a76fULL, 0x0000000000000000ULL },
+		{ 0x26844011828f74c7ULL, 0x68ed7ce7d4692f46ULL, 0x91f82cf57640a801ULL, 0x0000000000000000ULL }, { 0x405cada3c42602bdULL, 0x43d034659d8cb935ULL, 0xe468f58a81ada9cfULL, 0x0000000000000000ULL },
+		{ 0xea2987680ec09833ULL, 0x3e97ecfe46be1ea0ULL, 0x7bc5830b8587aa80ULL, 0x0000000000000000ULL }, { 0x8cf16ada4869ee49ULL, 0x15aaa47c0f5b88d3ULL, 0x0e555a74726aab4eULL, 0x0000000000000000ULL },
+		{ 0xa3c3d3e38711b132ULL, 0xc41941d5edda4d97ULL, 0x58826f148dd3ac1eULL, 0x0000000000000000ULL }, { 0xc51b3e51c1b8c748ULL, 0xef240957a43fdbe4ULL, 0x2d12b66b7a3eadd0ULL, 0x0000000000000000ULL },
+		{ 0x6f6e149a0b5e5dc6ULL, 0x9263d1cc7f0d7c71ULL, 0xb2bfc0ea7e14ae9fULL, 0x0000000000000000ULL }, { 0x09b6f9284df72bbcULL, 0xb95e994e36e8ea02ULL, 0xc72f199589f9af51ULL, 0x0000000000000000ULL },
+		{ 0x1f0b0d079cecd0c3ULL, 0xa7eff24b42e47e9aULL, 0x1df9bb89560db043ULL, 0x0000000000000000ULL }, { 0x79d3e0b5da45a6b9ULL, 0x8cd2bac90b01e8e9ULL, 0x686962f6a1e0b18dULL, 0x0000000000000000ULL },
+		{ 0xd3a6ca7e10a33c37ULL, 0xf1956252d0334f7cULL, 0xf7c41477a5cab2c2ULL, 0x0000000000000000ULL }, { 0xb57e27cc560a4a4dULL, 0xdaa82ad099d6d90fULL, 0x8254cd085227b30cULL, 0x0000000000000000ULL },
+		{ 0x9a4c9ef599721536ULL, 0x0b1bcf797b571c4bULL, 0xd483f868ad9eb45cULL, 0x0000000000000000ULL }, { 0xfc947347dfdb634cULL, 0x202687fb32b28a38ULL, 0xa11321175a73b592ULL, 0x0000000000000000ULL },
+		{ 0x56e1598c153df9c2ULL, 0x5d615f60e9802dadULL, 0x3ebe57965e59b6ddULL, 0x0000000000000000ULL }, { 0x3039b43e53948fb8ULL, 0x765c17e2a065bbdeULL, 0x4b2e8ee9a9b4b713ULL, 0x0000000000000000ULL },
+		{ 0x088536fe96cd4734ULL, 0xe21a882f309fba25ULL, 0x920d3d56bd36b87dULL, 0x0000000000000000ULL }, { 0x6e5ddb4cd064314eULL, 0xc927c0ad797a2c56ULL, 0xe79de4294adbb9b3ULL, 0x0000000000000000ULL },
+		{ 0xc428f1871a82abc0ULL, 0xb4601836a2488bc3ULL, 0x783092a84ef1bafcULL, 0x0000000000000000ULL }, { 0xa2f01c355c2bddbaULL, 0x9f5d50b4ebad1db0ULL, 0x0da04bd7b91cbb32ULL, 0x0000000000000000ULL },
+		{ 0x8dc2a50c935382c1ULL, 0x4eeeb51d092cd8f4ULL, 0x5b777eb746a5bc62ULL, 0x0000000000000000ULL }, { 0xeb1a48bed5faf4bbULL, 0x65d3fd9f40c94e87ULL, 0x2ee7a7c8b148bdacULL, 0x0000000000000000ULL },
+		{ 0x416f62751f1c6e35ULL, 0x189425049bfbe912ULL, 0xb14ad149b562bee3ULL, 0x0000000000000000ULL }, { 0x27b78fc759b5184fULL, 0x33a96d86d21e7f61ULL, 0xc4da0836428fbf2dULL, 0x0000000000000000ULL },
+		{ 0xd50c52b0f03f4920ULL, 0x36100409c41cb2aeULL, 0x1408ccc71d52c02aULL, 0x0000000000000000ULL }, { 0xb3d4bf02b6963f5aULL, 0x1d2d4c8b8df924ddULL, 0x619815b8eabfc1e4ULL, 0x0000000000000000ULL },
+		{ 0x19a195c97c70a5d4ULL, 0x606a941056cb8348ULL, 0xfe356339ee95c2abULL, 0x0000000000000000ULL }, { 0x7f79787b3ad9d3aeULL, 0x4b57dc921f2e153bULL, 0x8ba5ba461978c365ULL, 0x0000000000000000ULL },
+		{ 0x504bc142f5a18cd5ULL, 0x9ae4393bfdafd07fULL, 0xdd728f26e6c1c435ULL, 0x0000000000000000ULL }, { 0x36932cf0b308faafULL, 0xb1d971b9b44a460cULL, 0xa8e25659112cc5fbULL, 0x0000000000000000ULL },
+		{ 0x9ce6063b79ee6021ULL, 0xcc9ea9226f78e199ULL, 0x374f20d81506c6b4ULL, 0x0000000000000000ULL }, { 0xfa3eeb893f47165bULL, 0xe7a3e1a0269d77eaULL, 0x42dff9a7e2ebc77aULL, 0x0000000000000000ULL },
+		{ 0xc2826949fa1eded7ULL, 0x73e57e6db6677611ULL, 0x9bfc4a18f669c814ULL, 0x0000000000000000ULL }, { 0xa45a84fbbcb7a8adULL, 0x58d836efff82e062ULL, 0xee6c93670184c9daULL, 0x0000000000000000ULL },
+		{ 0x0e2fae3076513223ULL, 0x259fee7424b047f7ULL, 0x71c1e5e605aeca95ULL, 0x0000000000000000ULL }, { 0x68f7438230f84459ULL, 0x0ea2a6f66d55d184ULL, 0x04513c99f243cb5bULL, 0x0000000000000000ULL },
+		{ 0x47c5fabbff801b22ULL, 0xdf11435f8fd414c0ULL, 0x528609f90dfacc0bULL, 0x0000000000000000ULL }, { 0x211d1709b9296d58ULL, 0xf42c0bddc63182b3ULL, 0x2716d086fa17cdc5ULL, 0x0000000000000000ULL },
+		{ 0x8b683dc273cff7d6ULL, 0x896bd3461d032526ULL, 0xb8bba607fe3dce8aULL, 0x0000000000000000ULL }, { 0xedb0d070356681acULL, 0xa2569bc454e6b355ULL, 0xcd2b7f7809d0cf44ULL, 0x0000000000000000ULL },
+		{ 0xfb0d245fe47d7ad3ULL, 0xbce7f0c120ea27cdULL, 0x17fddd64d624d056ULL, 0x0000000000000000ULL }, { 0x9dd5c9eda2d40ca9ULL, 0x97dab843690fb1beULL, 0x626d041b21c9d198ULL, 0x0000000000000000ULL },
+		{ 0x37a0e32668329627ULL, 0xea9d60d8b23d162bULL, 0xfdc0729a25e3d2d7ULL, 0x0000000000000000ULL }, { 0x51780e942e9be05dULL, 0xc1a0285afbd88058ULL, 0x8850abe5d20ed319ULL, 0x0000000000000000ULL },
+		{ 0x7e4ab7ade1e3bf26ULL, 0x1013cdf31959451cULL, 0xde879e852db7d449ULL, 0x0000000000000000ULL }, { 0x18925a1fa74ac95cULL, 0x3b2e857150bcd36fULL, 0xab1747fada5ad587ULL, 0x0000000000000000ULL },
+		{ 0xb2e770d46dac53d2ULL, 0x46695dea8b8e74faULL, 0x34ba317bde70d6c8ULL, 0x0000000000000000ULL }, { 0xd43f9d662b0525a8ULL, 0x6d541568c26be289ULL, 0x412ae804299dd706ULL, 0x0000000000000000ULL },
+		{ 0xec831fa6ee5ced24ULL, 0xf9128aa55291e372ULL, 0x98095bbb3d1fd868ULL, 0x0000000000000000ULL }, { 0x8a5bf214a8f59b5eULL, 0xd22fc2271b747501ULL, 0xed9982c4caf2d9a6ULL, 0x0000000000000000ULL },
+		{ 0x202ed8df621301d0ULL, 0xaf681abcc046d294ULL, 0x7234f445ced8dae9ULL, 0x0000000000000000ULL }, { 0x46f6356d24ba77aaULL, 0x8455523e89a344e7ULL, 0x07a42d3a3935db27ULL, 0x0000000000000000ULL },
+		{ 0x69c48c54ebc228d1ULL, 0x55e6b7976b2281a3ULL, 0x5173185ac68cdc77ULL, 0x0000000000000000ULL }, { 0x0f1c61e6ad6b5eabULL, 0x7edbff1522c717d0ULL, 0x24e3c1253161ddb9ULL, 0x0000000000000000ULL },
+		{ 0xa5694b2d678dc425ULL, 0x039c278ef9f5b045ULL, 0xbb4eb7a4354bdef6ULL, 0x0000000000000000ULL }, { 0xc3b1a69f2124b25fULL, 0x28a16f0cb0102636ULL, 0xcede6edbc2a6df38ULL, 0x0000000000000000ULL },
+		{ 0x890ebe73d8bb2fdbULL, 0x3fe3f18411ed8568ULL, 0x12ffee9c96bee0d2ULL, 0x0000000000000000ULL }, { 0xefd653c19e1259a1ULL, 0x14deb9065808131bULL, 0x676f37e36153e11cULL, 0x0000000000000000ULL },
+		{ 0x45a3790a54f4c32fULL, 0x6999619d833ab48eULL, 0xf8c241626579e253ULL, 0x0000000000000000ULL }, { 0x237b94b8125db555ULL, 0x42a4291fcadf22fdULL, 0x8d52981d9294e39dULL, 0x0000000000000000ULL },
+		{ 0x0c492d81dd25ea2eULL, 0x9317ccb6285ee7b9ULL, 0xdb85ad7d6d2de4cdULL, 0x0000000000000000ULL }, { 0x6a91c0339b8c9c54ULL, 0xb82a843461bb71caULL, 0xae1574029ac0e503ULL, 0x0000000000000000ULL },
+		{ 0xc0e4eaf8516a06daULL, 0xc56d5cafba89d65fULL, 0x31b802839eeae64cULL, 0x0000000000000000ULL }, { 0xa63c074a17c370a0ULL, 0xee50142df36c402cULL, 0x4428dbfc6907e782ULL, 0x0000000000000000ULL },
+		{ 0x9e80858ad29ab82cULL, 0x7a168be0639641d7ULL, 0x9d0b68437d85e8ecULL, 0x0000000000000000ULL }, { 0xf85868389433ce56ULL, 0x512bc3622a73d7a4ULL, 0xe89bb13c8a68e922ULL, 0x0000000000000000ULL },
+		{ 0x522d42f35ed554d8ULL, 0x2c6c1bf9f1417031ULL, 0x7736c7bd8e42ea6dULL, 0x0000000000000000ULL }, { 0x34f5af41187c22a2ULL, 0x0751537bb8a4e642ULL, 0x02a61ec279afeba3ULL, 0x0000000000000000ULL },
+		{ 0x1bc71678d7047dd9ULL, 0xd6e2b6d25a252306ULL, 0x54712ba28616ecf3ULL, 0x0000000000000000ULL }, { 0x7d1ffbca91ad0ba3ULL, 0xfddffe5013c0b575ULL, 0x21e1f2dd71fbed3dULL, 0x0000000000000000ULL },
+		{ 0xd76ad1015b4b912dULL, 0x809826cbc8f212e0ULL, 0xbe4c845c75d1ee72ULL, 0x0000000000000000ULL }, { 0xb1b23cb31de2e757ULL, 0xaba56e4981178493ULL, 0xcbdc5d23823cefbcULL, 0x0000000000000000ULL },
+		{ 0xa70fc89cccf91c28ULL, 0xb514054cf51b100bULL, 0x110aff3f5dc8f0aeULL, 0x0000000000000000ULL }, { 0xc1d7252e8a506a52ULL, 0x9e294dcebcfe8678ULL, 0x649a2640aa25f160ULL, 0x0000000000000000ULL },
+		{ 0x6ba20fe540b6f0dcULL, 0xe36e955567cc21edULL, 0xfb3750c1ae0ff22fULL, 0x0000000000000000ULL }, { 0x0d7ae257061f86a6ULL, 0xc853ddd72e29b79eULL, 0x8ea789be59e2f3e1ULL, 0x0000000000000000ULL },
+		{ 0x22485b6ec967d9ddULL, 0x19e0387ecca872daULL, 0xd870bcdea65bf4b1ULL, 0x0000000000000000ULL }, { 0x4490b6dc8fceafa7ULL, 0x32dd70fc854de4a9ULL, 0xade065a151b6f57fULL, 0x0000000000000000ULL },
+		{ 0xeee59c1745283529ULL, 0x4f9aa8675e7f433cULL, 0x324d1320559cf630ULL, 0x0000000000000000ULL }, { 0x883d71a503814353ULL, 0x64a7e0e5179ad54fULL, 0x47ddca5fa271f7feULL, 0x0000000000000000ULL },
+		{ 0xb081f365c6d88bdfULL, 0xf0e17f288760d4b4ULL, 0x9efe79e0b6f3f890ULL, 0x0000000000000000ULL }, { 0xd6591ed78071fda5ULL, 0xdbdc37aace8542c7ULL, 0xeb6ea09f411ef95eULL, 0x0000000000000000ULL },
+		{ 0x7c2c341c4a97672bULL, 0xa69bef3115b7e552ULL, 0x74c3d61e4534fa11ULL, 0x0000000000000000ULL }, { 0x1af4d9ae0c3e1151ULL, 0x8da6a7b35c527321ULL, 0x01530f61b2d9fbdfULL, 0x0000000000000000ULL },
+		{ 0x35c66097c3464e2aULL, 0x5c15421abed3b665ULL, 0x57843a014d60fc8fULL, 0x0000000000000000ULL }, { 0x531e8d2585ef3850ULL, 0x77280a98f7362016ULL, 0x2214e37eba8dfd41ULL, 0x0000000000000000ULL },
+		{ 0xf96ba7ee4f09a2deULL, 0x0a6fd2032c048783ULL, 0xbdb995ffbea7fe0eULL, 0x0000000000000000ULL }, { 0x9fb34a5c09a0d4a4ULL, 0x21529a8165e111f0ULL, 0xc8294c80494affc0ULL, 0x0000000000000000ULL },
+	},
+	{ // 26
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x98c7628804b733f6ULL, 0x75d1289118ce384dULL, 0x4d92904644872ae9ULL, 0x0000000000005e2bULL },
+		{ 0x2d93c40d087366f1ULL, 0xeabf503f3081709aULL, 0x9a393d8c881354cfULL, 0x000000000000bc56ULL }, { 0xb554a6850cc45507ULL, 0x9f6e78ae284f48d7ULL, 0xd7abadcacc947e26ULL, 0x000000000000e27dULL },
+		{ 0x5a3b951a10e6ccffULL, 0xc963a07e601fe029ULL, 0x29727a050d26a883ULL, 0x00000000000065acULL }, { 0xc2fcf7921451ff09ULL, 0xbcb288ef78d1d864ULL, 0x64e0ea4349a1826aULL, 0x0000000000003b87ULL },
+		{ 0x77a851171895aa0eULL, 0x23dcf041509e90b3ULL, 0xb34b47898535fc4cULL, 0x000000000000d9faULL }, { 0xef6f339f1c2299f8ULL, 0x560dd8d04850a8feULL, 0xfed9d7cfc1b2d6a5ULL, 0x00000000000087d1ULL },
+		{ 0xb476373420d185e3ULL, 0x8fc65dfcc03edd52ULL, 0x52e4f40a1a4c4d1bULL, 0x000000000000ca45ULL }, { 0x2cb155bc2466b615ULL, 0xfa17756dd8f0e51fULL, 0x1f76644c5ecb67f2ULL, 0x000000000000946eULL },
+		{ 0x99e5f33928a2e312ULL, 0x65790dc3f0bfadc8ULL, 0xc8ddc986925f19d4ULL, 0x0000000000007613ULL }, { 0x012291b12c15d0e4ULL, 0x10a82552e8719585ULL, 0x854f59c0d6d8333dULL, 0x0000000000002838ULL },
+		{ 0xee4da22e3037491cULL, 0x46a5fd82a0213d7bULL, 0x7b968e0f176ae598ULL, 0x000000000000afe9ULL }, { 0x768ac0a634807aeaULL, 0x3374d513b8ef0536ULL, 0x36041e4953edcf71ULL, 0x000000000000f1c2ULL },
+		{ 0xc3de662338442fedULL, 0xac1aadbd90a04de1ULL, 0xe1afb3839f79b157ULL, 0x00000000000013bfULL }, { 0x5b1904ab3cf31c1bULL, 0xd9cb852c886e75acULL, 0xac3d23c5dbfe9bbeULL, 0x0000000000004d94ULL },
+		{ 0x75ec6e6840bf17dbULL, 0x0391bae59d7ca7a4ULL, 0xa4d5f51434989a36ULL, 0x000000000000898aULL }, { 0xed2b0ce04408242dULL, 0x7640927485b29fe9ULL, 0xe9476552701fb0dfULL, 0x000000000000d7a1ULL },
+		{ 0x587faa6548cc712aULL, 0xe92eeadaadfdd73eULL, 0x3eecc898bc8bcef9ULL, 0x00000000000035dcULL }, { 0xc0b8c8ed4c7b42dcULL, 0x9cffc24bb533ef73ULL, 0x737e58def80ce410ULL, 0x0000000000006bf7ULL },
+		{ 0x2fd7fb725059db24ULL, 0xcaf21a9bfd63478dULL, 0x8da78f1139be32b5ULL, 0x000000000000ec26ULL }, { 0xb71099fa54eee8d2ULL, 0xbf23320ae5ad7fc0ULL, 0xc0351f577d39185cULL, 0x000000000000b20dULL },
+		{ 0x02443f7f582abdd5ULL, 0x204d4aa4cde23717ULL, 0x179eb29db1ad667aULL, 0x0000000000005070ULL }, { 0x9a835df75c9d8e23ULL, 0x559c6235d52c0f5aULL, 0x5a0c22dbf52a4c93ULL, 0x0000000000000e5bULL },
+		{ 0xc19a595c606e9238ULL, 0x8c57e7195d427af6ULL, 0xf631011e2ed4d72dULL, 0x00000000000043cfULL }, { 0x595d3bd464d9a1ceULL, 0xf986cf88458c42bbULL, 0xbba391586a53fdc4ULL, 0x0000000000001de4ULL },
+		{ 0xec099d51681df4c9ULL, 0x66e8b7266dc30a6cULL, 0x6c083c92a6c783e2ULL, 0x000000000000ff99ULL }, { 0x74ceffd96caac73fULL, 0x13399fb7750d3221ULL, 0x219aacd4e240a90bULL, 0x000000000000a1b2ULL },
+		{ 0x9ba1cc4670885ec7ULL, 0x453447673d5d9adfULL, 0xdf437b1b23f27faeULL, 0x0000000000002663ULL }, { 0x0366aece743f6d31ULL, 0x30e56ff62593a292ULL, 0x92d1eb5d67755547ULL, 0x0000000000007848ULL },
+		{ 0xb632084b78fb3836ULL, 0xaf8b17580ddcea45ULL, 0x457a4697abe12b61ULL, 0x0000000000009a35ULL }, { 0x2ef56ac37c4c0bc0ULL, 0xda5a3fc91512d208ULL, 0x08e8d6d1ef660188ULL, 0x000000000000c41eULL },
+		{ 0xeac5dcd080632eabULL, 0x063f69d727f85355ULL, 0x55b7f728682d296cULL, 0x0000000000000f09ULL }, { 0x7202be5884d41d5dULL, 0x73ee41463f366b18ULL, 0x1825676e2caa0385ULL, 0x0000000000005122ULL },
+		{ 0xc75618dd8810485aULL, 0xec8039e8177923cfULL, 0xcf8ecaa4e03e7da3ULL, 0x000000000000b35fULL }, { 0x5f917a558ca77bacULL, 0x995111790fb71b82ULL, 0x821c5ae2a4b9574aULL, 0x000000000000ed74ULL },
+		{ 0xb0fe49ca9085e254ULL, 0xcf5cc9a947e7b37cULL, 0x7cc58d2d650b81efULL, 0x0000000000006aa5ULL }, { 0x28392b429432d1a2ULL, 0xba8de1385f298b31ULL, 0x31571d6b218cab06ULL, 0x000000000000348eULL },
+		{ 0x9d6d8dc798f684a5ULL, 0x25e399967766c3e6ULL, 0xe6fcb0a1ed18d520ULL, 0x000000000000d6f3ULL }, { 0x05aaef4f9c41b753ULL, 0x5032b1076fa8fbabULL, 0xab6e20e7a99fffc9ULL, 0x00000000000088d8ULL },
+		{ 0x5eb3ebe4a0b2ab48ULL, 0x89f9342be7c68e07ULL, 0x0753032272616477ULL, 0x000000000000c54cULL }, { 0xc674896ca40598beULL, 0xfc281cbaff08b64aULL, 0x4ac1936436e64e9eULL, 0x0000000000009b67ULL },
+		{ 0x73202fe9a8c1cdb9ULL, 0x63466414d747fe9dULL, 0x9d6a3eaefa7230b8ULL, 0x000000000000791aULL }, { 0xebe74d61ac76fe4fULL, 0x16974c85cf89c6d0ULL, 0xd0f8aee8bef51a51ULL, 0x0000000000002731ULL },
+		{ 0x04887efeb05467b7ULL, 0x409a945587d96e2eULL, 0x2e2179277f47ccf4ULL, 0x000000000000a0e0ULL }, { 0x9c4f1c76b4e35441ULL, 0x354bbcc49f175663ULL, 0x63b3e9613bc0e61dULL, 0x000000000000fecbULL },
+		{ 0x291bbaf3b8270146ULL, 0xaa25c46ab7581eb4ULL, 0xb41844abf754983bULL, 0x0000000000001cb6ULL }, { 0xb1dcd87bbc9032b0ULL, 0xdff4ecfbaf9626f9ULL, 0xf98ad4edb3d3b2d2ULL, 0x000000000000429dULL },
+		{ 0x9f29b2b8c0dc3970ULL, 0x05aed332ba84f4f1ULL, 0xf162023c5cb5b35aULL, 0x0000000000008683ULL }, { 0x07eed030c46b0a86ULL, 0x707ffba3a24accbcULL, 0xbcf0927a183299b3ULL, 0x000000000000d8a8ULL },
+		{ 0xb2ba76b5c8af5f81ULL, 0xef11830d8a05846bULL, 0x6b5b3fb0d4a6e795ULL, 0x0000000000003ad5ULL }, { 0x2a7d143dcc186c77ULL, 0x9ac0ab9c92cbbc26ULL, 0x26c9aff69021cd7cULL, 0x00000000000064feULL },
+		{ 0xc51227a2d03af58fULL, 0xcccd734cda9b14d8ULL, 0xd810783951931bd9ULL, 0x000000000000e32fULL }, { 0x5dd5452ad48dc679ULL, 0xb91c5bddc2552c95ULL, 0x9582e87f15143130ULL, 0x000000000000bd04ULL },
+		{ 0xe881e3afd849937eULL, 0x26722373ea1a6442ULL, 0x422945b5d9804f16ULL, 0x0000000000005f79ULL }, { 0x70468127dcfea088ULL, 0x53a30be2f2d45c0fULL, 0x0fbbd5f39d0765ffULL, 0x0000000000000152ULL },
+		{ 0x2b5f858ce00dbc93ULL, 0x8a688ece7aba29a3ULL, 0xa386f63646f9fe41ULL, 0x0000000000004cc6ULL }, { 0xb398e704e4ba8f65ULL, 0xffb9a65f627411eeULL, 0xee146670027ed4a8ULL, 0x00000000000012edULL },
+		{ 0x06cc4181e87eda62ULL, 0x60d7def14a3b5939ULL, 0x39bfcbbaceeaaa8eULL, 0x000000000000f090ULL }, { 0x9e0b2309ecc9e994ULL, 0x1506f66052f56174ULL, 0x742d5bfc8a6d8067ULL, 0x000000000000aebbULL },
+		{ 0x71641096f0eb706cULL, 0x430b2eb01aa5c98aULL, 0x8af48c334bdf56c2ULL, 0x000000000000296aULL }, { 0xe9a3721ef45c439aULL, 0x36da0621026bf1c7ULL, 0xc7661c750f587c2bULL, 0x0000000000007741ULL },
+		{ 0x5cf7d49bf898169dULL, 0xa9b47e8f2a24b910ULL, 0x10cdb1bfc3cc020dULL, 0x000000000000953cULL }, { 0xc430b613fc2f256bULL, 0xdc65561e32ea815dULL, 0x5d5f21f9874b28e4ULL, 0x000000000000cb17ULL },
+		{ 0xc997a5bd1dc65c4bULL, 0x0c7ed2b34eeda6aaULL, 0xaa73f350d05a52d8ULL, 0x0000000000001e12ULL }, { 0x5150c73519716fbdULL, 0x79affa2256239ee7ULL, 0xe7e1631694dd7831ULL, 0x0000000000004039ULL },
+		{ 0xe40461b015b53abaULL, 0xe6c1828c7e6cd630ULL, 0x304acedc58490617ULL, 0x000000000000a244ULL }, { 0x7cc303381102094cULL, 0x9310aa1d66a2ee7dULL, 0x7dd85e9a1cce2cfeULL, 0x000000000000fc6fULL },
+		{ 0x93ac30a70d2090b4ULL, 0xc51d72cd2ef24683ULL, 0x83018955dd7cfa5bULL, 0x0000000000007bbeULL }, { 0x0b6b522f0997a342ULL, 0xb0cc5a5c363c7eceULL, 0xce93191399fbd0b2ULL, 0x0000000000002595ULL },
+		{ 0xbe3ff4aa0553f645ULL, 0x2fa222f21e733619ULL, 0x1938b4d9556fae94ULL, 0x000000000000c7e8ULL }, { 0x26f8962201e4c5b3ULL, 0x5a730a6306bd0e54ULL, 0x54aa249f11e8847dULL, 0x00000000000099c3ULL },
+		{ 0x7de192893d17d9a8ULL, 0x83b88f4f8ed37bf8ULL, 0xf897075aca161fc3ULL, 0x000000000000d457ULL }, { 0xe526f00139a0ea5eULL, 0xf669a7de961d43b5ULL, 0xb505971c8e91352aULL, 0x0000000000008a7cULL },
+		{ 0x507256843564bf59ULL, 0x6907df70be520b62ULL, 0x62ae3ad642054b0cULL, 0x0000000000006801ULL }, { 0xc8b5340c31d38cafULL, 0x1cd6f7e1a69c332fULL, 0x2f3caa90068261e5ULL, 0x000000000000362aULL },
+		{ 0x27da07932df11557ULL, 0x4adb2f31eecc9bd1ULL, 0xd1e57d5fc730b740ULL, 0x000000000000b1fbULL }, { 0xbf1d651b294626a1ULL, 0x3f0a07a0f602a39cULL, 0x9c77ed1983b79da9ULL, 0x000000000000efd0ULL },
+		{ 0x0a49c39e258273a6ULL, 0xa0647f0ede4deb4bULL, 0x4bdc40d34f23e38fULL, 0x0000000000000dadULL }, { 0x928ea11621354050ULL, 0xd5b5579fc683d306ULL, 0x064ed0950ba4c966ULL, 0x0000000000005386ULL },
+		{ 0xbc7bcbd55d794b90ULL, 0x0fef6856d391010eULL, 0x0ea60644e4c2c8eeULL, 0x0000000000009798ULL }, { 0x24bca95d59ce7866ULL, 0x7a3e40c7cb5f3943ULL, 0x43349602a045e207ULL, 0x000000000000c9b3ULL },
+		{ 0x91e80fd8550a2d61ULL, 0xe5503869e3107194ULL, 0x949f3bc86cd19c21ULL, 0x0000000000002bceULL }, { 0x092f6d5051bd1e97ULL, 0x908110f8fbde49d9ULL, 0xd90dab8e2856b6c8ULL, 0x00000000000075e5ULL },
+		{ 0xe6405ecf4d9f876fULL, 0xc68cc828b38ee127ULL, 0x27d47c41e9e4606dULL, 0x000000000000f234ULL }, { 0x7e873c474928b499ULL, 0xb35de0b9ab40d96aULL, 0x6a46ec07ad634a84ULL, 0x000000000000ac1fULL },
+		{ 0xcbd39ac245ece19eULL, 0x2c339817830f91bdULL, 0xbded41cd61f734a2ULL, 0x0000000000004e62ULL }, { 0x5314f84a415bd268ULL, 0x59e2b0869bc1a9f0ULL, 0xf07fd18b25701e4bULL, 0x0000000000001049ULL },
+		{ 0x080dfce17da8ce73ULL, 0x802935aa13afdc5cULL, 0x5c42f24efe8e85f5ULL, 0x0000000000005dddULL }, { 0x90ca9e69791ffd85ULL, 0xf5f81d3b0b61e411ULL, 0x11d06208ba09af1cULL, 0x00000000000003f6ULL },
+		{ 0x259e38ec75dba882ULL, 0x6a966595232eacc6ULL, 0xc67bcfc2769dd13aULL, 0x000000000000e18bULL }, { 0xbd595a64716c9b74ULL, 0x1f474d043be0948bULL, 0x8be95f84321afbd3ULL, 0x000000000000bfa0ULL },
+		{ 0x523669fb6d4e028cULL, 0x494a95d473b03c75ULL, 0x7530884bf3a82d76ULL, 0x0000000000003871ULL }, { 0xcaf10b7369f9317aULL, 0x3c9bbd456b7e0438ULL, 0x38a2180db72f079fULL, 0x000000000000665aULL },
+		{ 0x7fa5adf6653d647dULL, 0xa3f5c5eb43314cefULL, 0xef09b5c77bbb79b9ULL, 0x0000000000008427ULL }, { 0xe762cf7e618a578bULL, 0xd624ed7a5bff74a2ULL, 0xa29b25813f3c5350ULL, 0x000000000000da0cULL },
+		{ 0x2352796d9da572e0ULL, 0x0a41bb646915f5ffULL, 0xffc40478b8777bb4ULL, 0x000000000000111bULL }, { 0xbb951be599124116ULL, 0x7f9093f571dbcdb2ULL, 0xb256943efcf0515dULL, 0x0000000000004f30ULL },
+		{ 0x0ec1bd6095d61411ULL, 0xe0feeb5b59948565ULL, 0x65fd39f430642f7bULL, 0x000000000000ad4dULL }, { 0x9606dfe8916127e7ULL, 0x952fc3ca415abd28ULL, 0x286fa9b274e30592ULL, 0x000000000000f366ULL },
+		{ 0x7969ec778d43be1fULL, 0xc3221b1a090a15d6ULL, 0xd6b67e7db551d337ULL, 0x00000000000074b7ULL }, { 0xe1ae8eff89f48de9ULL, 0xb6f3338b11c42d9bULL, 0x9b24ee3bf1d6f9deULL, 0x0000000000002a9cULL },
+		{ 0x54fa287a8530d8eeULL, 0x299d4b25398b654cULL, 0x4c8f43f13d4287f8ULL, 0x000000000000c8e1ULL }, { 0xcc3d4af28187eb18ULL, 0x5c4c63b421455d01ULL, 0x011dd3b779c5ad11ULL, 0x00000000000096caULL },
+		{ 0x97244e59bd74f703ULL, 0x8587e698a92b28adULL, 0xad20f072a23b36afULL, 0x000000000000db5eULL }, { 0x0fe32cd1b9c3c4f5ULL, 0xf056ce09b1e510e0ULL, 0xe0b26034e6bc1c46ULL, 0x0000000000008575ULL },
+		{ 0xbab78a54b50791f2ULL, 0x6f38b6a799aa5837ULL, 0x3719cdfe2a286260ULL, 0x0000000000006708ULL }, { 0x2270e8dcb1b0a204ULL, 0x1ae99e368164607aULL, 0x7a8b5db86eaf4889ULL, 0x0000000000003923ULL },
+		{ 0xcd1fdb43ad923bfcULL, 0x4ce446e6c934c884ULL, 0x84528a77af1d9e2cULL, 0x000000000000bef2ULL }, { 0x55d8b9cba925080aULL, 0x39356e77d1faf0c9ULL, 0xc9c01a31eb9ab4c5ULL, 0x000000000000e0d9ULL },
+		{ 0xe08c1f4ea5e15d0dULL, 0xa65b16d9f9b5b81eULL, 0x1e6bb7fb270ecae3ULL, 0x00000000000002a4ULL }, { 0x784b7dc6a1566efbULL, 0xd38a3e48e17b8053ULL, 0x53f927bd6389e00aULL, 0x0000000000005c8fULL },
+		{ 0x56be1705dd1a653bULL, 0x09d00181f469525bULL, 0x5b11f16c8cefe182ULL, 0x0000000000009891ULL }, { 0xce79758dd9ad56cdULL, 0x7c012910eca76a16ULL, 0x1683612ac868cb6bULL, 0x000000000000c6baULL },
+		{ 0x7b2dd308d56903caULL, 0xe36f51bec4e822c1ULL, 0xc128cce004fcb54dULL, 0x00000000000024c7ULL }, { 0xe3eab180d1de303cULL, 0x96be792fdc261a8cULL, 0x8cba5ca6407b9fa4ULL, 0x0000000000007aecULL },
+		{ 0x0c85821fcdfca9c4ULL, 0xc0b3a1ff9476b272ULL, 0x72638b6981c94901ULL, 0x000000000000fd3dULL }, { 0x9442e097c94b9a32ULL, 0xb562896e8cb88a3fULL, 0x3ff11b2fc54e63e8ULL, 0x000000000000a316ULL },
+		{ 0x21164612c58fcf35ULL, 0x2a0cf1c0a4f7c2e8ULL, 0xe85ab6e509da1dceULL, 0x000000000000416bULL }, { 0xb9d1249ac138fcc3ULL, 0x5fddd951bc39faa5ULL, 0xa5c826a34d5d3727ULL, 0x0000000000001f40ULL },
+		{ 0xe2c82031fdcbe0d8ULL, 0x86165c7d34578f09ULL, 0x09f5056696a3ac99ULL, 0x00000000000052d4ULL }, { 0x7a0f42b9f97cd32eULL, 0xf3c774ec2c99b744ULL, 0x44679520d2248670ULL, 0x0000000000000cffULL },
+		{ 0xcf5be43cf5b88629ULL, 0x6ca90c4204d6ff93ULL, 0x93cc38ea1eb0f856ULL, 0x000000000000ee82ULL }, { 0x579c86b4f10fb5dfULL, 0x197824d31c18c7deULL, 0xde5ea8ac5a37d2bfULL, 0x000000000000b0a9ULL },
+		{ 0xb8f3b52bed2d2c27ULL, 0x4f75fc0354486f20ULL, 0x20877f639b85041aULL, 0x0000000000003778ULL }, { 0x2034d7a3e99a1fd1ULL, 0x3aa4d4924c86576dULL, 0x6d15ef25df022ef3ULL, 0x0000000000006953ULL },
+		{ 0x95607126e55e4ad6ULL, 0xa5caac3c64c91fbaULL, 0xbabe42ef139650d5ULL, 0x0000000000008b2eULL }, { 0x0da713aee1e97920ULL, 0xd01b84ad7c0727f7ULL, 0xf72cd2a957117a3cULL, 0x000000000000d505ULL },
+		{ 0x8f3357673a91b896ULL, 0x18fcb97b9cc75149ULL, 0x49e6fba0bdb4a4adULL, 0x0000000000003c24ULL }, { 0x17f435ef3e268b60ULL, 0x6d2d91ea84096904ULL, 0x04746be6f9338e44ULL, 0x000000000000620fULL },
+		{ 0xa2a0936a32e2de67ULL, 0xf243e944ac4621d3ULL, 0xd3dfc62c35a7f062ULL, 0x0000000000008072ULL }, { 0x3a67f1e23655ed91ULL, 0x8792c1d5b488199eULL, 0x9e4d566a7120da8bULL, 0x000000000000de59ULL },
+		{ 0xd508c27d2a777469ULL, 0xd19f1905fcd8b160ULL, 0x609481a5b0920c2eULL, 0x0000000000005988ULL }, { 0x4dcfa0f52ec0479fULL, 0xa44e3194e416892dULL, 0x2d0611e3f41526c7ULL, 0x00000000000007a3ULL },
+		{ 0xf89b067022041298ULL, 0x3b20493acc59c1faULL, 0xfaadbc29388158e1ULL, 0x000000000000e5deULL }, { 0x605c64f826b3216eULL, 0x4ef161abd497f9b7ULL, 0xb73f2c6f7c067208ULL, 0x000000000000bbf5ULL },
+		{ 0x3b4560531a403d75ULL, 0x973ae4875cf98c1bULL, 0x1b020faaa7f8e9b6ULL, 0x000000000000f661ULL }, { 0xa38202db1ef70e83ULL, 0xe2ebcc164437b456ULL, 0x56909fece37fc35fULL, 0x000000000000a84aULL },
+		{ 0x16d6a45e12335b84ULL, 0x7d85b4b86c78fc81ULL, 0x813b32262febbd79ULL, 0x0000000000004a37ULL }, { 0x8e11c6d616846872ULL, 0x08549c2974b6c4ccULL, 0xcca9a2606b6c9790ULL, 0x000000000000141cULL },
+		{ 0x617ef5490aa6f18aULL, 0x5e5944f93ce66c32ULL, 0x327075afaade4135ULL, 0x00000000000093cdULL }, { 0xf9b997c10e11c27cULL, 0x2b886c682428547fULL, 0x7fe2e5e9ee596bdcULL, 0x000000000000cde6ULL },
+		{ 0x4ced314402d5977bULL, 0xb4e614c60c671ca8ULL, 0xa849482322cd15faULL, 0x0000000000002f9bULL }, { 0xd42a53cc0662a48dULL, 0xc1373c5714a924e5ULL, 0xe5dbd865664a3f13ULL, 0x00000000000071b0ULL },
+		{ 0xfadf390f7a2eaf4dULL, 0x1b6d039e01bbf6edULL, 0xed330eb4892c3e9bULL, 0x000000000000b5aeULL }, { 0x62185b877e999cbbULL, 0x6ebc2b0f1975cea0ULL, 0xa0a19ef2cdab1472ULL, 0x000000000000eb85ULL },
+		{ 0xd74cfd02725dc9bcULL, 0xf1d253a1313a8677ULL, 0x770a3338013f6a54ULL, 0x00000000000009f8ULL }, { 0x4f8b9f8a76eafa4aULL, 0x84037b3029f4be3aULL, 0x3a98a37e45b840bdULL, 0x00000000000057d3ULL },
+		{ 0xa0e4ac156ac863b2ULL, 0xd20ea3e061a416c4ULL, 0xc44174b1840a9618ULL, 0x000000000000d002ULL }, { 0x3823ce9d6e7f5044ULL, 0xa7df8b71796a2e89ULL, 0x89d3e4f7c08dbcf1ULL, 0x0000000000008e29ULL },
+		{ 0x8d77681862bb0543ULL, 0x38b1f3df5125665eULL, 0x5e78493d0c19c2d7ULL, 0x0000000000006c54ULL }, { 0x15b00a90660c36b5ULL, 0x4d60db4e49eb5e13ULL, 0x13ead97b489ee83eULL, 0x000000000000327fULL },
+		{ 0x4ea90e3b5aff2aaeULL, 0x94ab5e62c1852bbfULL, 0xbfd7fabe93607380ULL, 0x0000000000007febULL }, { 0xd66e6cb35e481958ULL, 0xe17a76f3d94b13f2ULL, 0xf2456af8d7e75969ULL, 0x00000000000021c0ULL },
+		{ 0x633aca36528c4c5fULL, 0x7e140e5df1045b25ULL, 0x25eec7321b73274fULL, 0x000000000000c3bdULL }, { 0xfbfda8be563b7fa9ULL, 0x0bc526cce9ca6368ULL, 0x687c57745ff40da6ULL, 0x0000000000009d96ULL },
+		{ 0x14929b214a19e651ULL, 0x5dc8fe1ca19acb96ULL, 0x96a580bb9e46db03ULL, 0x0000000000001a47ULL }, { 0x8c55f9a94eaed5a7ULL, 0x2819d68db954f3dbULL, 0xdb3710fddac1f1eaULL, 0x000000000000446cULL },
+		{ 0x39015f2c426a80a0ULL, 0xb777ae23911bbb0cULL, 0x0c9cbd3716558fccULL, 0x000000000000a611ULL }, { 0xa1c63da446ddb356ULL, 0xc2a686b289d58341ULL, 0x410e2d7152d2a525ULL, 0x000000000000f83aULL },
+		{ 0x65f68bb7baf2963dULL, 0x1ec3d0acbb3f021cULL, 0x1c510c88d5998dc1ULL, 0x000000000000332dULL }, { 0xfd31e93fbe45a5cbULL, 0x6b12f83da3f13a51ULL, 0x51c39cce911ea728ULL, 0x0000000000006d06ULL },
+		{ 0x48654fbab281f0ccULL, 0xf47c80938bbe7286ULL, 0x866831045d8ad90eULL, 0x0000000000008f7bULL }, { 0xd0a22d32b636c33aULL, 0x81ada80293704acbULL, 0xcbfaa142190df3e7ULL, 0x000000000000d150ULL },
+		{ 0x3fcd1eadaa145ac2ULL, 0xd7a070d2db20e235ULL, 0x3523768dd8bf2542ULL, 0x0000000000005681ULL }, { 0xa70a7c25aea36934ULL, 0xa2715843c3eeda78ULL, 0x78b1e6cb9c380fabULL, 0x00000000000008aaULL },
+		{ 0x125edaa0a2673c33ULL, 0x3d1f20edeba192afULL, 0xaf1a4b0150ac718dULL, 0x000000000000ead7ULL }, { 0x8a99b828a6d00fc5ULL, 0x48ce087cf36faae2ULL, 0xe288db47142b5b64ULL, 0x000000000000b4fcULL },
+		{ 0xd180bc839a2313deULL, 0x91058d507b01df4eULL, 0x4eb5f882cfd5c0daULL, 0x000000000000f968ULL }, { 0x4947de0b9e942028ULL, 0xe4d4a5c163cfe703ULL, 0x032768c48b52ea33ULL, 0x000000000000a743ULL },
+		{ 0xfc13788e9250752fULL, 0x7bbadd6f4b80afd4ULL, 0xd48cc50e47c69415ULL, 0x000000000000453eULL }, { 0x64d41a0696e746d9ULL, 0x0e6bf5fe534e9799ULL, 0x991e55480341befcULL, 0x0000000000001b15ULL },
+		{ 0x8bbb29998ac5df21ULL, 0x58662d2e1b1e3f67ULL, 0x67c78287c2f36859ULL, 0x0000000000009cc4ULL }, { 0x137c4b118e72ecd7ULL, 0x2db705bf03d0072aULL, 0x2a5512c1867442b0ULL, 0x000000000000c2efULL },
+		{ 0xa628ed9482b6b9d0ULL, 0xb2d97d112b9f4ffdULL, 0xfdfebf0b4ae03c96ULL, 0x0000000000002092ULL }, { 0x3eef8f1c86018a26ULL, 0xc7085580335177b0ULL, 0xb06c2f4d0e67167fULL, 0x0000000000007eb9ULL },
+		{ 0x101ae5dffa4d81e6ULL, 0x1d526a492643a5b8ULL, 0xb884f99ce10117f7ULL, 0x000000000000baa7ULL }, { 0x88dd8757fefab210ULL, 0x688342d83e8d9df5ULL, 0xf51669daa5863d1eULL, 0x000000000000e48cULL },
+		{ 0x3d8921d2f23ee717ULL, 0xf7ed3a7616c2d522ULL, 0x22bdc41069124338ULL, 0x00000000000006f1ULL }, { 0xa54e435af689d4e1ULL, 0x823c12e70e0ced6fULL, 0x6f2f54562d9569d1ULL, 0x00000000000058daULL },
+		{ 0x4a2170c5eaab4d19ULL, 0xd431ca37465c4591ULL, 0x91f68399ec27bf74ULL, 0x000000000000df0bULL }, { 0xd2e6124dee1c7eefULL, 0xa1e0e2a65e927ddcULL, 0xdc6413dfa8a0959dULL, 0x0000000000008120ULL },
+		{ 0x67b2b4c8e2d82be8ULL, 0x3e8e9a0876dd350bULL, 0x0bcfbe156434ebbbULL, 0x000000000000635dULL }, { 0xff75d640e66f181eULL, 0x4b5fb2996e130d46ULL, 0x465d2e5320b3c152ULL, 0x0000000000003d76ULL },
+		{ 0xa46cd2ebda9c0405ULL, 0x929437b5e67d78eaULL, 0xea600d96fb4d5aecULL, 0x00000000000070e2ULL }, { 0x3cabb063de2b37f3ULL, 0xe7451f24feb340a7ULL, 0xa7f29dd0bfca7005ULL, 0x0000000000002ec9ULL },
+		{ 0x89ff16e6d2ef62f4ULL, 0x782b678ad6fc0870ULL, 0x7059301a735e0e23ULL, 0x000000000000ccb4ULL }, { 0x1138746ed6585102ULL, 0x0dfa4f1bce32303dULL, 0x3dcba05c37d924caULL, 0x000000000000929fULL },
+		{ 0xfe5747f1ca7ac8faULL, 0x5bf797cb866298c3ULL, 0xc3127793f66bf26fULL, 0x000000000000154eULL }, { 0x66902579cecdfb0cULL, 0x2e26bf5a9eaca08eULL, 0x8e80e7d5b2ecd886ULL, 0x0000000000004b65ULL },
+		{ 0xd3c483fcc209ae0bULL, 0xb148c7f4b6e3e859ULL, 0x592b4a1f7e78a6a0ULL, 0x000000000000a918ULL }, { 0x4b03e174c6be9dfdULL, 0xc499ef65ae2dd014ULL, 0x14b9da593aff8c49ULL, 0x000000000000f733ULL },
+		{ 0x46a4f2da2757e4ddULL, 0x14826bc8d22af7e3ULL, 0xe39508f06deef675ULL, 0x0000000000002236ULL }, { 0xde63905223e0d72bULL, 0x61534359cae4cfaeULL, 0xae0798b62969dc9cULL, 0x0000000000007c1dULL },
+		{ 0x6b3736d72f24822cULL, 0xfe3d3bf7e2ab8779ULL, 0x79ac357ce5fda2baULL, 0x0000000000009e60ULL }, { 0xf3f0545f2b93b1daULL, 0x8bec1366fa65bf34ULL, 0x343ea53aa17a8853ULL, 0x000000000000c04bULL },
+		{ 0x1c9f67c037b12822ULL, 0xdde1cbb6b23517caULL, 0xcae772f560c85ef6ULL, 0x000000000000479aULL }, { 0x8458054833061bd4ULL, 0xa830e327aafb2f87ULL, 0x8775e2b3244f741fULL, 0x00000000000019b1ULL },
+		{ 0x310ca3cd3fc24ed3ULL, 0x375e9b8982b46750ULL, 0x50de4f79e8db0a39ULL, 0x000000000000fbccULL }, { 0xa9cbc1453b757d25ULL, 0x428fb3189a7a5f1dULL, 0x1d4cdf3fac5c20d0ULL, 0x000000000000a5e7ULL },
+		{ 0xf2d2c5ee0786613eULL, 0x9b44363412142ab1ULL, 0xb171fcfa77a2bb6eULL, 0x000000000000e873ULL }, { 0x6a15a766033152c8ULL, 0xee951ea50ada12fcULL, 0xfce36cbc33259187ULL, 0x000000000000b658ULL },
+		{ 0xdf4101e30ff507cfULL, 0x71fb660b22955a2bULL, 0x2b48c176ffb1efa1ULL, 0x0000000000005425ULL }, { 0x4786636b0b423439ULL, 0x042a4e9a3a5b6266ULL, 0x66da5130bb36c548ULL, 0x0000000000000a0eULL },
+		{ 0xa8e950f41760adc1ULL, 0x5227964a720bca98ULL, 0x980386ff7a8413edULL, 0x0000000000008ddfULL }, { 0x302e327c13d79e37ULL, 0x27f6bedb6ac5f2d5ULL, 0xd59116b93e033904ULL, 0x000000000000d3f4ULL },
+		{ 0x857a94f91f13cb30ULL, 0xb898c675428aba02ULL, 0x023abb73f2974722ULL, 0x0000000000003189ULL }, { 0x1dbdf6711ba4f8c6ULL, 0xcd49eee45a44824fULL, 0x4fa82b35b6106dcbULL, 0x0000000000006fa2ULL },
+		{ 0x33489cb267e8f306ULL, 0x1713d12d4f565047ULL, 0x4740fde459766c43ULL, 0x000000000000abbcULL }, { 0xab8ffe3a635fc0f0ULL, 0x62c2f9bc5798680aULL, 0x0ad26da21df146aaULL, 0x000000000000f597ULL },
+		{ 0x1edb58bf6f9b95f7ULL, 0xfdac81127fd720ddULL, 0xdd79c068d165388cULL, 0x00000000000017eaULL }, { 0x861c3a376b2ca601ULL, 0x887da98367191890ULL, 0x90eb502e95e21265ULL, 0x00000000000049c1ULL },
+		{ 0x697309a8770e3ff9ULL, 0xde7071532f49b06eULL, 0x6e3287e15450c4c0ULL, 0x000000000000ce10ULL }, { 0xf1b46b2073b90c0fULL, 0xaba159c237878823ULL, 0x23a017a710d7ee29ULL, 0x000000000000903bULL },
+		{ 0x44e0cda57f7d5908ULL, 0x34cf216c1fc8c0f4ULL, 0xf40bba6ddc43900fULL, 0x0000000000007246ULL }, { 0xdc27af2d7bca6afeULL, 0x411e09fd0706f8b9ULL, 0xb9992a2b98c4bae6ULL, 0x0000000000002c6dULL },
+		{ 0x873eab86473976e5ULL, 0x98d58cd18f688d15ULL, 0x15a409ee433a2158ULL, 0x00000000000061f9ULL }, { 0x1ff9c90e438e4513ULL, 0xed04a44097a6b558ULL, 0x583699a807bd0bb1ULL, 0x0000000000003fd2ULL },
+		{ 0xaaad6f8b4f4a1014ULL, 0x726adceebfe9fd8fULL, 0x8f9d3462cb297597ULL, 0x000000000000ddafULL }, { 0x326a0d034bfd23e2ULL, 0x07bbf47fa727c5c2ULL, 0xc20fa4248fae5f7eULL, 0x0000000000008384ULL },
+		{ 0xdd053e9c57dfba1aULL, 0x51b62cafef776d3cULL, 0x3cd673eb4e1c89dbULL, 0x0000000000000455ULL }, { 0x45c25c14536889ecULL, 0x2467043ef7b95571ULL, 0x7144e3ad0a9ba332ULL, 0x0000000000005a7eULL },
+		{ 0xf096fa915facdcebULL, 0xbb097c90dff61da6ULL, 0xa6ef4e67c60fdd14ULL, 0x000000000000b803ULL }, { 0x685198195b1bef1dULL, 0xced85401c73825ebULL, 0xeb7dde218288f7fdULL, 0x000000000000e628ULL },
+		{ 0xac612e0aa734ca76ULL, 0x12bd021ff5d2a4b6ULL, 0xb622ffd805c3df19ULL, 0x0000000000002d3fULL }, { 0x34a64c82a383f980ULL, 0x676c2a8eed1c9cfbULL, 0xfbb06f9e4144f5f0ULL, 0x0000000000007314ULL },
+		{ 0x81f2ea07af47ac87ULL, 0xf8025220c553d42cULL, 0x2c1bc2548dd08bd6ULL, 0x0000000000009169ULL }, { 0x1935888fabf09f71ULL, 0x8dd37ab1dd9dec61ULL, 0x61895212c957a13fULL, 0x000000000000cf42ULL },
+		{ 0xf65abb10b7d20689ULL, 0xdbdea26195cd449fULL, 0x9f5085dd08e5779aULL, 0x0000000000004893ULL }, { 0x6e9dd998b365357fULL, 0xae0f8af08d037cd2ULL, 0xd2c2159b4c625d73ULL, 0x00000000000016b8ULL },
+		{ 0xdbc97f1dbfa16078ULL, 0x3161f25ea54c3405ULL, 0x0569b85180f62355ULL, 0x000000000000f4c5ULL }, { 0x430e1d95bb16538eULL, 0x44b0dacfbd820c48ULL, 0x48fb2817c47109bcULL, 0x000000000000aaeeULL },
+		{ 0x1817193e87e54f95ULL, 0x9d7b5fe335ec79e4ULL, 0xe4c60bd21f8f9202ULL, 0x000000000000e77aULL }, { 0x80d07bb683527c63ULL, 0xe8aa77722d2241a9ULL, 0xa9549b945b08b8ebULL, 0x000000000000b951ULL },
+		{ 0x3584dd338f962964ULL, 0x77c40fdc056d097eULL, 0x7eff365e979cc6cdULL, 0x0000000000005b2cULL }, { 0xad43bfbb8b211a92ULL, 0x0215274d1da33133ULL, 0x336da618d31bec24ULL, 0x0000000000000507ULL },
+		{ 0x422c8c249703836aULL, 0x5418ff9d55f399cdULL, 0xcdb471d712a93a81ULL, 0x00000000000082d6ULL }, { 0xdaebeeac93b4b09cULL, 0x21c9d70c4d3da180ULL, 0x8026e191562e1068ULL, 0x000000000000dcfdULL },
+		{ 0x6fbf48299f70e59bULL, 0xbea7afa26572e957ULL, 0x578d4c5b9aba6e4eULL, 0x0000000000003e80ULL }, { 0xf7782aa19bc7d66dULL, 0xcb7687337dbcd11aULL, 0x1a1fdc1dde3d44a7ULL, 0x00000000000060abULL },
+		{ 0xd98d4062e78bddadULL, 0x112cb8fa68ae0312ULL, 0x12f70acc315b452fULL, 0x000000000000a4b5ULL }, { 0x414a22eae33cee5bULL, 0x64fd906b70603b5fULL, 0x5f659a8a75dc6fc6ULL, 0x000000000000fa9eULL },
+		{ 0xf41e846feff8bb5cULL, 0xfb93e8c5582f7388ULL, 0x88ce3740b94811e0ULL, 0x00000000000018e3ULL }, { 0x6cd9e6e7eb4f88aaULL, 0x8e42c05440e14bc5ULL, 0xc55ca706fdcf3b09ULL, 0x00000000000046c8ULL },
+		{ 0x83b6d578f76d1152ULL, 0xd84f188408b1e33bULL, 0x3b8570c93c7dedacULL, 0x000000000000c119ULL }, { 0x1b71b7f0f3da22a4ULL, 0xad9e3015107fdb76ULL, 0x7617e08f78fac745ULL, 0x0000000000009f32ULL },
+		{ 0xae251175ff1e77a3ULL, 0x32f048bb383093a1ULL, 0xa1bc4d45b46eb963ULL, 0x0000000000007d4fULL }, { 0x36e273fdfba94455ULL, 0x4721602a20feabecULL, 0xec2edd03f0e9938aULL, 0x0000000000002364ULL },
+		{ 0x6dfb7756c75a584eULL, 0x9eeae506a890de40ULL, 0x4013fec62b170834ULL, 0x0000000000006ef0ULL }, { 0xf53c15dec3ed6bb8ULL, 0xeb3bcd97b05ee60dULL, 0x0d816e806f9022ddULL, 0x00000000000030dbULL },
+		{ 0x4068b35bcf293ebfULL, 0x7455b5399811aedaULL, 0xda2ac34aa3045cfbULL, 0x000000000000d2a6ULL }, { 0xd8afd1d3cb9e0d49ULL, 0x01849da880df9697ULL, 0x97b8530ce7837612ULL, 0x0000000000008c8dULL },
+		{ 0x37c0e24cd7bc94b1ULL, 0x57894578c88f3e69ULL, 0x696184c32631a0b7ULL, 0x0000000000000b5cULL }, { 0xaf0780c4d30ba747ULL, 0x22586de9d0410624ULL, 0x24f3148562b68a5eULL, 0x0000000000005577ULL },
+		{ 0x1a532641dfcff240ULL, 0xbd361547f80e4ef3ULL, 0xf358b94fae22f478ULL, 0x000000000000b70aULL }, { 0x829444c9db78c1b6ULL, 0xc8e73dd6e0c076beULL, 0xbeca2909eaa5de91ULL, 0x000000000000e921ULL },
+	},
+	{ // 28
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x96d0fb120d1c09fcULL, 0x38f70ca72964ae67ULL, 0x937964b57fe97775ULL, 0x00000000c53a4ab0ULL },
+		{ 0x31bdeb241a3812e5ULL, 0x70f3185352c841ceULL, 0x3bf2c877fecfeeeaULL, 0x000000009774947dULL }, { 0xa76d103617241b19ULL, 0x480414f47bacefa9ULL, 0xa88bacc28126999fULL, 0x00000000524edecdULL },
+		{ 0x6267cb48347024d7ULL, 0xe0fb30a6a48d8281ULL, 0x76f98deee183c1c9ULL, 0x0000000033e835faULL }, { 0xf4b7305a396c2d2bULL, 0xd80c3c018de92ce6ULL, 0xe580e95b9e6ab6bcULL, 0x00000000f6d27f4aULL },
+		{ 0x53da206c2e483632ULL, 0x900828f5f645c34fULL, 0x4d0b45991f4c2f23ULL, 0x00000000a49ca187ULL }, { 0xc50adb7e23543fceULL, 0xa8ff2452df216d28ULL, 0xde72212c60a55856ULL, 0x0000000061a6eb37ULL },
+		{ 0xc4ce8b9068e048b3ULL, 0xddeb60515507191fULL, 0xecef07c1df1b9f8fULL, 0x0000000066cd6ae9ULL }, { 0x521e708265fc414fULL, 0xe51c6cf67c63b778ULL, 0x7f966374a0f2e8faULL, 0x00000000a3f72059ULL },
+		{ 0xf57360b472d85a56ULL, 0xad18780207cf58d1ULL, 0xd71dcfb621d47165ULL, 0x00000000f1b9fe94ULL }, { 0x63a39ba67fc453aaULL, 0x95ef74a52eabf6b6ULL, 0x4464ab035e3d0610ULL, 0x000000003483b424ULL },
+		{ 0xa6a940d85c906c64ULL, 0x3d1050f7f18a9b9eULL, 0x9a168a2f3e985e46ULL, 0x0000000055255f13ULL }, { 0x3079bbca518c6598ULL, 0x05e75c50d8ee35f9ULL, 0x096fee9a41712933ULL, 0x00000000901f15a3ULL },
+		{ 0x9714abfc46a87e81ULL, 0x4de348a4a342da50ULL, 0xa1e44258c057b0acULL, 0x00000000c251cb6eULL }, { 0x01c450ee4bb4777dULL, 0x751444038a267437ULL, 0x329d26edbfbec7d9ULL, 0x00000000076b81deULL },
+		{ 0x95810b3dd0dd907bULL, 0xa7cbc0a2aa0e323eULL, 0xc5c30e9fa3362303ULL, 0x00000000cc87d4cfULL }, { 0x0351f02fddc19987ULL, 0x9f3ccc05836a9c59ULL, 0x56ba6a2adcdf5476ULL, 0x0000000009bd9e7fULL },
+		{ 0xa43ce019cae5829eULL, 0xd738d8f1f8c673f0ULL, 0xfe31c6e85df9cde9ULL, 0x000000005bf340b2ULL }, { 0x32ec1b0bc7f98b62ULL, 0xefcfd456d1a2dd97ULL, 0x6d48a25d2210ba9cULL, 0x000000009ec90a02ULL },
+		{ 0xf7e6c075e4adb4acULL, 0x4730f0040e83b0bfULL, 0xb33a837142b5e2caULL, 0x00000000ff6fe135ULL }, { 0x61363b67e9b1bd50ULL, 0x7fc7fca327e71ed8ULL, 0x2043e7c43d5c95bfULL, 0x000000003a55ab85ULL },
+		{ 0xc65b2b51fe95a649ULL, 0x37c3e8575c4bf171ULL, 0x88c84b06bc7a0c20ULL, 0x00000000681b7548ULL }, { 0x508bd043f389afb5ULL, 0x0f34e4f0752f5f16ULL, 0x1bb12fb3c3937b55ULL, 0x00000000ad213ff8ULL },
+		{ 0x514f80adb83dd8c8ULL, 0x7a20a0f3ff092b21ULL, 0x292c095e7c2dbc8cULL, 0x00000000aa4abe26ULL }, { 0xc79f7bbfb521d134ULL, 0x42d7ac54d66d8546ULL, 0xba556deb03c4cbf9ULL, 0x000000006f70f496ULL },
+		{ 0x60f26b89a205ca2dULL, 0x0ad3b8a0adc16aefULL, 0x12dec12982e25266ULL, 0x000000003d3e2a5bULL }, { 0xf622909baf19c3d1ULL, 0x3224b40784a5c488ULL, 0x81a7a59cfd0b2513ULL, 0x00000000f80460ebULL },
+		{ 0x33284be58c4dfc1fULL, 0x9adb90555b84a9a0ULL, 0x5fd584b09dae7d45ULL, 0x0000000099a28bdcULL }, { 0xa5f8b0f78151f5e3ULL, 0xa22c9cf272e007c7ULL, 0xccace005e2470a30ULL, 0x000000005c98c16cULL },
+		{ 0x0295a0c19675eefaULL, 0xea288806094ce86eULL, 0x64274cc7636193afULL, 0x000000000ed61fa1ULL }, { 0x94455bd39b69e706ULL, 0xd2df84a120284609ULL, 0xf75e28721c88e4daULL, 0x00000000cbec5511ULL },
+		{ 0x371f167abda73df6ULL, 0x538b9d59491c647cULL, 0x979b1c235b6c4606ULL, 0x000000008513b583ULL }, { 0xa1cfed68b0bb340aULL, 0x6b7c91fe6078ca1bULL, 0x04e2789624853173ULL, 0x000000004029ff33ULL },
+		{ 0x06a2fd5ea79f2f13ULL, 0x2378850a1bd425b2ULL, 0xac69d454a5a3a8ecULL, 0x00000000126721feULL }, { 0x9072064caa8326efULL, 0x1b8f89ad32b08bd5ULL, 0x3f10b0e1da4adf99ULL, 0x00000000d75d6b4eULL },
+		{ 0x5578dd3289d71921ULL, 0xb370adffed91e6fdULL, 0xe16291cdbaef87cfULL, 0x00000000b6fb8079ULL }, { 0xc3a8262084cb10ddULL, 0x8b87a158c4f5489aULL, 0x721bf578c506f0baULL, 0x0000000073c1cac9ULL },
+		{ 0x64c5361693ef0bc4ULL, 0xc383b5acbf59a733ULL, 0xda9059ba44206925ULL, 0x00000000218f1404ULL }, { 0xf215cd049ef30238ULL, 0xfb74b90b963d0954ULL, 0x49e93d0f3bc91e50ULL, 0x00000000e4b55eb4ULL },
+		{ 0xf3d19dead5477545ULL, 0x8e60fd081c1b7d63ULL, 0x7b741be28477d989ULL, 0x00000000e3dedf6aULL }, { 0x650166f8d85b7cb9ULL, 0xb697f1af357fd304ULL, 0xe80d7f57fb9eaefcULL, 0x0000000026e495daULL },
+		{ 0xc26c76cecf7f67a0ULL, 0xfe93e55b4ed33cadULL, 0x4086d3957ab83763ULL, 0x0000000074aa4b17ULL }, { 0x54bc8ddcc2636e5cULL, 0xc664e9fc67b792caULL, 0xd3ffb72005514016ULL, 0x00000000b19001a7ULL },
+		{ 0x91b656a2e1375192ULL, 0x6e9bcdaeb896ffe2ULL, 0x0d8d960c65f41840ULL, 0x00000000d036ea90ULL }, { 0x0766adb0ec2b586eULL, 0x566cc10991f25185ULL, 0x9ef4f2b91a1d6f35ULL, 0x00000000150ca020ULL },
+		{ 0xa00bbd86fb0f4377ULL, 0x1e68d5fdea5ebe2cULL, 0x367f5e7b9b3bf6aaULL, 0x0000000047427eedULL }, { 0x36db4694f6134a8bULL, 0x269fd95ac33a104bULL, 0xa5063acee4d281dfULL, 0x000000008278345dULL },
+		{ 0xa29e1d476d7aad8dULL, 0xf4405dfbe3125642ULL, 0x525812bcf85a6505ULL, 0x000000004994614cULL }, { 0x344ee6556066a471ULL, 0xccb7515cca76f825ULL, 0xc121760987b31270ULL, 0x000000008cae2bfcULL },
+		{ 0x9323f6637742bf68ULL, 0x84b345a8b1da178cULL, 0x69aadacb06958befULL, 0x00000000dee0f531ULL }, { 0x05f30d717a5eb694ULL, 0xbc44490f98beb9ebULL, 0xfad3be7e797cfc9aULL, 0x000000001bdabf81ULL },
+		{ 0xc0f9d60f590a895aULL, 0x14bb6d5d479fd4c3ULL, 0x24a19f5219d9a4ccULL, 0x000000007a7c54b6ULL }, { 0x56292d1d541680a6ULL, 0x2c4c61fa6efb7aa4ULL, 0xb7d8fbe76630d3b9ULL, 0x00000000bf461e06ULL },
+		{ 0xf1443d2b43329bbfULL, 0x6448750e1557950dULL, 0x1f535725e7164a26ULL, 0x00000000ed08c0cbULL }, { 0x6794c6394e2e9243ULL, 0x5cbf79a93c333b6aULL, 0x8c2a339098ff3d53ULL, 0x0000000028328a7bULL },
+		{ 0x665096d7059ae53eULL, 0x29ab3daab6154f5dULL, 0xbeb7157d2741fa8aULL, 0x000000002f590ba5ULL }, { 0xf0806dc50886ecc2ULL, 0x115c310d9f71e13aULL, 0x2dce71c858a88dffULL, 0x00000000ea634115ULL },
+		{ 0x57ed7df31fa2f7dbULL, 0x595825f9e4dd0e93ULL, 0x8545dd0ad98e1460ULL, 0x00000000b82d9fd8ULL }, { 0xc13d86e112befe27ULL, 0x61af295ecdb9a0f4ULL, 0x163cb9bfa6676315ULL, 0x000000007d17d568ULL },
+		{ 0x04375d9f31eac1e9ULL, 0xc9500d0c1298cddcULL, 0xc84e9893c6c23b43ULL, 0x000000001cb13e5fULL }, { 0x92e7a68d3cf6c815ULL, 0xf1a701ab3bfc63bbULL, 0x5b37fc26b92b4c36ULL, 0x00000000d98b74efULL },
+		{ 0x358ab6bb2bd2d30cULL, 0xb9a3155f40508c12ULL, 0xf3bc50e4380dd5a9ULL, 0x000000008bc5aa22ULL }, { 0xa35a4da926cedaf0ULL, 0x815419f869342275ULL, 0x60c5345147e4a2dcULL, 0x000000004effe092ULL },
+		{ 0x6e3e2cf467537af1ULL, 0xa60b27b29238c8f8ULL, 0x332b3846b6d88c0cULL, 0x000000001726771bULL }, { 0xf8eed7e66a4f730dULL, 0x9efc2b15bb5c669fULL, 0xa0525cf3c931fb79ULL, 0x00000000d21c3dabULL },
+		{ 0x5f83c7d07d6b6814ULL, 0xd6f83fe1c0f08936ULL, 0x08d9f031481762e6ULL, 0x000000008052e366ULL }, { 0xc9533cc2707761e8ULL, 0xee0f3346e9942751ULL, 0x9ba0948437fe1593ULL, 0x000000004568a9d6ULL },
+		{ 0x0c59e7bc53235e26ULL, 0x46f0171436b54a79ULL, 0x45d2b5a8575b4dc5ULL, 0x0000000024ce42e1ULL }, { 0x9a891cae5e3f57daULL, 0x7e071bb31fd1e41eULL, 0xd6abd11d28b23ab0ULL, 0x00000000e1f40851ULL },
+		{ 0x3de40c98491b4cc3ULL, 0x36030f47647d0bb7ULL, 0x7e207ddfa994a32fULL, 0x00000000b3bad69cULL }, { 0xab34f78a4407453fULL, 0x0ef403e04d19a5d0ULL, 0xed59196ad67dd45aULL, 0x0000000076809c2cULL },
+		{ 0xaaf0a7640fb33242ULL, 0x7be047e3c73fd1e7ULL, 0xdfc43f8769c31383ULL, 0x0000000071eb1df2ULL }, { 0x3c205c7602af3bbeULL, 0x43174b44ee5b7f80ULL, 0x4cbd5b32162a64f6ULL, 0x00000000b4d15742ULL },
+		{ 0x9b4d4c40158b20a7ULL, 0x0b135fb095f79029ULL, 0xe436f7f0970cfd69ULL, 0x00000000e69f898fULL }, { 0x0d9db7521897295bULL, 0x33e45317bc933e4eULL, 0x774f9345e8e58a1cULL, 0x0000000023a5c33fULL },
+		{ 0xc8976c2c3bc31695ULL, 0x9b1b774563b25366ULL, 0xa93db2698840d24aULL, 0x0000000042032808ULL }, { 0x5e47973e36df1f69ULL, 0xa3ec7be24ad6fd01ULL, 0x3a44d6dcf7a9a53fULL, 0x00000000873962b8ULL },
+		{ 0xf92a870821fb0470ULL, 0xebe86f16317a12a8ULL, 0x92cf7a1e768f3ca0ULL, 0x00000000d577bc75ULL }, { 0x6ffa7c1a2ce70d8cULL, 0xd31f63b1181ebccfULL, 0x01b61eab09664bd5ULL, 0x00000000104df6c5ULL },
+		{ 0xfbbf27c9b78eea8aULL, 0x01c0e7103836fac6ULL, 0xf6e836d915eeaf0fULL, 0x00000000dba1a3d4ULL }, { 0x6d6fdcdbba92e376ULL, 0x3937ebb7115254a1ULL, 0x6591526c6a07d87aULL, 0x000000001e9be964ULL },
+		{ 0xca02ccedadb6f86fULL, 0x7133ff436afebb08ULL, 0xcd1afeaeeb2141e5ULL, 0x000000004cd537a9ULL }, { 0x5cd237ffa0aaf193ULL, 0x49c4f3e4439a156fULL, 0x5e639a1b94c83690ULL, 0x0000000089ef7d19ULL },
+		{ 0x99d8ec8183fece5dULL, 0xe13bd7b69cbb7847ULL, 0x8011bb37f46d6ec6ULL, 0x00000000e849962eULL }, { 0x0f0817938ee2c7a1ULL, 0xd9ccdb11b5dfd620ULL, 0x1368df828b8419b3ULL, 0x000000002d73dc9eULL },
+		{ 0xa86507a599c6dcb8ULL, 0x91c8cfe5ce733989ULL, 0xbbe373400aa2802cULL, 0x000000007f3d0253ULL }, { 0x3eb5fcb794dad544ULL, 0xa93fc342e71797eeULL, 0x289a17f5754bf759ULL, 0x00000000ba0748e3ULL },
+		{ 0x3f71ac59df6ea239ULL, 0xdc2b87416d31e3d9ULL, 0x1a073118caf53080ULL, 0x00000000bd6cc93dULL }, { 0xa9a1574bd272abc5ULL, 0xe4dc8be644554dbeULL, 0x897e55adb51c47f5ULL, 0x000000007856838dULL },
+		{ 0x0ecc477dc556b0dcULL, 0xacd89f123ff9a217ULL, 0x21f5f96f343ade6aULL, 0x000000002a185d40ULL }, { 0x981cbc6fc84ab920ULL, 0x942f93b5169d0c70ULL, 0xb28c9dda4bd3a91fULL, 0x00000000ef2217f0ULL },
+		{ 0x5d166711eb1e86eeULL, 0x3cd0b7e7c9bc6158ULL, 0x6cfebcf62b76f149ULL, 0x000000008e84fcc7ULL }, { 0xcbc69c03e6028f12ULL, 0x0427bb40e0d8cf3fULL, 0xff87d843549f863cULL, 0x000000004bbeb677ULL },
+		{ 0x6cab8c35f126940bULL, 0x4c23afb49b742096ULL, 0x570c7481d5b91fa3ULL, 0x0000000019f068baULL }, { 0xfa7b7727fc3a9df7ULL, 0x74d4a313b2108ef1ULL, 0xc4751034aa5068d6ULL, 0x00000000dcca220aULL },
+		{ 0x59213a8edaf44707ULL, 0xf580baebdb24ac84ULL, 0xa4b02465edb4ca0aULL, 0x000000009235c298ULL }, { 0xcff1c19cd7e84efbULL, 0xcd77b64cf24002e3ULL, 0x37c940d0925dbd7fULL, 0x00000000570f8828ULL },
+		{ 0x689cd1aac0cc55e2ULL, 0x8573a2b889eced4aULL, 0x9f42ec12137b24e0ULL, 0x00000000054156e5ULL }, { 0xfe4c2ab8cdd05c1eULL, 0xbd84ae1fa088432dULL, 0x0c3b88a76c925395ULL, 0x00000000c07b1c55ULL },
+		{ 0x3b46f1c6ee8463d0ULL, 0x157b8a4d7fa92e05ULL, 0xd249a98b0c370bc3ULL, 0x00000000a1ddf762ULL }, { 0xad960ad4e3986a2cULL, 0x2d8c86ea56cd8062ULL, 0x4130cd3e73de7cb6ULL, 0x0000000064e7bdd2ULL },
+		{ 0x0afb1ae2f4bc7135ULL, 0x6588921e2d616fcbULL, 0xe9bb61fcf2f8e529ULL, 0x0000000036a9631fULL }, { 0x9c2be1f0f9a078c9ULL, 0x5d7f9eb90405c1acULL, 0x7ac205498d11925cULL, 0x00000000f39329afULL },
+		{ 0x9defb11eb2140fb4ULL, 0x286bdaba8e23b59bULL, 0x485f23a432af5585ULL, 0x00000000f4f8a871ULL }, { 0x0b3f4a0cbf080648ULL, 0x109cd61da7471bfcULL, 0xdb2647114d4622f0ULL, 0x0000000031c2e2c1ULL },
+		{ 0xac525a3aa82c1d51ULL, 0x5898c2e9dcebf455ULL, 0x73adebd3cc60bb6fULL, 0x00000000638c3c0cULL }, { 0x3a82a128a53014adULL, 0x606fce4ef58f5a32ULL, 0xe0d48f66b389cc1aULL, 0x00000000a6b676bcULL },
+		{ 0xff887a5686642b63ULL, 0xc890ea1c2aae371aULL, 0x3ea6ae4ad32c944cULL, 0x00000000c7109d8bULL }, { 0x695881448b78229fULL, 0xf067e6bb03ca997dULL, 0xaddfcaffacc5e339ULL, 0x00000000022ad73bULL },
+		{ 0xce3591729c5c3986ULL, 0xb863f24f786676d4ULL, 0x0554663d2de37aa6ULL, 0x00000000506409f6ULL }, { 0x58e56a609140307aULL, 0x8094fee85102d8b3ULL, 0x962d0288520a0dd3ULL, 0x00000000955e4346ULL },
+		{ 0xcca031b30a29d77cULL, 0x524b7a49712a9ebaULL, 0x61732afa4e82e909ULL, 0x000000005eb21657ULL }, { 0x5a70caa10735de80ULL, 0x6abc76ee584e30ddULL, 0xf20a4e4f316b9e7cULL, 0x000000009b885ce7ULL },
+		{ 0xfd1dda971011c599ULL, 0x22b8621a23e2df74ULL, 0x5a81e28db04d07e3ULL, 0x00000000c9c6822aULL }, { 0x6bcd21851d0dcc65ULL, 0x1a4f6ebd0a867113ULL, 0xc9f88638cfa47096ULL, 0x000000000cfcc89aULL },
+		{ 0xaec7fafb3e59f3abULL, 0xb2b04aefd5a71c3bULL, 0x178aa714af0128c0ULL, 0x000000006d5a23adULL }, { 0x381701e93345fa57ULL, 0x8a474648fcc3b25cULL, 0x84f3c3a1d0e85fb5ULL, 0x00000000a860691dULL },
+		{ 0x9f7a11df2461e14eULL, 0xc24352bc876f5df5ULL, 0x2c786f6351cec62aULL, 0x00000000fa2eb7d0ULL }, { 0x09aaeacd297de8b2ULL, 0xfab45e1bae0bf392ULL, 0xbf010bd62e27b15fULL, 0x000000003f14fd60ULL },
+		{ 0x086eba2362c99fcfULL, 0x8fa01a18242d87a5ULL, 0x8d9c2d3b91997686ULL, 0x00000000387f7cbeULL }, { 0x9ebe41316fd59633ULL, 0xb75716bf0d4929c2ULL, 0x1ee5498eee7001f3ULL, 0x00000000fd45360eULL },
+		{ 0x39d3510778f18d2aULL, 0xff53024b76e5c66bULL, 0xb66ee54c6f56986cULL, 0x00000000af0be8c3ULL }, { 0xaf03aa1575ed84d6ULL, 0xc7a40eec5f81680cULL, 0x251781f910bfef19ULL, 0x000000006a31a273ULL },
+		{ 0x6a09716b56b9bb18ULL, 0x6f5b2abe80a00524ULL, 0xfb65a0d5701ab74fULL, 0x000000000b974944ULL }, { 0xfcd98a795ba5b2e4ULL, 0x57ac2619a9c4ab43ULL, 0x681cc4600ff3c03aULL, 0x00000000cead03f4ULL },
+		{ 0x5bb49a4f4c81a9fdULL, 0x1fa832edd26844eaULL, 0xc09768a28ed559a5ULL, 0x000000009ce3dd39ULL }, { 0xcd64615d419da001ULL, 0x275f3e4afb0cea8dULL, 0x53ee0c17f13c2ed0ULL, 0x0000000059d99789ULL },
+		{ 0xdc7c58f5cea6f4ffULL, 0x51164e7939708dedULL, 0x6656708c71ad0518ULL, 0x000000002e4cee36ULL }, { 0x4aaca3e7c3bafd03ULL, 0x69e142de1014238aULL, 0xf52f14390e44726dULL, 0x00000000eb76a486ULL },
+		{ 0xedc1b3d1d49ee61aULL, 0x21e5562a6bb8cc23ULL, 0x5da4b8fb8f62ebf2ULL, 0x00000000b9387a4bULL }, { 0x7b1148c3d982efe6ULL, 0x19125a8d42dc6244ULL, 0xcedddc4ef08b9c87ULL, 0x000000007c0230fbULL },
+		{ 0xbe1b93bdfad6d028ULL, 0xb1ed7edf9dfd0f6cULL, 0x10affd62902ec4d1ULL, 0x000000001da4dbccULL }, { 0x28cb68aff7cad9d4ULL, 0x891a7278b499a10bULL, 0x83d699d7efc7b3a4ULL, 0x00000000d89e917cULL },
+		{ 0x8fa67899e0eec2cdULL, 0xc11e668ccf354ea2ULL, 0x2b5d35156ee12a3bULL, 0x000000008ad04fb1ULL }, { 0x1976838bedf2cb31ULL, 0xf9e96a2be651e0c5ULL, 0xb82451a011085d4eULL, 0x000000004fea0501ULL },
+		{ 0x18b2d365a646bc4cULL, 0x8cfd2e286c7794f2ULL, 0x8ab9774daeb69a97ULL, 0x00000000488184dfULL }, { 0x8e622877ab5ab5b0ULL, 0xb40a228f45133a95ULL, 0x19c013f8d15fede2ULL, 0x000000008dbbce6fULL },
+		{ 0x290f3841bc7eaea9ULL, 0xfc0e367b3ebfd53cULL, 0xb14bbf3a5079747dULL, 0x00000000dff510a2ULL }, { 0xbfdfc353b162a755ULL, 0xc4f93adc17db7b5bULL, 0x2232db8f2f900308ULL, 0x000000001acf5a12ULL },
+		{ 0x7ad5182d9236989bULL, 0x6c061e8ec8fa1673ULL, 0xfc40faa34f355b5eULL, 0x000000007b69b125ULL }, { 0xec05e33f9f2a9167ULL, 0x54f11229e19eb814ULL, 0x6f399e1630dc2c2bULL, 0x00000000be53fb95ULL },
+		{ 0x4b68f309880e8a7eULL, 0x1cf506dd9a3257bdULL, 0xc7b232d4b1fab5b4ULL, 0x00000000ec1d2558ULL }, { 0xddb8081b85128382ULL, 0x24020a7ab356f9daULL, 0x54cb5661ce13c2c1ULL, 0x0000000029276fe8ULL },
+		{ 0x49fd53c81e7b6484ULL, 0xf6dd8edb937ebfd3ULL, 0xa3957e13d29b261bULL, 0x00000000e2cb3af9ULL }, { 0xdf2da8da13676d78ULL, 0xce2a827cba1a11b4ULL, 0x30ec1aa6ad72516eULL, 0x0000000027f17049ULL },
+		{ 0x7840b8ec04437661ULL, 0x862e9688c1b6fe1dULL, 0x9867b6642c54c8f1ULL, 0x0000000075bfae84ULL }, { 0xee9043fe095f7f9dULL, 0xbed99a2fe8d2507aULL, 0x0b1ed2d153bdbf84ULL, 0x00000000b085e434ULL },
+		{ 0x2b9a98802a0b4053ULL, 0x1626be7d37f33d52ULL, 0xd56cf3fd3318e7d2ULL, 0x00000000d1230f03ULL }, { 0xbd4a6392271749afULL, 0x2ed1b2da1e979335ULL, 0x461597484cf190a7ULL, 0x00000000141945b3ULL },
+		{ 0x1a2773a4303352b6ULL, 0x66d5a62e653b7c9cULL, 0xee9e3b8acdd70938ULL, 0x0000000046579b7eULL }, { 0x8cf788b63d2f5b4aULL, 0x5e22aa894c5fd2fbULL, 0x7de75f3fb23e7e4dULL, 0x00000000836dd1ceULL },
+		{ 0x8d33d858769b2c37ULL, 0x2b36ee8ac679a6ccULL, 0x4f7a79d20d80b994ULL, 0x0000000084065010ULL }, { 0x1be3234a7b8725cbULL, 0x13c1e22def1d08abULL, 0xdc031d677269cee1ULL, 0x00000000413c1aa0ULL },
+		{ 0xbc8e337c6ca33ed2ULL, 0x5bc5f6d994b1e702ULL, 0x7488b1a5f34f577eULL, 0x000000001372c46dULL }, { 0x2a5ec86e61bf372eULL, 0x6332fa7ebdd54965ULL, 0xe7f1d5108ca6200bULL, 0x00000000d6488eddULL },
+		{ 0xef54131042eb08e0ULL, 0xcbcdde2c62f4244dULL, 0x3983f43cec03785dULL, 0x00000000b7ee65eaULL }, { 0x7984e8024ff7011cULL, 0xf33ad28b4b908a2aULL, 0xaafa908993ea0f28ULL, 0x0000000072d42f5aULL },
+		{ 0xdee9f83458d31a05ULL, 0xbb3ec67f303c6583ULL, 0x02713c4b12cc96b7ULL, 0x00000000209af197ULL }, { 0x4839032655cf13f9ULL, 0x83c9cad81958cbe4ULL, 0x910858fe6d25e1c2ULL, 0x00000000e5a0bb27ULL },
+		{ 0xeb634e8f7301c909ULL, 0x029dd320706ce991ULL, 0xf1cd6caf2ac1431eULL, 0x00000000ab5f5bb5ULL }, { 0x7db3b59d7e1dc0f5ULL, 0x3a6adf87590847f6ULL, 0x62b4081a5528346bULL, 0x000000006e651105ULL },
+		{ 0xdadea5ab6939dbecULL, 0x726ecb7322a4a85fULL, 0xca3fa4d8d40eadf4ULL, 0x000000003c2bcfc8ULL }, { 0x4c0e5eb96425d210ULL, 0x4a99c7d40bc00638ULL, 0x5946c06dabe7da81ULL, 0x00000000f9118578ULL },
+		{ 0x890485c74771eddeULL, 0xe266e386d4e16b10ULL, 0x8734e141cb4282d7ULL, 0x0000000098b76e4fULL }, { 0x1fd47ed54a6de422ULL, 0xda91ef21fd85c577ULL, 0x144d85f4b4abf5a2ULL, 0x000000005d8d24ffULL },
+		{ 0xb8b96ee35d49ff3bULL, 0x9295fbd586292adeULL, 0xbcc62936358d6c3dULL, 0x000000000fc3fa32ULL }, { 0x2e6995f15055f6c7ULL, 0xaa62f772af4d84b9ULL, 0x2fbf4d834a641b48ULL, 0x00000000caf9b082ULL },
+		{ 0x2fadc51f1be181baULL, 0xdf76b371256bf08eULL, 0x1d226b6ef5dadc91ULL, 0x00000000cd92315cULL }, { 0xb97d3e0d16fd8846ULL, 0xe781bfd60c0f5ee9ULL, 0x8e5b0fdb8a33abe4ULL, 0x0000000008a87becULL },
+		{ 0x1e102e3b01d9935fULL, 0xaf85ab2277a3b140ULL, 0x26d0a3190b15327bULL, 0x000000005ae6a521ULL }, { 0x88c0d5290cc59aa3ULL, 0x9772a7855ec71f27ULL, 0xb5a9c7ac74fc450eULL, 0x000000009fdcef91ULL },
+		{ 0x4dca0e572f91a56dULL, 0x3f8d83d781e6720fULL, 0x6bdbe68014591d58ULL, 0x00000000fe7a04a6ULL }, { 0xdb1af545228dac91ULL, 0x077a8f70a882dc68ULL, 0xf8a282356bb06a2dULL, 0x000000003b404e16ULL },
+		{ 0x7c77e57335a9b788ULL, 0x4f7e9b84d32e33c1ULL, 0x50292ef7ea96f3b2ULL, 0x00000000690e90dbULL }, { 0xeaa71e6138b5be74ULL, 0x77899723fa4a9da6ULL, 0xc3504a42957f84c7ULL, 0x00000000ac34da6bULL },
+		{ 0x7ee245b2a3dc5972ULL, 0xa5561382da62dbafULL, 0x340e623089f7601dULL, 0x0000000067d88f7aULL }, { 0xe832bea0aec0508eULL, 0x9da11f25f30675c8ULL, 0xa7770685f61e1768ULL, 0x00000000a2e2c5caULL },
+		{ 0x4f5fae96b9e44b97ULL, 0xd5a50bd188aa9a61ULL, 0x0ffcaa4777388ef7ULL, 0x00000000f0ac1b07ULL }, { 0xd98f5584b4f8426bULL, 0xed520776a1ce3406ULL, 0x9c85cef208d1f982ULL, 0x00000000359651b7ULL },
+		{ 0x1c858efa97ac7da5ULL, 0x45ad23247eef592eULL, 0x42f7efde6874a1d4ULL, 0x000000005430ba80ULL }, { 0x8a5575e89ab07459ULL, 0x7d5a2f83578bf749ULL, 0xd18e8b6b179dd6a1ULL, 0x00000000910af030ULL },
+		{ 0x2d3865de8d946f40ULL, 0x355e3b772c2718e0ULL, 0x790527a996bb4f3eULL, 0x00000000c3442efdULL }, { 0xbbe89ecc808866bcULL, 0x0da937d00543b687ULL, 0xea7c431ce952384bULL, 0x00000000067e644dULL },
+		{ 0xba2cce22cb3c11c1ULL, 0x78bd73d38f65c2b0ULL, 0xd8e165f156ecff92ULL, 0x000000000115e593ULL }, { 0x2cfc3530c620183dULL, 0x404a7f74a6016cd7ULL, 0x4b980144290588e7ULL, 0x00000000c42faf23ULL },
+		{ 0x8b912506d1040324ULL, 0x084e6b80ddad837eULL, 0xe313ad86a8231178ULL, 0x00000000966171eeULL }, { 0x1d41de14dc180ad8ULL, 0x30b96727f4c92d19ULL, 0x706ac933d7ca660dULL, 0x00000000535b3b5eULL },
+		{ 0xd84b056aff4c3516ULL, 0x984643752be84031ULL, 0xae18e81fb76f3e5bULL, 0x0000000032fdd069ULL }, { 0x4e9bfe78f2503ceaULL, 0xa0b14fd2028cee56ULL, 0x3d618caac886492eULL, 0x00000000f7c79ad9ULL },
+		{ 0xe9f6ee4ee57427f3ULL, 0xe8b55b26792001ffULL, 0x95ea206849a0d0b1ULL, 0x00000000a5894414ULL }, { 0x7f26155ce8682e0fULL, 0xd04257815044af98ULL, 0x069344dd3649a7c4ULL, 0x0000000060b30ea4ULL },
+		{ 0xb2427401a9f58e0eULL, 0xf71d69cbab484515ULL, 0x557d48cac7758914ULL, 0x00000000396a992dULL }, { 0x24928f13a4e987f2ULL, 0xcfea656c822ceb72ULL, 0xc6042c7fb89cfe61ULL, 0x00000000fc50d39dULL },
+		{ 0x83ff9f25b3cd9cebULL, 0x87ee7198f98004dbULL, 0x6e8f80bd39ba67feULL, 0x00000000ae1e0d50ULL }, { 0x152f6437bed19517ULL, 0xbf197d3fd0e4aabcULL, 0xfdf6e4084653108bULL, 0x000000006b2447e0ULL },
+		{ 0xd025bf499d85aad9ULL, 0x17e6596d0fc5c794ULL, 0x2384c52426f648ddULL, 0x000000000a82acd7ULL }, { 0x46f5445b9099a325ULL, 0x2f1155ca26a169f3ULL, 0xb0fda191591f3fa8ULL, 0x00000000cfb8e667ULL },
+		{ 0xe198546d87bdb83cULL, 0x6715413e5d0d865aULL, 0x18760d53d839a637ULL, 0x000000009df638aaULL }, { 0x7748af7f8aa1b1c0ULL, 0x5fe24d997469283dULL, 0x8b0f69e6a7d0d142ULL, 0x0000000058cc721aULL },
+		{ 0x768cff91c115c6bdULL, 0x2af6099afe4f5c0aULL, 0xb9924f0b186e169bULL, 0x000000005fa7f3c4ULL }, { 0xe05c0483cc09cf41ULL, 0x1201053dd72bf26dULL, 0x2aeb2bbe678761eeULL, 0x000000009a9db974ULL },
+		{ 0x473114b5db2dd458ULL, 0x5a0511c9ac871dc4ULL, 0x8260877ce6a1f871ULL, 0x00000000c8d367b9ULL }, { 0xd1e1efa7d631dda4ULL, 0x62f21d6e85e3b3a3ULL, 0x1119e3c999488f04ULL, 0x000000000de92d09ULL },
+		{ 0x14eb34d9f565e26aULL, 0xca0d393c5ac2de8bULL, 0xcf6bc2e5f9edd752ULL, 0x000000006c4fc63eULL }, { 0x823bcfcbf879eb96ULL, 0xf2fa359b73a670ecULL, 0x5c12a6508604a027ULL, 0x00000000a9758c8eULL },
+		{ 0x2556dffdef5df08fULL, 0xbafe216f080a9f45ULL, 0xf4990a92072239b8ULL, 0x00000000fb3b5243ULL }, { 0xb38624efe241f973ULL, 0x82092dc8216e3122ULL, 0x67e06e2778cb4ecdULL, 0x000000003e0118f3ULL },
+		{ 0x27c37f3c79281e75ULL, 0x50d6a9690146772bULL, 0x90be46556443aa17ULL, 0x00000000f5ed4de2ULL }, { 0xb113842e74341789ULL, 0x6821a5ce2822d94cULL, 0x03c722e01baadd62ULL, 0x0000000030d70752ULL },
+		{ 0x167e941863100c90ULL, 0x2025b13a538e36e5ULL, 0xab4c8e229a8c44fdULL, 0x000000006299d99fULL }, { 0x80ae6f0a6e0c056cULL, 0x18d2bd9d7aea9882ULL, 0x3835ea97e5653388ULL, 0x00000000a7a3932fULL },
+		{ 0x45a4b4744d583aa2ULL, 0xb02d99cfa5cbf5aaULL, 0xe647cbbb85c06bdeULL, 0x00000000c6057818ULL }, { 0xd3744f664044335eULL, 0x88da95688caf5bcdULL, 0x753eaf0efa291cabULL, 0x00000000033f32a8ULL },
+		{ 0x74195f5057602847ULL, 0xc0de819cf703b464ULL, 0xddb503cc7b0f8534ULL, 0x000000005171ec65ULL }, { 0xe2c9a4425a7c21bbULL, 0xf8298d3bde671a03ULL, 0x4ecc677904e6f241ULL, 0x00000000944ba6d5ULL },
+		{ 0xe30df4ac11c856c6ULL, 0x8d3dc93854416e34ULL, 0x7c514194bb583598ULL, 0x000000009320270bULL }, { 0x75dd0fbe1cd45f3aULL, 0xb5cac59f7d25c053ULL, 0xef282521c4b142edULL, 0x00000000561a6dbbULL },
+		{ 0xd2b01f880bf04423ULL, 0xfdced16b06892ffaULL, 0x47a389e34597db72ULL, 0x000000000454b376ULL }, { 0x4460e49a06ec4ddfULL, 0xc539ddcc2fed819dULL, 0xd4daed563a7eac07ULL, 0x00000000c16ef9c6ULL },
+		{ 0x816a3fe425b87211ULL, 0x6dc6f99ef0ccecb5ULL, 0x0aa8cc7a5adbf451ULL, 0x00000000a0c812f1ULL }, { 0x17bac4f628a47bedULL, 0x5531f539d9a842d2ULL, 0x99d1a8cf25328324ULL, 0x0000000065f25841ULL },
+		{ 0xb0d7d4c03f8060f4ULL, 0x1d35e1cda204ad7bULL, 0x315a040da4141abbULL, 0x0000000037bc868cULL }, { 0x26072fd2329c6908ULL, 0x25c2ed6a8b60031cULL, 0xa22360b8dbfd6dceULL, 0x00000000f286cc3cULL },
+		{ 0x855d627b1452b3f8ULL, 0xa496f492e2542169ULL, 0xc2e654e99c19cf12ULL, 0x00000000bc792caeULL }, { 0x138d9969194eba04ULL, 0x9c61f835cb308f0eULL, 0x519f305ce3f0b867ULL, 0x000000007943661eULL },
+		{ 0xb4e0895f0e6aa11dULL, 0xd465ecc1b09c60a7ULL, 0xf9149c9e62d621f8ULL, 0x000000002b0db8d3ULL }, { 0x2230724d0376a8e1ULL, 0xec92e06699f8cec0ULL, 0x6a6df82b1d3f568dULL, 0x00000000ee37f263ULL },
+		{ 0xe73aa9332022972fULL, 0x446dc43446d9a3e8ULL, 0xb41fd9077d9a0edbULL, 0x000000008f911954ULL }, { 0x71ea52212d3e9ed3ULL, 0x7c9ac8936fbd0d8fULL, 0x2766bdb2027379aeULL, 0x000000004aab53e4ULL },
+		{ 0xd68742173a1a85caULL, 0x349edc671411e226ULL, 0x8fed11708355e031ULL, 0x0000000018e58d29ULL }, { 0x4057b90537068c36ULL, 0x0c69d0c03d754c41ULL, 0x1c9475c5fcbc9744ULL, 0x00000000dddfc799ULL },
+		{ 0x4193e9eb7cb2fb4bULL, 0x797d94c3b7533876ULL, 0x2e0953284302509dULL, 0x00000000dab44647ULL }, { 0xd74312f971aef2b7ULL, 0x418a98649e379611ULL, 0xbd70379d3ceb27e8ULL, 0x000000001f8e0cf7ULL },
+		{ 0x702e02cf668ae9aeULL, 0x098e8c90e59b79b8ULL, 0x15fb9b5fbdcdbe77ULL, 0x000000004dc0d23aULL }, { 0xe6fef9dd6b96e052ULL, 0x31798037ccffd7dfULL, 0x8682ffeac224c902ULL, 0x0000000088fa988aULL },
+		{ 0x23f422a348c2df9cULL, 0x9986a46513debaf7ULL, 0x58f0dec6a2819154ULL, 0x00000000e95c73bdULL }, { 0xb524d9b145ded660ULL, 0xa171a8c23aba1490ULL, 0xcb89ba73dd68e621ULL, 0x000000002c66390dULL },
+		{ 0x1249c98752facd79ULL, 0xe975bc364116fb39ULL, 0x630216b15c4e7fbeULL, 0x000000007e28e7c0ULL }, { 0x849932955fe6c485ULL, 0xd182b0916872555eULL, 0xf07b720423a708cbULL, 0x00000000bb12ad70ULL },
+		{ 0x10dc6946c48f2383ULL, 0x035d3430485a1357ULL, 0x07255a763f2fec11ULL, 0x0000000070fef861ULL }, { 0x860c9254c9932a7fULL, 0x3baa3897613ebd30ULL, 0x945c3ec340c69b64ULL, 0x00000000b5c4b2d1ULL },
+		{ 0x21618262deb73166ULL, 0x73ae2c631a925299ULL, 0x3cd79201c1e002fbULL, 0x00000000e78a6c1cULL }, { 0xb7b17970d3ab389aULL, 0x4b5920c433f6fcfeULL, 0xafaef6b4be09758eULL, 0x0000000022b026acULL },
+		{ 0x72bba20ef0ff0754ULL, 0xe3a60496ecd791d6ULL, 0x71dcd798deac2dd8ULL, 0x000000004316cd9bULL }, { 0xe46b591cfde30ea8ULL, 0xdb510831c5b33fb1ULL, 0xe2a5b32da1455aadULL, 0x00000000862c872bULL },
+		{ 0x4306492aeac715b1ULL, 0x93551cc5be1fd018ULL, 0x4a2e1fef2063c332ULL, 0x00000000d46259e6ULL }, { 0xd5d6b238e7db1c4dULL, 0xaba21062977b7e7fULL, 0xd9577b5a5f8ab447ULL, 0x0000000011581356ULL },
+		{ 0xd412e2d6ac6f6b30ULL, 0xdeb654611d5d0a48ULL, 0xebca5db7e034739eULL, 0x0000000016339288ULL }, { 0x42c219c4a17362ccULL, 0xe64158c63439a42fULL, 0x78b339029fdd04ebULL, 0x00000000d309d838ULL },
+		{ 0xe5af09f2b65779d5ULL, 0xae454c324f954b86ULL, 0xd03895c01efb9d74ULL, 0x00000000814706f5ULL }, { 0x737ff2e0bb4b7029ULL, 0x96b2409566f1e5e1ULL, 0x4341f1756112ea01ULL, 0x00000000447d4c45ULL },
+		{ 0xb675299e981f4fe7ULL, 0x3e4d64c7b9d088c9ULL, 0x9d33d05901b7b257ULL, 0x0000000025dba772ULL }, { 0x20a5d28c9503461bULL, 0x06ba686090b426aeULL, 0x0e4ab4ec7e5ec522ULL, 0x00000000e0e1edc2ULL },
+		{ 0x87c8c2ba82275d02ULL, 0x4ebe7c94eb18c907ULL, 0xa6c1182eff785cbdULL, 0x00000000b2af330fULL }, { 0x111839a88f3b54feULL, 0x76497033c27c6760ULL, 0x35b87c9b80912bc8ULL, 0x00000000779579bfULL },
+	},
+	{ // 30
+		{ 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, { 0x624bc0c3494df6d4ULL, 0x338ad916b1674605ULL, 0x4ae42e121948f6b5ULL, 0x000096826a0bc3d8ULL },
+		{ 0xc4969d9b929af1b5ULL, 0x6609af2c7fce8c0aULL, 0x94d55c243290f177ULL, 0x00003119d4169badULL }, { 0xa6dd5d58dbd70761ULL, 0x5583763acea9ca0fULL, 0xde3172362bd807c2ULL, 0x0000a79bbe1d5875ULL },
+		{ 0x9531272b3929ff77ULL, 0xcc124358fe810514ULL, 0x35b7b848643dffeeULL, 0x00006232b52c2b47ULL }, { 0xf77ae7e8706409a3ULL, 0xff989a4e4fe64311ULL, 0x7f53965a7d75095bULL, 0x0000f4b0df27e89fULL },
+		{ 0x51a7bab0abb30ec2ULL, 0xaa1bec74814f891eULL, 0xa162e46c56ad0e99ULL, 0x0000532b613ab0eaULL }, { 0x33ec7a73e2fef816ULL, 0x999135623028cf1bULL, 0xeb86ca7e4fe5f82cULL, 0x0000c5a90b317332ULL },
+		{ 0x37624e567252e3eeULL, 0x852486b0e11f0a28ULL, 0x6a736d90c87ae3c1ULL, 0x0000c4647758568eULL }, { 0x55298e953b1f153aULL, 0xb6ae5fa650784c2dULL, 0x20974382d1321574ULL, 0x000052e61d539556ULL },
+		{ 0xf3f4d3cde0c8125bULL, 0xe32d299c9ed18622ULL, 0xfea631b4faea12b6ULL, 0x0000f57da34ecd23ULL }, { 0x91bf130ea985e48fULL, 0xd0a7f08a2fb6c027ULL, 0xb4421fa6e3a2e403ULL, 0x000063ffc9450efbULL },
+		{ 0xa253697d4b7b1c99ULL, 0x4936c5e81f9e0f3cULL, 0x5fc4d5d8ac471c2fULL, 0x0000a656c2747dc9ULL }, { 0xc018a9be0236ea4dULL, 0x7abc1cfeaef94939ULL, 0x1520fbcab50fea9aULL, 0x000030d4a87fbe11ULL },
+		{ 0x66c5f4e6d9e1ed2cULL, 0x2f3f6ac460508336ULL, 0xcb1189fc9ed7ed58ULL, 0x0000974f1662e664ULL }, { 0x048e342590ac1bf8ULL, 0x1cb5b3d2d137c533ULL, 0x81f5a7ee879f1bedULL, 0x000001cd7c6925bcULL },
+		{ 0x6ec49cace4a4dbc1ULL, 0x1748117ddf3e1450ULL, 0xd4e6da3d8df4db9fULL, 0x000095c8eeb0ac01ULL }, { 0x0c8f5c6fade92d15ULL, 0x24c2c86b6e595255ULL, 0x9e02f42f94bc2d2aULL, 0x0000034a84bb6fd9ULL },
+		{ 0xaa520137763e2a74ULL, 0x7141be51a0f0985aULL, 0x40338619bf642ae8ULL, 0x0000a4d13aa637acULL }, { 0xc819c1f43f73dca0ULL, 0x42cb67471197de5fULL, 0x0ad7a80ba62cdc5dULL, 0x0000325350adf474ULL },
+		{ 0xfbf5bb87dd8d24b6ULL, 0xdb5a522521bf1144ULL, 0xe1516275e9c92471ULL, 0x0000f7fa5b9c8746ULL }, { 0x99be7b4494c0d262ULL, 0xe8d08b3390d85741ULL, 0xabb54c67f081d2c4ULL, 0x000061783197449eULL },
+		{ 0x3f63261c4f17d503ULL, 0xbd53fd095e719d4eULL, 0x75843e51db59d506ULL, 0x0000c6e38f8a1cebULL }, { 0x5d28e6df065a23d7ULL, 0x8ed9241fef16db4bULL, 0x3f601043c21123b3ULL, 0x00005061e581df33ULL },
+		{ 0x59a6d2fa96f6382fULL, 0x926c97cd3e211e78ULL, 0xbe95b7ad458e385eULL, 0x000051ac99e8fa8fULL }, { 0x3bed1239dfbbcefbULL, 0xa1e64edb8f46587dULL, 0xf47199bf5cc6ceebULL, 0x0000c72ef3e33957ULL },
+		{ 0x9d304f61046cc99aULL, 0xf46538e141ef9272ULL, 0x2a40eb89771ec929ULL, 0x000060b54dfe6122ULL }, { 0xff7b8fa24d213f4eULL, 0xc7efe1f7f088d477ULL, 0x60a4c59b6e563f9cULL, 0x0000f63727f5a2faULL },
+		{ 0xcc97f5d1afdfc758ULL, 0x5e7ed495c0a01b6cULL, 0x8b220fe521b3c7b0ULL, 0x0000339e2cc4d1c8ULL }, { 0xaedc3512e692318cULL, 0x6df40d8371c75d69ULL, 0xc1c621f738fb3105ULL, 0x0000a51c46cf1210ULL },
+		{ 0x0801684a3d4536edULL, 0x38777bb9bf6e9766ULL, 0x1ff753c1132336c7ULL, 0x00000287f8d24a65ULL }, { 0x6a4aa8897408c039ULL, 0x0bfda2af0e09d163ULL, 0x55137dd30a6bc072ULL, 0x0000940592d989bdULL },
+		{ 0xdc952545d555ab9fULL, 0x2e9022faa37c28a0ULL, 0xb5d1a97a07f5ab23ULL, 0x0000378dc17d4502ULL }, { 0xbedee5869c185d4bULL, 0x1d1afbec121b6ea5ULL, 0xff3587681ebd5d96ULL, 0x0000a10fab7686daULL },
+		{ 0x1803b8de47cf5a2aULL, 0x48998dd6dcb2a4aaULL, 0x2104f55e35655a54ULL, 0x00000694156bdeafULL }, { 0x7a48781d0e82acfeULL, 0x7b1354c06dd5e2afULL, 0x6be0db4c2c2dace1ULL, 0x000090167f601d77ULL },
+		{ 0x49a4026eec7c54e8ULL, 0xe28261a25dfd2db4ULL, 0x8066113263c854cdULL, 0x000055bf74516e45ULL }, { 0x2befc2ada531a23cULL, 0xd108b8b4ec9a6bb1ULL, 0xca823f207a80a278ULL, 0x0000c33d1e5aad9dULL },
+		{ 0x8d329ff57ee6a55dULL, 0x848bce8e2233a1beULL, 0x14b34d165158a5baULL, 0x000064a6a047f5e8ULL }, { 0xef795f3637ab5389ULL, 0xb70117989354e7bbULL, 0x5e5763044810530fULL, 0x0000f224ca4c3630ULL },
+		{ 0xebf76b13a7074871ULL, 0xabb4a44a42632288ULL, 0xdfa2c4eacf8f48e2ULL, 0x0000f3e9b625138cULL }, { 0x89bcabd0ee4abea5ULL, 0x983e7d5cf304648dULL, 0x9546eaf8d6c7be57ULL, 0x0000656bdc2ed054ULL },
+		{ 0x2f61f688359db9c4ULL, 0xcdbd0b663dadae82ULL, 0x4b7798cefd1fb995ULL, 0x0000c2f062338821ULL }, { 0x4d2a364b7cd04f10ULL, 0xfe37d2708ccae887ULL, 0x0193b6dce4574f20ULL, 0x0000547208384bf9ULL },
+		{ 0x7ec64c389e2eb706ULL, 0x67a6e712bce2279cULL, 0xea157ca2abb2b70cULL, 0x000091db030938cbULL }, { 0x1c8d8cfbd76341d2ULL, 0x542c3e040d856199ULL, 0xa0f152b0b2fa41b9ULL, 0x000007596902fb13ULL },
+		{ 0xba50d1a30cb446b3ULL, 0x01af483ec32cab96ULL, 0x7ec020869922467bULL, 0x0000a0c2d71fa366ULL }, { 0xd81b116045f9b067ULL, 0x32259128724bed93ULL, 0x34240e94806ab0ceULL, 0x00003640bd1460beULL },
+		{ 0xb251b9e931f1705eULL, 0x39d833877c423cf0ULL, 0x613773478a0170bcULL, 0x0000a2452fcde903ULL }, { 0xd01a792a78bc868aULL, 0x0a52ea91cd257af5ULL, 0x2bd35d5593498609ULL, 0x000034c745c62adbULL },
+		{ 0x76c72472a36b81ebULL, 0x5fd19cab038cb0faULL, 0xf5e22f63b89181cbULL, 0x0000935cfbdb72aeULL }, { 0x148ce4b1ea26773fULL, 0x6c5b45bdb2ebf6ffULL, 0xbf060171a1d9777eULL, 0x000005de91d0b176ULL },
+		{ 0x27609ec208d88f29ULL, 0xf5ca70df82c339e4ULL, 0x5480cb0fee3c8f52ULL, 0x0000c0779ae1c244ULL }, { 0x452b5e01419579fdULL, 0xc640a9c933a47fe1ULL, 0x1e64e51df77479e7ULL, 0x000056f5f0ea019cULL },
+		{ 0xe3f603599a427e9cULL, 0x93c3dff3fd0db5eeULL, 0xc055972bdcac7e25ULL, 0x0000f16e4ef759e9ULL }, { 0x81bdc39ad30f8848ULL, 0xa04906e54c6af3ebULL, 0x8ab1b939c5e48890ULL, 0x000067ec24fc9a31ULL },
+		{ 0x8533f7bf43a393b0ULL, 0xbcfcb5379d5d36d8ULL, 0x0b441ed7427b937dULL, 0x000066215895bf8dULL }, { 0xe778377c0aee6564ULL, 0x8f766c212c3a70ddULL, 0x41a030c55b3365c8ULL, 0x0000f0a3329e7c55ULL },
+		{ 0x41a56a24d1396205ULL, 0xdaf51a1be293bad2ULL, 0x9f9142f370eb620aULL, 0x000057388c832420ULL }, { 0x23eeaae7987494d1ULL, 0xe97fc30d53f4fcd7ULL, 0xd5756ce169a394bfULL, 0x0000c1bae688e7f8ULL },
+		{ 0x1002d0947a8a6cc7ULL, 0x70eef66f63dc33ccULL, 0x3ef3a69f26466c93ULL, 0x00000413edb994caULL }, { 0x7249105733c79a13ULL, 0x43642f79d2bb75c9ULL, 0x7417888d3f0e9a26ULL, 0x0000929187b25712ULL },
+		{ 0xd4944d0fe8109d72ULL, 0x16e759431c12bfc6ULL, 0xaa26fabb14d69de4ULL, 0x0000350a39af0f67ULL }, { 0xb6df8dcca15d6ba6ULL, 0x256d8055ad75f9c3ULL, 0xe0c2d4a90d9e6b51ULL, 0x0000a38853a4ccbfULL },
+		{ 0xa5374a8ab7aa4b23ULL, 0x5c3d44e95bf8505dULL, 0x77bf4ff40ef74b46ULL, 0x00006e079ffa8a04ULL }, { 0xc77c8a49fee7bdf7ULL, 0x6fb79dffea9f1658ULL, 0x3d5b61e617bfbdf3ULL, 0x0000f885f5f149dcULL },
+		{ 0x61a1d7112530ba96ULL, 0x3a34ebc52436dc57ULL, 0xe36a13d03c67ba31ULL, 0x00005f1e4bec11a9ULL }, { 0x03ea17d26c7d4c42ULL, 0x09be32d395519a52ULL, 0xa98e3dc2252f4c84ULL, 0x0000c99c21e7d271ULL },
+		{ 0x30066da18e83b454ULL, 0x902f07b1a5795549ULL, 0x4208f7bc6acab4a8ULL, 0x00000c352ad6a143ULL }, { 0x524dad62c7ce4280ULL, 0xa3a5dea7141e134cULL, 0x08ecd9ae7382421dULL, 0x00009ab740dd629bULL },
+		{ 0xf490f03a1c1945e1ULL, 0xf626a89ddab7d943ULL, 0xd6ddab98585a45dfULL, 0x00003d2cfec03aeeULL }, { 0x96db30f95554b335ULL, 0xc5ac718b6bd09f46ULL, 0x9c39858a4112b36aULL, 0x0000abae94cbf936ULL },
+		{ 0x925504dcc5f8a8cdULL, 0xd919c259bae75a75ULL, 0x1dcc2264c68da887ULL, 0x0000aa63e8a2dc8aULL }, { 0xf01ec41f8cb55e19ULL, 0xea931b4f0b801c70ULL, 0x57280c76dfc55e32ULL, 0x00003ce182a91f52ULL },
+		{ 0x56c3994757625978ULL, 0xbf106d75c529d67fULL, 0x89197e40f41d59f0ULL, 0x00009b7a3cb44727ULL }, { 0x348859841e2fafacULL, 0x8c9ab463744e907aULL, 0xc3fd5052ed55af45ULL, 0x00000df856bf84ffULL },
+		{ 0x076423f7fcd157baULL, 0x150b810144665f61ULL, 0x287b9a2ca2b05769ULL, 0x0000c8515d8ef7cdULL }, { 0x652fe334b59ca16eULL, 0x26815817f5011964ULL, 0x629fb43ebbf8a1dcULL, 0x00005ed337853415ULL },
+		{ 0xc3f2be6c6e4ba60fULL, 0x73022e2d3ba8d36bULL, 0xbcaec6089020a61eULL, 0x0000f94889986c60ULL }, { 0xa1b97eaf270650dbULL, 0x4088f73b8acf956eULL, 0xf64ae81a896850abULL, 0x00006fcae393afb8ULL },
+		{ 0xcbf3d626530e90e2ULL, 0x4b75559484c6440dULL, 0xa35995c9830390d9ULL, 0x0000fbcf714a2605ULL }, { 0xa9b816e51a436636ULL, 0x78ff8c8235a10208ULL, 0xe9bdbbdb9a4b666cULL, 0x00006d4d1b41e5ddULL },
+		{ 0x0f654bbdc1946157ULL, 0x2d7cfab8fb08c807ULL, 0x378cc9edb19361aeULL, 0x0000cad6a55cbda8ULL }, { 0x6d2e8b7e88d99783ULL, 0x1ef623ae4a6f8e02ULL, 0x7d68e7ffa8db971bULL, 0x00005c54cf577e70ULL },
+		{ 0x5ec2f10d6a276f95ULL, 0x876716cc7a474119ULL, 0x96ee2d81e73e6f37ULL, 0x000099fdc4660d42ULL }, { 0x3c8931ce236a9941ULL, 0xb4edcfdacb20071cULL, 0xdc0a0393fe769982ULL, 0x00000f7fae6dce9aULL },
+		{ 0x9a546c96f8bd9e20ULL, 0xe16eb9e00589cd13ULL, 0x023b71a5d5ae9e40ULL, 0x0000a8e4107096efULL }, { 0xf81fac55b1f068f4ULL, 0xd2e460f6b4ee8b16ULL, 0x48df5fb7cce668f5ULL, 0x00003e667a7b5537ULL },
+		{ 0xfc919870215c730cULL, 0xce51d32465d94e25ULL, 0xc92af8594b797318ULL, 0x00003fab0612708bULL }, { 0x9eda58b3681185d8ULL, 0xfddb0a32d4be0820ULL, 0x83ced64b523185adULL, 0x0000a9296c19b353ULL },
+		{ 0x380705ebb3c682b9ULL, 0xa8587c081a17c22fULL, 0x5dffa47d79e9826fULL, 0x00000eb2d204eb26ULL }, { 0x5a4cc528fa8b746dULL, 0x9bd2a51eab70842aULL, 0x171b8a6f60a174daULL, 0x00009830b80f28feULL },
+		{ 0x69a0bf5b18758c7bULL, 0x0243907c9b584b31ULL, 0xfc9d40112f448cf6ULL, 0x00005d99b33e5bccULL }, { 0x0beb7f9851387aafULL, 0x31c9496a2a3f0d34ULL, 0xb6796e03360c7a43ULL, 0x0000cb1bd9359814ULL },
+		{ 0xad3622c08aef7dceULL, 0x644a3f50e496c73bULL, 0x68481c351dd47d81ULL, 0x00006c806728c061ULL }, { 0xcf7de203c3a28b1aULL, 0x57c0e64655f1813eULL, 0x22ac3227049c8b34ULL, 0x0000fa020d2303b9ULL },
+		{ 0x79a26fcf62ffe0bcULL, 0x72ad6613f88478fdULL, 0xc26ee68e0902e065ULL, 0x0000598a5e87cf06ULL }, { 0x1be9af0c2bb21668ULL, 0x4127bf0549e33ef8ULL, 0x888ac89c104a16d0ULL, 0x0000cf08348c0cdeULL },
+		{ 0xbd34f254f0651109ULL, 0x14a4c93f874af4f7ULL, 0x56bbbaaa3b921112ULL, 0x000068938a9154abULL }, { 0xdf7f3297b928e7ddULL, 0x272e1029362db2f2ULL, 0x1c5f94b822dae7a7ULL, 0x0000fe11e09a9773ULL },
+		{ 0xec9348e45bd61fcbULL, 0xbebf254b06057de9ULL, 0xf7d95ec66d3f1f8bULL, 0x00003bb8ebabe441ULL }, { 0x8ed88827129be91fULL, 0x8d35fc5db7623becULL, 0xbd3d70d47477e93eULL, 0x0000ad3a81a02799ULL },
+		{ 0x2805d57fc94cee7eULL, 0xd8b68a6779cbf1e3ULL, 0x630c02e25fafeefcULL, 0x00000aa13fbd7fecULL }, { 0x4a4e15bc800118aaULL, 0xeb3c5371c8acb7e6ULL, 0x29e82cf046e71849ULL, 0x00009c2355b6bc34ULL },
+		{ 0x4ec0219910ad0352ULL, 0xf789e0a3199b72d5ULL, 0xa81d8b1ec17803a4ULL, 0x00009dee29df9988ULL }, { 0x2c8be15a59e0f586ULL, 0xc40339b5a8fc34d0ULL, 0xe2f9a50cd830f511ULL, 0x00000b6c43d45a50ULL },
+		{ 0x8a56bc028237f2e7ULL, 0x91804f8f6655fedfULL, 0x3cc8d73af3e8f2d3ULL, 0x0000acf7fdc90225ULL }, { 0xe81d7cc1cb7a0433ULL, 0xa20a9699d732b8daULL, 0x762cf928eaa00466ULL, 0x00003a7597c2c1fdULL },
+		{ 0xdbf106b22984fc25ULL, 0x3b9ba3fbe71a77c1ULL, 0x9daa3356a545fc4aULL, 0x0000ffdc9cf3b2cfULL }, { 0xb9bac67160c90af1ULL, 0x08117aed567d31c4ULL, 0xd74e1d44bc0d0affULL, 0x0000695ef6f87117ULL },
+		{ 0x1f679b29bb1e0d90ULL, 0x5d920cd798d4fbcbULL, 0x097f6f7297d50d3dULL, 0x0000cec548e52962ULL }, { 0x7d2c5beaf253fb44ULL, 0x6e18d5c129b3bdceULL, 0x439b41608e9dfb88ULL, 0x0000584722eeeabaULL },
+		{ 0x1766f363865b3b7dULL, 0x65e5776e27ba6cadULL, 0x16883cb384f63bfaULL, 0x0000cc42b0376307ULL }, { 0x752d33a0cf16cda9ULL, 0x566fae7896dd2aa8ULL, 0x5c6c12a19dbecd4fULL, 0x00005ac0da3ca0dfULL },
+		{ 0xd3f06ef814c1cac8ULL, 0x03ecd8425874e0a7ULL, 0x825d6097b666ca8dULL, 0x0000fd5b6421f8aaULL }, { 0xb1bbae3b5d8c3c1cULL, 0x30660154e913a6a2ULL, 0xc8b94e85af2e3c38ULL, 0x00006bd90e2a3b72ULL },
+		{ 0x8257d448bf72c40aULL, 0xa9f73436d93b69b9ULL, 0x233f84fbe0cbc414ULL, 0x0000ae70051b4840ULL }, { 0xe01c148bf63f32deULL, 0x9a7ded20685c2fbcULL, 0x69dbaae9f98332a1ULL, 0x000038f26f108b98ULL },
+		{ 0x46c149d32de835bfULL, 0xcffe9b1aa6f5e5b3ULL, 0xb7ead8dfd25b3563ULL, 0x00009f69d10dd3edULL }, { 0x248a891064a5c36bULL, 0xfc74420c1792a3b6ULL, 0xfd0ef6cdcb13c3d6ULL, 0x000009ebbb061035ULL },
+		{ 0x2004bd35f409d893ULL, 0xe0c1f1dec6a56685ULL, 0x7cfb51234c8cd83bULL, 0x00000826c76f3589ULL }, { 0x424f7df6bd442e47ULL, 0xd34b28c877c22080ULL, 0x361f7f3155c42e8eULL, 0x00009ea4ad64f651ULL },
+		{ 0xe49220ae66932926ULL, 0x86c85ef2b96bea8fULL, 0xe82e0d077e1c294cULL, 0x0000393f1379ae24ULL }, { 0x86d9e06d2fdedff2ULL, 0xb54287e4080cac8aULL, 0xa2ca23156754dff9ULL, 0x0000afbd79726dfcULL },
+		{ 0xb5359a1ecd2027e4ULL, 0x2cd3b28638246391ULL, 0x494ce96b28b127d5ULL, 0x00006a1472431eceULL }, { 0xd77e5add846dd130ULL, 0x1f596b9089432594ULL, 0x03a8c77931f9d160ULL, 0x0000fc961848dd16ULL },
+		{ 0x71a307855fbad651ULL, 0x4ada1daa47eaef9bULL, 0xdd99b54f1a21d6a2ULL, 0x00005b0da6558563ULL }, { 0x13e8c74616f72085ULL, 0x7950c4bcf68da99eULL, 0x977d9b5d03692017ULL, 0x0000cd8fcc5e46bbULL },
+		{ 0x576e940973499646ULL, 0xb87a88cfb6eda0baULL, 0xee639ef51cf3968cULL, 0x0000dc0e23e90908ULL }, { 0x352554ca3a046092ULL, 0x8bf051d9078ae6bfULL, 0xa487b0e705bb6039ULL, 0x00004a8c49e2cad0ULL },
+		{ 0x93f80992e1d367f3ULL, 0xde7327e3c9232cb0ULL, 0x7ab6c2d12e6367fbULL, 0x0000ed17f7ff92a5ULL }, { 0xf1b3c951a89e9127ULL, 0xedf9fef578446ab5ULL, 0x3052ecc3372b914eULL, 0x00007b959df4517dULL },
+		{ 0xc25fb3224a606931ULL, 0x7468cb97486ca5aeULL, 0xdbd426bd78ce6962ULL, 0x0000be3c96c5224fULL }, { 0xa01473e1032d9fe5ULL, 0x47e21281f90be3abULL, 0x913008af61869fd7ULL, 0x000028befccee197ULL },
+		{ 0x06c92eb9d8fa9884ULL, 0x126164bb37a229a4ULL, 0x4f017a994a5e9815ULL, 0x00008f2542d3b9e2ULL }, { 0x6482ee7a91b76e50ULL, 0x21ebbdad86c56fa1ULL, 0x05e5548b53166ea0ULL, 0x000019a728d87a3aULL },
+		{ 0x600cda5f011b75a8ULL, 0x3d5e0e7f57f2aa92ULL, 0x8410f365d489754dULL, 0x0000186a54b15f86ULL }, { 0x02471a9c4856837cULL, 0x0ed4d769e695ec97ULL, 0xcef4dd77cdc183f8ULL, 0x00008ee83eba9c5eULL },
+		{ 0xa49a47c49381841dULL, 0x5b57a153283c2698ULL, 0x10c5af41e619843aULL, 0x0000297380a7c42bULL }, { 0xc6d18707dacc72c9ULL, 0x68dd7845995b609dULL, 0x5a218153ff51728fULL, 0x0000bff1eaac07f3ULL },
+		{ 0xf53dfd7438328adfULL, 0xf14c4d27a973af86ULL, 0xb1a74b2db0b48aa3ULL, 0x00007a58e19d74c1ULL }, { 0x97763db7717f7c0bULL, 0xc2c694311814e983ULL, 0xfb43653fa9fc7c16ULL, 0x0000ecda8b96b719ULL },
+		{ 0x31ab60efaaa87b6aULL, 0x9745e20bd6bd238cULL, 0x2572170982247bd4ULL, 0x00004b41358bef6cULL }, { 0x53e0a02ce3e58dbeULL, 0xa4cf3b1d67da6589ULL, 0x6f96391b9b6c8d61ULL, 0x0000ddc35f802cb4ULL },
+		{ 0x39aa08a597ed4d87ULL, 0xaf3299b269d3b4eaULL, 0x3a8544c891074d13ULL, 0x000049c6cd59a509ULL }, { 0x5be1c866dea0bb53ULL, 0x9cb840a4d8b4f2efULL, 0x70616ada884fbba6ULL, 0x0000df44a75266d1ULL },
+		{ 0xfd3c953e0577bc32ULL, 0xc93b369e161d38e0ULL, 0xae5018eca397bc64ULL, 0x000078df194f3ea4ULL }, { 0x9f7755fd4c3a4ae6ULL, 0xfab1ef88a77a7ee5ULL, 0xe4b436febadf4ad1ULL, 0x0000ee5d7344fd7cULL },
+		{ 0xac9b2f8eaec4b2f0ULL, 0x6320daea9752b1feULL, 0x0f32fc80f53ab2fdULL, 0x00002bf478758e4eULL }, { 0xced0ef4de7894424ULL, 0x50aa03fc2635f7fbULL, 0x45d6d292ec724448ULL, 0x0000bd76127e4d96ULL },
+		{ 0x680db2153c5e4345ULL, 0x052975c6e89c3df4ULL, 0x9be7a0a4c7aa438aULL, 0x00001aedac6315e3ULL }, { 0x0a4672d67513b591ULL, 0x36a3acd059fb7bf1ULL, 0xd1038eb6dee2b53fULL, 0x00008c6fc668d63bULL },
+		{ 0x0ec846f3e5bfae69ULL, 0x2a161f0288ccbec2ULL, 0x50f62958597daed2ULL, 0x00008da2ba01f387ULL }, { 0x6c838630acf258bdULL, 0x199cc61439abf8c7ULL, 0x1a12074a40355867ULL, 0x00001b20d00a305fULL },
+		{ 0xca5edb6877255fdcULL, 0x4c1fb02ef70232c8ULL, 0xc423757c6bed5fa5ULL, 0x0000bcbb6e17682aULL }, { 0xa8151bab3e68a908ULL, 0x7f956938466574cdULL, 0x8ec75b6e72a5a910ULL, 0x00002a39041cabf2ULL },
+		{ 0x9bf961d8dc96511eULL, 0xe6045c5a764dbbd6ULL, 0x654191103d40513cULL, 0x0000ef900f2dd8c0ULL }, { 0xf9b2a11b95dba7caULL, 0xd58e854cc72afdd3ULL, 0x2fa5bf022408a789ULL, 0x0000791265261b18ULL },
+		{ 0x5f6ffc434e0ca0abULL, 0x800df376098337dcULL, 0xf194cd340fd0a04bULL, 0x0000de89db3b436dULL }, { 0x3d243c800741567fULL, 0xb3872a60b8e471d9ULL, 0xbb70e326169856feULL, 0x0000480bb13080b5ULL },
+		{ 0x8bfbb14ca61c3dd9ULL, 0x96eaaa351591881aULL, 0x5bb2378f1b063dafULL, 0x0000eb83e2944c0aULL }, { 0xe9b0718fef51cb0dULL, 0xa5607323a4f6ce1fULL, 0x1156199d024ecb1aULL, 0x00007d01889f8fd2ULL },
+		{ 0x4f6d2cd73486cc6cULL, 0xf0e305196a5f0410ULL, 0xcf676bab2996ccd8ULL, 0x0000da9a3682d7a7ULL }, { 0x2d26ec147dcb3ab8ULL, 0xc369dc0fdb384215ULL, 0x858345b930de3a6dULL, 0x00004c185c89147fULL },
+		{ 0x1eca96679f35c2aeULL, 0x5af8e96deb108d0eULL, 0x6e058fc77f3bc241ULL, 0x000089b157b8674dULL }, { 0x7c8156a4d678347aULL, 0x6972307b5a77cb0bULL, 0x24e1a1d5667334f4ULL, 0x00001f333db3a495ULL },
+		{ 0xda5c0bfc0daf331bULL, 0x3cf1464194de0104ULL, 0xfad0d3e34dab3336ULL, 0x0000b8a883aefce0ULL }, { 0xb817cb3f44e2c5cfULL, 0x0f7b9f5725b94701ULL, 0xb034fdf154e3c583ULL, 0x00002e2ae9a53f38ULL },
+		{ 0xbc99ff1ad44ede37ULL, 0x13ce2c85f48e8232ULL, 0x31c15a1fd37cde6eULL, 0x00002fe795cc1a84ULL }, { 0xded23fd99d0328e3ULL, 0x2044f59345e9c437ULL, 0x7b25740dca3428dbULL, 0x0000b965ffc7d95cULL },
+		{ 0x780f628146d42f82ULL, 0x75c783a98b400e38ULL, 0xa514063be1ec2f19ULL, 0x00001efe41da8129ULL }, { 0x1a44a2420f99d956ULL, 0x464d5abf3a27483dULL, 0xeff02829f8a4d9acULL, 0x0000887c2bd142f1ULL },
+		{ 0x29a8d831ed672140ULL, 0xdfdc6fdd0a0f8726ULL, 0x0476e257b7412180ULL, 0x00004dd520e031c3ULL }, { 0x4be318f2a42ad794ULL, 0xec56b6cbbb68c123ULL, 0x4e92cc45ae09d735ULL, 0x0000db574aebf21bULL },
+		{ 0xed3e45aa7ffdd0f5ULL, 0xb9d5c0f175c10b2cULL, 0x90a3be7385d1d0f7ULL, 0x00007cccf4f6aa6eULL }, { 0x8f75856936b02621ULL, 0x8a5f19e7c4a64d29ULL, 0xda4790619c992642ULL, 0x0000ea4e9efd69b6ULL },
+		{ 0xe53f2de042b8e618ULL, 0x81a2bb48caaf9c4aULL, 0x8f54edb296f2e630ULL, 0x00007e4b0c24e00bULL }, { 0x8774ed230bf510ccULL, 0xb228625e7bc8da4fULL, 0xc5b0c3a08fba1085ULL, 0x0000e8c9662f23d3ULL },
+		{ 0x21a9b07bd02217adULL, 0xe7ab1464b5611040ULL, 0x1b81b196a4621747ULL, 0x00004f52d8327ba6ULL }, { 0x43e270b8996fe179ULL, 0xd421cd7204065645ULL, 0x51659f84bd2ae1f2ULL, 0x0000d9d0b239b87eULL },
+		{ 0x700e0acb7b91196fULL, 0x4db0f810342e995eULL, 0xbae355faf2cf19deULL, 0x00001c79b908cb4cULL }, { 0x1245ca0832dcefbbULL, 0x7e3a21068549df5bULL, 0xf0077be8eb87ef6bULL, 0x00008afbd3030894ULL },
+		{ 0xb4989750e90be8daULL, 0x2bb9573c4be01554ULL, 0x2e3609dec05fe8a9ULL, 0x00002d606d1e50e1ULL }, { 0xd6d35793a0461e0eULL, 0x18338e2afa875351ULL, 0x64d227ccd9171e1cULL, 0x0000bbe207159339ULL },
+		{ 0xd25d63b630ea05f6ULL, 0x04863df82bb09662ULL, 0xe52780225e8805f1ULL, 0x0000ba2f7b7cb685ULL }, { 0xb016a37579a7f322ULL, 0x370ce4ee9ad7d067ULL, 0xafc3ae3047c0f344ULL, 0x00002cad1177755dULL },
+		{ 0x16cbfe2da270f443ULL, 0x628f92d4547e1a68ULL, 0x71f2dc066c18f486ULL, 0x00008b36af6a2d28ULL }, { 0x74803eeeeb3d0297ULL, 0x51054bc2e5195c6dULL, 0x3b16f21475500233ULL, 0x00001db4c561eef0ULL },
+		{ 0x476c449d09c3fa81ULL, 0xc8947ea0d5319376ULL, 0xd090386a3ab5fa1fULL, 0x0000d81dce509dc2ULL }, { 0x2527845e408e0c55ULL, 0xfb1ea7b66456d573ULL, 0x9a74167823fd0caaULL, 0x00004e9fa45b5e1aULL },
+		{ 0x83fad9069b590b34ULL, 0xae9dd18caaff1f7cULL, 0x4445644e08250b68ULL, 0x0000e9041a46066fULL }, { 0xe1b119c5d214fde0ULL, 0x9d17089a1b985979ULL, 0x0ea14a5c116dfdddULL, 0x00007f86704dc5b7ULL },
+		{ 0xf259de83c4e3dd65ULL, 0xe447cc26ed15f0e7ULL, 0x99dcd1011204ddcaULL, 0x0000b209bc13830cULL }, { 0x90121e408dae2bb1ULL, 0xd7cd15305c72b6e2ULL, 0xd338ff130b4c2b7fULL, 0x0000248bd61840d4ULL },
+		{ 0x36cf431856792cd0ULL, 0x824e630a92db7cedULL, 0x0d098d2520942cbdULL, 0x00008310680518a1ULL }, { 0x548483db1f34da04ULL, 0xb1c4ba1c23bc3ae8ULL, 0x47eda33739dcda08ULL, 0x00001592020edb79ULL },
+		{ 0x6768f9a8fdca2212ULL, 0x28558f7e1394f5f3ULL, 0xac6b694976392224ULL, 0x0000d03b093fa84bULL }, { 0x0523396bb487d4c6ULL, 0x1bdf5668a2f3b3f6ULL, 0xe68f475b6f71d491ULL, 0x000046b963346b93ULL },
+		{ 0xa3fe64336f50d3a7ULL, 0x4e5c20526c5a79f9ULL, 0x38be356d44a9d353ULL, 0x0000e122dd2933e6ULL }, { 0xc1b5a4f0261d2573ULL, 0x7dd6f944dd3d3ffcULL, 0x725a1b7f5de125e6ULL, 0x000077a0b722f03eULL },
+		{ 0xc53b90d5b6b13e8bULL, 0x61634a960c0afacfULL, 0xf3afbc91da7e3e0bULL, 0x0000766dcb4bd582ULL }, { 0xa7705016fffcc85fULL, 0x52e99380bd6dbccaULL, 0xb94b9283c336c8beULL, 0x0000e0efa140165aULL },
+		{ 0x01ad0d4e242bcf3eULL, 0x076ae5ba73c476c5ULL, 0x677ae0b5e8eecf7cULL, 0x000047741f5d4e2fULL }, { 0x63e6cd8d6d6639eaULL, 0x34e03cacc2a330c0ULL, 0x2d9ecea7f1a639c9ULL, 0x0000d1f675568df7ULL },
+		{ 0x500ab7fe8f98c1fcULL, 0xad7109cef28bffdbULL, 0xc61804d9be43c1e5ULL, 0x0000145f7e67fec5ULL }, { 0x3241773dc6d53728ULL, 0x9efbd0d843ecb9deULL, 0x8cfc2acba70b3750ULL, 0x000082dd146c3d1dULL },
+		{ 0x949c2a651d023049ULL, 0xcb78a6e28d4573d1ULL, 0x52cd58fd8cd33092ULL, 0x00002546aa716568ULL }, { 0xf6d7eaa6544fc69dULL, 0xf8f27ff43c2235d4ULL, 0x182976ef959bc627ULL, 0x0000b3c4c07aa6b0ULL },
+		{ 0x9c9d422f204706a4ULL, 0xf30fdd5b322be4b7ULL, 0x4d3a0b3c9ff00655ULL, 0x000027c152a32f0dULL }, { 0xfed682ec690af070ULL, 0xc085044d834ca2b2ULL, 0x07de252e86b8f0e0ULL, 0x0000b14338a8ecd5ULL },
+		{ 0x580bdfb4b2ddf711ULL, 0x950672774de568bdULL, 0xd9ef5718ad60f722ULL, 0x000016d886b5b4a0ULL }, { 0x3a401f77fb9001c5ULL, 0xa68cab61fc822eb8ULL, 0x930b790ab4280197ULL, 0x0000805aecbe7778ULL },
+		{ 0x09ac6504196ef9d3ULL, 0x3f1d9e03ccaae1a3ULL, 0x788db374fbcdf9bbULL, 0x000045f3e78f044aULL }, { 0x6be7a5c750230f07ULL, 0x0c9747157dcda7a6ULL, 0x32699d66e2850f0eULL, 0x0000d3718d84c792ULL },
+		{ 0xcd3af89f8bf40866ULL, 0x5914312fb3646da9ULL, 0xec58ef50c95d08ccULL, 0x000074ea33999fe7ULL }, { 0xaf71385cc2b9feb2ULL, 0x6a9ee83902032bacULL, 0xa6bcc142d015fe79ULL, 0x0000e26859925c3fULL },
+		{ 0xabff0c795215e54aULL, 0x762b5bebd334ee9fULL, 0x274966ac578ae594ULL, 0x0000e3a525fb7983ULL }, { 0xc9b4ccba1b58139eULL, 0x45a182fd6253a89aULL, 0x6dad48be4ec21321ULL, 0x000075274ff0ba5bULL },
+		{ 0x6f6991e2c08f14ffULL, 0x1022f4c7acfa6295ULL, 0xb39c3a88651a14e3ULL, 0x0000d2bcf1ede22eULL }, { 0x0d22512189c2e22bULL, 0x23a82dd11d9d2490ULL, 0xf978149a7c52e256ULL, 0x0000443e9be621f6ULL },
+		{ 0x3ece2b526b3c1a3dULL, 0xba3918b32db5eb8bULL, 0x12fedee433b71a7aULL, 0x0000819790d752c4ULL }, { 0x5c85eb912271ece9ULL, 0x89b3c1a59cd2ad8eULL, 0x581af0f62affeccfULL, 0x00001715fadc911cULL },
+		{ 0xfa58b6c9f9a6eb88ULL, 0xdc30b79f527b6781ULL, 0x862b82c00127eb0dULL, 0x0000b08e44c1c969ULL }, { 0x9813760ab0eb1d5cULL, 0xefba6e89e31c2184ULL, 0xcccfacd2186f1db8ULL, 0x0000260c2eca0ab1ULL },
+		{ 0x2eccfbc611b676faULL, 0xcad7eedc4e69d847ULL, 0x2c0d787b15f176e9ULL, 0x000085847d6ec60eULL }, { 0x4c873b0558fb802eULL, 0xf95d37caff0e9e42ULL, 0x66e956690cb9805cULL, 0x00001306176505d6ULL },
+		{ 0xea5a665d832c874fULL, 0xacde41f031a7544dULL, 0xb8d8245f2761879eULL, 0x0000b49da9785da3ULL }, { 0x8811a69eca61719bULL, 0x9f5498e680c01248ULL, 0xf23c0a4d3e29712bULL, 0x0000221fc3739e7bULL },
+		{ 0xbbfddced289f898dULL, 0x06c5ad84b0e8dd53ULL, 0x19bac03371cc8907ULL, 0x0000e7b6c842ed49ULL }, { 0xd9b61c2e61d27f59ULL, 0x354f7492018f9b56ULL, 0x535eee2168847fb2ULL, 0x00007134a2492e91ULL },
+		{ 0x7f6b4176ba057838ULL, 0x60cc02a8cf265159ULL, 0x8d6f9c17435c7870ULL, 0x0000d6af1c5476e4ULL }, { 0x1d2081b5f3488eecULL, 0x5346dbbe7e41175cULL, 0xc78bb2055a148ec5ULL, 0x0000402d765fb53cULL },
+		{ 0x19aeb59063e49514ULL, 0x4ff3686caf76d26fULL, 0x467e15ebdd8b9528ULL, 0x000041e00a369080ULL }, { 0x7be575532aa963c0ULL, 0x7c79b17a1e11946aULL, 0x0c9a3bf9c4c3639dULL, 0x0000d762603d5358ULL },
+		{ 0xdd38280bf17e64a1ULL, 0x29fac740d0b85e65ULL, 0xd2ab49cfef1b645fULL, 0x000070f9de200b2dULL }, { 0xbf73e8c8b8339275ULL, 0x1a701e5661df1860ULL, 0x984f67ddf65392eaULL, 0x0000e67bb42bc8f5ULL },
+		{ 0x8c9f92bb5acd6a63ULL, 0x83e12b3451f7d77bULL, 0x73c9ada3b9b66ac6ULL, 0x000023d2bf1abbc7ULL }, { 0xeed4527813809cb7ULL, 0xb06bf222e090917eULL, 0x392d83b1a0fe9c73ULL, 0x0000b550d511781fULL },
+		{ 0x48090f20c8579bd6ULL, 0xe5e884182e395b71ULL, 0xe71cf1878b269bb1ULL, 0x000012cb6b0c206aULL }, { 0x2a42cfe3811a6d02ULL, 0xd6625d0e9f5e1d74ULL, 0xadf8df95926e6d04ULL, 0x000084490107e3b2ULL },
+		{ 0x4008676af512ad3bULL, 0xdd9fffa19157cc17ULL, 0xf8eba2469805ad76ULL, 0x0000104c93de6a0fULL }, { 0x2243a7a9bc5f5befULL, 0xee1526b720308a12ULL, 0xb20f8c54814d5bc3ULL, 0x000086cef9d5a9d7ULL },
+		{ 0x849efaf167885c8eULL, 0xbb96508dee99401dULL, 0x6c3efe62aa955c01ULL, 0x0000215547c8f1a2ULL }, { 0xe6d53a322ec5aa5aULL, 0x881c899b5ffe0618ULL, 0x26dad070b3ddaab4ULL, 0x0000b7d72dc3327aULL },
+		{ 0xd5394041cc3b524cULL, 0x118dbcf96fd6c903ULL, 0xcd5c1a0efc385298ULL, 0x0000727e26f24148ULL }, { 0xb77280828576a498ULL, 0x220765efdeb18f06ULL, 0x87b8341ce570a42dULL, 0x0000e4fc4cf98290ULL },
+		{ 0x11afddda5ea1a3f9ULL, 0x778413d510184509ULL, 0x5989462acea8a3efULL, 0x00004367f2e4dae5ULL }, { 0x73e41d1917ec552dULL, 0x440ecac3a17f030cULL, 0x136d6838d7e0555aULL, 0x0000d5e598ef193dULL },
+		{ 0x776a293c87404ed5ULL, 0x58bb79117048c63fULL, 0x9298cfd6507f4eb7ULL, 0x0000d428e4863c81ULL }, { 0x1521e9ffce0db801ULL, 0x6b31a007c12f803aULL, 0xd87ce1c44937b802ULL, 0x000042aa8e8dff59ULL },
+		{ 0xb3fcb4a715dabf60ULL, 0x3eb2d63d0f864a35ULL, 0x064d93f262efbfc0ULL, 0x0000e5313090a72cULL }, { 0xd1b774645c9749b4ULL, 0x0d380f2bbee10c30ULL, 0x4ca9bde07ba74975ULL, 0x000073b35a9b64f4ULL },
+		{ 0xe25b0e17be69b1a2ULL, 0x94a93a498ec9c32bULL, 0xa72f779e3442b159ULL, 0x0000b61a51aa17c6ULL }, { 0x8010ced4f7244776ULL, 0xa723e35f3fae852eULL, 0xedcb598c2d0a47ecULL, 0x000020983ba1d41eULL },
+		{ 0x26cd938c2cf34017ULL, 0xf2a09565f1074f21ULL, 0x33fa2bba06d2402eULL, 0x0000870385bc8c6bULL }, { 0x4486534f65beb6c3ULL, 0xc12a4c7340600924ULL, 0x791e05a81f9ab69bULL, 0x00001181efb74fb3ULL },
+	},
+};
+
+// split-nibble tables of every generator coefficient: products with the 16 low nibbles, then the 16 high nibbles
+static const nibble_table GENERATOR_NIBBLES[ECC_DEGREE_COUNT][MAX_ECC_LENGTH] =
+{
+	{ // 7
+		{ {   0, 127, 254, 129, 225, 158,  31,  96, 223, 160,  33,  94,  62,  65, 192, 191 }, {   0, 163,  91, 248, 182,  21, 237,  78, 113, 210,  42, 137, 199, 100, 156,  63 } },
+		{ {   0, 122, 244, 142, 245, 143,   1, 123, 247, 141,   3, 121,   2, 120, 246, 140 }, {   0, 243, 251,   8, 235,  24,  16, 227, 203,  56,  48, 195,  32, 211, 219,  40 } },
+		{ {   0, 154,  41, 179,  82, 200, 123, 225, 164,  62, 141,  23, 246, 108, 223,  69 }, {   0,  85, 170, 255,  73,  28, 227, 182, 146, 199,  56, 109, 219, 142, 113,  36 } },
+		{ {   0, 164,  85, 241, 170,  14, 255,  91,  73, 237,  28, 184, 227,  71, 182,  18 }, {   0, 146,  57, 171, 114, 224,  75, 217, 228, 118, 221,  79, 150,   4, 175,  61 } },
+		{ {   0,  11,  22,  29,  44,  39,  58,  49,  88,  83,  78,  69, 116, 127,  98, 105 }, {   0, 176, 125, 205, 250,  74, 135,  55, 233,  89, 148,  36,  19, 163, 110, 222 } },
+		{ {   0,  68, 136, 204,  13,  73, 133, 193,  26,  94, 146, 214,  23,  83, 159, 219 }, {   0,  52, 104,  92, 208, 228, 184, 140, 189, 137, 213, 225, 109,  89,   5,  49 } },
+		{ {   0, 117, 234, 159, 201, 188,  35,  86, 143, 250, 101,  16,  70,  51, 172, 217 }, {   0,   3,   6,   5,  12,  15,  10,   9,  24,  27,  30,  29,  20,  23,  18,  17 } },
+	},
+	{ // 10
+		{ {   0, 216, 173, 117,  71, 159, 234,  50, 142,  86,  35, 251, 201,  17, 100, 188 }, {   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15 } },
+		{ {   0, 194, 153,  91,  47, 237, 182, 116,  94, 156, 199,   5, 113, 179, 232,  42 }, {   0, 188, 101, 217, 202, 118, 175,  19, 137,  53, 236,  80,  67, 255,  38, 154 } },
+		{ {   0, 159,  35, 188,  70, 217, 101, 250, 140,  19, 175,  48, 202,  85, 233, 118 }, {   0,   5,  10,  15,  20,  17,  30,  27,  40,  45,  34,  39,  60,  57,  54,  51 } },
+		{ {   0, 111, 222, 177, 161, 206, 127,  16,  95,  48, 129, 238, 254, 145,  32,  79 }, {   0, 190,  97, 223, 194, 124, 163,  29, 153,  39, 248,  70,  91, 229,  58, 132 } },
+		{ {   0, 199, 147,  84,  59, 252, 168, 111, 118, 177, 229,  34,  77, 138, 222,  25 }, {   0, 236, 197,  41, 151, 123,  82, 190,  51, 223, 246,  26, 164,  72,  97, 141 } },
+		{ {   0,  94, 188, 226, 101,  59, 217, 135, 202, 148, 118,  40, 175, 241,  19,  77 }, {   0, 137,  15, 134,  30, 151,  17, 152,  60, 181,  51, 186,  34, 171,  45, 164 } },
+		{ {   0,  95, 190, 225,  97,  62, 223, 128, 194, 157, 124,  35, 163, 252,  29,  66 }, {   0, 153,  47, 182,  94, 199, 113, 232, 188,  37, 147,  10, 226, 123, 205,  84 } },
+		{ {   0, 113, 226, 147, 217, 168,  59,  74, 175, 222,  77,  60, 118,   7, 148, 229 }, {   0,  67, 134, 197,  17,  82, 151, 212,  34,  97, 164, 231,  51, 112, 181, 246 } },
+		{ {   0, 157,  39, 186,  78, 211, 105, 244, 156,   1, 187,  38, 210,  79, 245, 104 }, {   0,  37,  74, 111, 148, 177, 222, 251,  53,  16, 127,  90, 161, 132, 235, 206 } },
+		{ {   0, 193, 159,  94,  35, 226, 188, 125,  70, 135, 217,  24, 101, 164, 250,  59 }, {   0, 140,   5, 137,  10, 134,  15, 131,  20, 152,  17, 157,  30, 146,  27, 151 } },
+	},
+	{ // 13
+		{ {   0, 137,  15, 134,  30, 151,  17, 152,  60, 181,  51, 186,  34, 171,  45, 164 }, {   0, 120, 240, 136, 253, 133,  13, 117, 231, 159,  23, 111,  26,  98, 234, 146 } },
+		{ {   0,  73, 146, 219,  57, 112, 171, 226, 114,  59, 224, 169,  75,   2, 217, 144 }, {   0, 228, 213,  49, 183,  83,  98, 134, 115, 151, 166,  66, 196,  32,  17, 245 } },
+		{ {   0, 227, 219,  56, 171,  72, 112, 147,  75, 168, 144, 115, 224,   3,  59, 216 }, {   0, 150,  49, 167,  98, 244,  83, 197, 196,  82, 245,  99, 166,  48, 151,   1 } },
+		{ {   0,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255 }, {   0,  13,  26,  23,  52,  57,  46,  35, 104, 101, 114, 127,  92,  81,  70,  75 } },
+		{ {   0, 177, 127, 206, 254,  79, 129,  48, 225,  80, 158,  47,  31, 174,  96, 209 }, {   0, 223, 163, 124,  91, 132, 248,  39, 182, 105,  21, 202, 237,  50,  78, 145 } },
+		{ {   0,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255 }, {   0,  13,  26,  23,  52,  57,  46,  35, 104, 101, 114, 127,  92,  81,  70,  75 } },
+		{ {   0,  52, 104,  92, 208, 228, 184, 140, 189, 137, 213, 225, 109,  89,   5,  49 }, {   0, 103, 206, 169, 129, 230,  79,  40,  31, 120, 209, 182, 158, 249,  80,  55 } },
+		{ {   0,  13,  26,  23,  52,  57,  46,  35, 104, 101, 114, 127,  92,  81,  70,  75 }, {   0, 208, 189, 109, 103, 183, 218,  10, 206,  30, 115, 163, 169, 121,  20, 196 } },
+		{ {   0,  46,  92, 114, 184, 150, 228, 202, 109,  67,  49,  31, 213, 251, 137, 167 }, {   0, 218, 169, 115,  79, 149, 230,  60, 158,  68,  55, 237, 209,  11, 120, 162 } },
+		{ {   0,  43,  86, 125, 172, 135, 250, 209,  69, 110,  19,  56, 233, 194, 191, 148 }, {   0, 138,   9, 131,  18, 152,  27, 145,  36, 174,  45, 167,  54, 188,  63, 181 } },
+		{ {   0,  83, 166, 245,  81,   2, 247, 164, 162, 241,   4,  87, 243, 160,  85,   6 }, {   0,  89, 178, 235, 121,  32, 203, 146, 242, 171,  64,  25, 139, 210,  57,  96 } },
+		{ {   0, 132,  21, 145,  42, 174,  63, 187,  84, 208,  65, 197, 126, 250, 107, 239 }, {   0, 168,  77, 229, 154,  50, 215, 127,  41, 129, 100, 204, 179,  27, 254,  86 } },
+		{ {   0, 120, 240, 136, 253, 133,  13, 117, 231, 159,  23, 111,  26,  98, 234, 146 }, {   0, 211, 187, 104, 107, 184, 208,   3, 214,   5, 109, 190, 189, 110,   6, 213 } },
+	},
+	{ // 15
+		{ {   0,  29,  58,  39, 116, 105,  78,  83, 232, 245, 210, 207, 156, 129, 166, 187 }, {   0, 205, 135,  74,  19, 222, 148,  89,  38, 235, 161, 108,  53, 248, 178, 127 } },
+		{ {   0, 196, 149,  81,  55, 243, 162, 102, 110, 170, 251,  63,  89, 157, 204,   8 }, {   0, 220, 165, 121,  87, 139, 242,  46, 174, 114,  11, 215, 249,  37,  92, 128 } },
+		{ {   0, 111, 222, 177, 161, 206, 127,  16,  95,  48, 129, 238, 254, 145,  32,  79 }, {   0, 190,  97, 223, 194, 124, 163,  29, 153,  39, 248,  70,  91, 229,  58, 132 } },
+		{ {   0, 163,  91, 248, 182,  21, 237,  78, 113, 210,  42, 137, 199, 100, 156,  63 }, {   0, 226, 217,  59, 175,  77, 118, 148,  67, 161, 154, 120, 236,  14,  53, 215 } },
+		{ {   0, 112, 224, 144, 221, 173,  61,  77, 167, 215,  71,  55, 122,  10, 154, 234 }, {   0,  83, 166, 245,  81,   2, 247, 164, 162, 241,   4,  87, 243, 160,  85,   6 } },
+		{ {   0,  74, 148, 222,  53, 127, 161, 235, 106,  32, 254, 180,  95,  21, 203, 129 }, {   0, 212, 181,  97, 119, 163, 194,  22, 238,  58,  91, 143, 153,  77,  44, 248 } },
+		{ {   0,  10,  20,  30,  40,  34,  60,  54,  80,  90,  68,  78, 120, 114, 108, 102 }, {   0, 160,  93, 253, 186,  26, 231,  71, 105, 201,  52, 148, 211, 115, 142,  46 } },
+		{ {   0, 105, 210, 187, 185, 208, 107,   2, 111,   6, 189, 212, 214, 191,   4, 109 }, {   0, 222, 161, 127,  95, 129, 254,  32, 190,  96,  31, 193, 225,  63,  64, 158 } },
+		{ {   0, 105, 210, 187, 185, 208, 107,   2, 111,   6, 189, 212, 214, 191,   4, 109 }, {   0, 222, 161, 127,  95, 129, 254,  32, 190,  96,  31, 193, 225,  63,  64, 158 } },
+		{ {   0, 139,  11, 128,  22, 157,  29, 150,  44, 167,  39, 172,  58, 177,  49, 186 }, {   0,  88, 176, 232, 125,  37, 205, 149, 250, 162,  74,  18, 135, 223,  55, 111 } },
+		{ {   0, 132,  21, 145,  42, 174,  63, 187,  84, 208,  65, 197, 126, 250, 107, 239 }, {   0, 168,  77, 229, 154,  50, 215, 127,  41, 129, 100, 204, 179,  27, 254,  86 } },
+		{ {   0, 151,  51, 164, 102, 241,  85, 194, 204,  91, 255, 104, 170,  61, 153,  14 }, {   0, 133,  23, 146,  46, 171,  57, 188,  92, 217,  75, 206, 114, 247, 101, 224 } },
+		{ {   0,  32,  64,  96, 128, 160, 192, 224,  29,  61,  93, 125, 157, 189, 221, 253 }, {   0,  58, 116,  78, 232, 210, 156, 166, 205, 247, 185, 131,  37,  31,  81, 107 } },
+		{ {   0, 134,  17, 151,  34, 164,  51, 181,  68, 194,  85, 211, 102, 224, 119, 241 }, {   0, 136,  13, 133,  26, 146,  23, 159,  52, 188,  57, 177,  46, 166,  35, 171 } },
+		{ {   0,  26,  52,  46, 104, 114,  92,  70, 208, 202, 228, 254, 184, 162, 140, 150 }, {   0, 189, 103, 218, 206, 115, 169,  20, 129,  60, 230,  91,  79, 242,  40, 149 } },
+	},
+	{ // 16
+		{ {   0,  59, 118,  77, 236, 215, 154, 161, 197, 254, 179, 136,  41,  18,  95, 100 }, {   0, 151,  51, 164, 102, 241,  85, 194, 204,  91, 255, 104, 170,  61, 153,  14 } },
+		{ {   0,  13,  26,  23,  52,  57,  46,  35, 104, 101, 114, 127,  92,  81,  70,  75 }, {   0, 208, 189, 109, 103, 183, 218,  10, 206,  30, 115, 163, 169, 121,  20, 196 } },
+		{ {   0, 104, 208, 184, 189, 213, 109,   5, 103,  15, 183, 223, 218, 178,  10,  98 }, {   0, 206, 129,  79,  31, 209, 158,  80,  62, 240, 191, 113,  33, 239, 160, 110 } },
+		{ {   0, 189, 103, 218, 206, 115, 169,  20, 129,  60, 230,  91,  79, 242,  40, 149 }, {   0,  31,  62,  33, 124,  99,  66,  93, 248, 231, 198, 217, 132, 155, 186, 165 } },
+		{ {   0,  68, 136, 204,  13,  73, 133, 193,  26,  94, 146, 214,  23,  83, 159, 219 }, {   0,  52, 104,  92, 208, 228, 184, 140, 189, 137, 213, 225, 109,  89,   5,  49 } },
+		{ {   0, 209, 191, 110,  99, 178, 220,  13, 198,  23, 121, 168, 165, 116,  26, 203 }, {   0, 145,  63, 174, 126, 239,  65, 208, 252, 109, 195,  82, 130,  19, 189,  44 } },
+		{ {   0,  30,  60,  34, 120, 102,  68,  90, 240, 238, 204, 210, 136, 150, 180, 170 }, {   0, 253, 231,  26, 211,  46,  52, 201, 187,  70,  92, 161, 104, 149, 143, 114 } },
+		{ {   0,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120 }, {   0, 128,  29, 157,  58, 186,  39, 167, 116, 244, 105, 233,  78, 206,  83, 211 } },
+		{ {   0, 163,  91, 248, 182,  21, 237,  78, 113, 210,  42, 137, 199, 100, 156,  63 }, {   0, 226, 217,  59, 175,  77, 118, 148,  67, 161, 154, 120, 236,  14,  53, 215 } },
+		{ {   0,  65, 130, 195,  25,  88, 155, 218,  50, 115, 176, 241,  43, 106, 169, 232 }, {   0, 100, 200, 172, 141, 233,  69,  33,   7,  99, 207, 171, 138, 238,  66,  38 } },
+		{ {   0,  41,  82, 123, 164, 141, 246, 223,  85, 124,   7,  46, 241, 216, 163, 138 }, {   0, 170,  73, 227, 146,  56, 219, 113,  57, 147, 112, 218, 171,   1, 226,  72 } },
+		{ {   0, 229, 215,  50, 179,  86, 100, 129, 123, 158, 172,  73, 200,  45,  31, 250 }, {   0, 246, 241,   7, 255,   9,  14, 248, 227,  21,  18, 228,  28, 234, 237,  27 } },
+		{ {   0,  98, 196, 166, 149, 247,  81,  51,  55,  85, 243, 145, 162, 192, 102,   4 }, {   0, 110, 220, 178, 165, 203, 121,  23,  87,  57, 139, 229, 242, 156,  46,  64 } },
+		{ {   0,  50, 100,  86, 200, 250, 172, 158, 141, 191, 233, 219,  69, 119,  33,  19 }, {   0,   7,  14,   9,  28,  27,  18,  21,  56,  63,  54,  49,  36,  35,  42,  45 } },
+		{ {   0,  36,  72, 108, 144, 180, 216, 252,  61,  25, 117,  81, 173, 137, 229, 193 }, {   0, 122, 244, 142, 245, 143,   1, 123, 247, 141,   3, 121,   2, 120, 246, 140 } },
+		{ {   0,  59, 118,  77, 236, 215, 154, 161, 197, 254, 179, 136,  41,  18,  95, 100 }, {   0, 151,  51, 164, 102, 241,  85, 194, 204,  91, 255, 104, 170,  61, 153,  14 } },
+	},
+	{ // 17
+		{ {   0, 119, 238, 153, 193, 182,  47,  88, 159, 232, 113,   6,  94,  41, 176, 199 }, {   0,  35,  70, 101, 140, 175, 202, 233,   5,  38,  67,  96, 137, 170, 207, 236 } },
+		{ {   0,  66, 132, 198,  21,  87, 145, 211,  42, 104, 174, 236,  63, 125, 187, 249 }, {   0,  84, 168, 252,  77,  25, 229, 177, 154, 206,  50, 102, 215, 131, 127,  43 } },
+		{ {   0,  83, 166, 245,  81,   2, 247, 164, 162, 241,   4,  87, 243, 160,  85,   6 }, {   0,  89, 178, 235, 121,  32, 203, 146, 242, 171,  64,  25, 139, 210,  57,  96 } },
+		{ {   0, 120, 240, 136, 253, 133,  13, 117, 231, 159,  23, 111,  26,  98, 234, 146 }, {   0, 211, 187, 104, 107, 184, 208,   3, 214,   5, 109, 190, 189, 110,   6, 213 } },
+		{ {   0, 119, 238, 153, 193, 182,  47,  88, 159, 232, 113,   6,  94,  41, 176, 199 }, {   0,  35,  70, 101, 140, 175, 202, 233,   5,  38,  67,  96, 137, 170, 207, 236 } },
+		{ {   0,  22,  44,  58,  88,  78, 116,  98, 176, 166, 156, 138, 232, 254, 196, 210 }, {   0, 125, 250, 135, 233, 148,  19, 110, 207, 178,  53,  72,  38,  91, 220, 161 } },
+		{ {   0, 197, 151,  82,  51, 246, 164,  97, 102, 163, 241,  52,  85, 144, 194,   7 }, {   0, 204, 133,  73,  23, 219, 146,  94,  46, 226, 171, 103,  57, 245, 188, 112 } },
+		{ {   0,  83, 166, 245,  81,   2, 247, 164, 162, 241,   4,  87, 243, 160,  85,   6 }, {   0,  89, 178, 235, 121,  32, 203, 146, 242, 171,  64,  25, 139, 210,  57,  96 } },
+		{ {   0, 249, 239,  22, 195,  58,  44, 213, 155,  98, 116, 141,  88, 161, 183,  78 }, {   0,  43,  86, 125, 172, 135, 250, 209,  69, 110,  19,  56, 233, 194, 191, 148 } },
+		{ {   0,  41,  82, 123, 164, 141, 246, 223,  85, 124,   7,  46, 241, 216, 163, 138 }, {   0, 170,  73, 227, 146,  56, 219, 113,  57, 147, 112, 218, 171,   1, 226,  72 } },
+		{ {   0, 143,   3, 140,   6, 137,   5, 138,  12, 131,  15, 128,  10, 133,   9, 134 }, {   0,  24,  48,  40,  96, 120,  80,  72, 192, 216, 240, 232, 160, 184, 144, 136 } },
+		{ {   0, 134,  17, 151,  34, 164,  51, 181,  68, 194,  85, 211, 102, 224, 119, 241 }, {   0, 136,  13, 133,  26, 146,  23, 159,  52, 188,  57, 177,  46, 166,  35, 171 } },
+		{ {   0,  85, 170, 255,  73,  28, 227, 182, 146, 199,  56, 109, 219, 142, 113,  36 }, {   0,  57, 114,  75, 228, 221, 150, 175, 213, 236, 167, 158,  49,   8,  67, 122 } },
+		{ {   0,  53, 106,  95, 212, 225, 190, 139, 181, 128, 223, 234,  97,  84,  11,  62 }, {   0, 119, 238, 153, 193, 182,  47,  88, 159, 232, 113,   6,  94,  41, 176, 199 } },
+		{ {   0, 125, 250, 135, 233, 148,  19, 110, 207, 178,  53,  72,  38,  91, 220, 161 }, {   0, 131,  27, 152,  54, 181,  45, 174, 108, 239, 119, 244,  90, 217,  65, 194 } },
+		{ {   0,  99, 198, 165, 145, 242,  87,  52,  63,  92, 249, 154, 174, 205, 104,  11 }, {   0, 126, 252, 130, 229, 155,  25, 103, 215, 169,  43,  85,  50,  76, 206, 176 } },
+		{ {   0,  79, 158, 209,  33, 110, 191, 240,  66,  13, 220, 147,  99,  44, 253, 178 }, {   0, 132,  21, 145,  42, 174,  63, 187,  84, 208,  65, 197, 126, 250, 107, 239 } },
+	},
+	{ // 18
+		{ {   0, 239, 195,  44, 155, 116,  88, 183,  43, 196, 232,   7, 176,  95, 115, 156 }, {   0,  86, 172, 250,  69,  19, 233, 191, 138, 220,  38, 112, 207, 153,  99,  53 } },
+		{ {   0, 251, 235,  16, 203,  48,  32, 219, 139, 112,  96, 155,  64, 187, 171,  80 }, {   0,  11,  22,  29,  44,  39,  58,  49,  88,  83,  78,  69, 116, 127,  98, 105 } },
+		{ {   0, 183, 115, 196, 230,  81, 149,  34, 209, 102, 162,  21,  55, 128,  68, 243 }, {   0, 191,  99, 220, 198, 121, 165,  26, 145,  46, 242,  77,  87, 232,  52, 139 } },
+		{ {   0, 113, 226, 147, 217, 168,  59,  74, 175, 222,  77,  60, 118,   7, 148, 229 }, {   0,  67, 134, 197,  17,  82, 151, 212,  34,  97, 164, 231,  51, 112, 181, 246 } },
+		{ {   0, 149,  55, 162, 110, 251,  89, 204, 220,  73, 235, 126, 178,  39, 133,  16 }, {   0, 165,  87, 242, 174,  11, 249,  92,  65, 228,  22, 179, 239,  74, 184,  29 } },
+		{ {   0, 175,  67, 236, 134,  41, 197, 106,  17, 190,  82, 253, 151,  56, 212, 123 }, {   0,  34,  68, 102, 136, 170, 204, 238,  13,  47,  73, 107, 133, 167, 193, 227 } },
+		{ {   0, 199, 147,  84,  59, 252, 168, 111, 118, 177, 229,  34,  77, 138, 222,  25 }, {   0, 236, 197,  41, 151, 123,  82, 190,  51, 223, 246,  26, 164,  72,  97, 141 } },
+		{ {   0, 215, 179, 100, 123, 172, 200,  31, 246,  33,  69, 146, 141,  90,  62, 233 }, {   0, 241, 255,  14, 227,  18,  28, 237, 219,  42,  36, 213,  56, 201, 199,  54 } },
+		{ {   0, 240, 253,  13, 231,  23,  26, 234, 211,  35,  46, 222,  52, 196, 201,  57 }, {   0, 187, 107, 208, 214, 109, 189,   6, 177,  10, 218,  97, 103, 220,  12, 183 } },
+		{ {   0, 220, 165, 121,  87, 139, 242,  46, 174, 114,  11, 215, 249,  37,  92, 128 }, {   0,  65, 130, 195,  25,  88, 155, 218,  50, 115, 176, 241,  43, 106, 169, 232 } },
+		{ {   0,  73, 146, 219,  57, 112, 171, 226, 114,  59, 224, 169,  75,   2, 217, 144 }, {   0, 228, 213,  49, 183,  83,  98, 134, 115, 151, 166,  66, 196,  32,  17, 245 } },
+		{ {   0,  82, 164, 246,  85,   7, 241, 163, 170, 248,  14,  92, 255, 173,  91,   9 }, {   0,  73, 146, 219,  57, 112, 171, 226, 114,  59, 224, 169,  75,   2, 217, 144 } },
+		{ {   0, 173,  71, 234, 142,  35, 201, 100,   1, 172,  70, 235, 143,  34, 200, 101 }, {   0,   2,   4,   6,   8,  10,  12,  14,  16,  18,  20,  22,  24,  26,  28,  30 } },
+		{ {   0,  75, 150, 221,  49, 122, 167, 236,  98,  41, 244, 191,  83,  24, 197, 142 }, {   0, 196, 149,  81,  55, 243, 162, 102, 110, 170, 251,  63,  89, 157, 204,   8 } },
+		{ {   0,  32,  64,  96, 128, 160, 192, 224,  29,  61,  93, 125, 157, 189, 221, 253 }, {   0,  58, 116,  78, 232, 210, 156, 166, 205, 247, 185, 131,  37,  31,  81, 107 } },
+		{ {   0,  67, 134, 197,  17,  82, 151, 212,  34,  97, 164, 231,  51, 112, 181, 246 }, {   0,  68, 136, 204,  13,  73, 133, 193,  26,  94, 146, 214,  23,  83, 159, 219 } },
+		{ {   0, 217, 175, 118,  67, 154, 236,  53, 134,  95,  41, 240, 197,  28, 106, 179 }, {   0,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255 } },
+		{ {   0, 146,  57, 171, 114, 224,  75, 217, 228, 118, 221,  79, 150,   4, 175,  61 }, {   0, 213, 183,  98, 115, 166, 196,  17, 230,  51,  81, 132, 149,  64,  34, 247 } },
+	},
+	{ // 20
+		{ {   0, 152,  45, 181,  90, 194, 119, 239, 180,  44, 153,   1, 238, 118, 195,  91 }, {   0, 117, 234, 159, 201, 188,  35,  86, 143, 250, 101,  16,  70,  51, 172, 217 } },
+		{ {   0, 185, 111, 214, 222, 103, 177,   8, 161,  24, 206, 119, 127, 198,  16, 169 }, {   0,  95, 190, 225,  97,  62, 223, 128, 194, 157, 124,  35, 163, 252,  29,  66 } },
+		{ {   0, 240, 253,  13, 231,  23,  26, 234, 211,  35,  46, 222,  52, 196, 201,  57 }, {   0, 187, 107, 208, 214, 109, 189,   6, 177,  10, 218,  97, 103, 220,  12, 183 } },
+		{ {   0,   5,  10,  15,  20,  17,  30,  27,  40,  45,  34,  39,  60,  57,  54,  51 }, {   0,  80, 160, 240,  93,  13, 253, 173, 186, 234,  26,  74, 231, 183,  71,  23 } },
+		{ {   0, 111, 222, 177, 161, 206, 127,  16,  95,  48, 129, 238, 254, 145,  32,  79 }, {   0, 190,  97, 223, 194, 124, 163,  29, 153,  39, 248,  70,  91, 229,  58, 132 } },
+		{ {   0,  99, 198, 165, 145, 242,  87,  52,  63,  92, 249, 154, 174, 205, 104,  11 }, {   0, 126, 252, 130, 229, 155,  25, 103, 215, 169,  43,  85,  50,  76, 206, 176 } },
+		{ {   0,   6,  12,  10,  24,  30,  20,  18,  48,  54,  60,  58,  40,  46,  36,  34 }, {   0,  96, 192, 160, 157, 253,  93,  61,  39,  71, 231, 135, 186, 218, 122,  26 } },
+		{ {   0, 220, 165, 121,  87, 139, 242,  46, 174, 114,  11, 215, 249,  37,  92, 128 }, {   0,  65, 130, 195,  25,  88, 155, 218,  50, 115, 176, 241,  43, 106, 169, 232 } },
+		{ {   0, 112, 224, 144, 221, 173,  61,  77, 167, 215,  71,  55, 122,  10, 154, 234 }, {   0,  83, 166, 245,  81,   2, 247, 164, 162, 241,   4,  87, 243, 160,  85,   6 } },
+		{ {   0, 150,  49, 167,  98, 244,  83, 197, 196,  82, 245,  99, 166,  48, 151,   1 }, {   0, 149,  55, 162, 110, 251,  89, 204, 220,  73, 235, 126, 178,  39, 133,  16 } },
+		{ {   0,  69, 138, 207,   9,  76, 131, 198,  18,  87, 152, 221,  27,  94, 145, 212 }, {   0,  36,  72, 108, 144, 180, 216, 252,  61,  25, 117,  81, 173, 137, 229, 193 } },
+		{ {   0,  36,  72, 108, 144, 180, 216, 252,  61,  25, 117,  81, 173, 137, 229, 193 }, {   0, 122, 244, 142, 245, 143,   1, 123, 247, 141,   3, 121,   2, 120, 246, 140 } },
+		{ {   0, 187, 107, 208, 214, 109, 189,   6, 177,  10, 218,  97, 103, 220,  12, 183 }, {   0, 127, 254, 129, 225, 158,  31,  96, 223, 160,  33,  94,  62,  65, 192, 191 } },
+		{ {   0,  22,  44,  58,  88,  78, 116,  98, 176, 166, 156, 138, 232, 254, 196, 210 }, {   0, 125, 250, 135, 233, 148,  19, 110, 207, 178,  53,  72,  38,  91, 220, 161 } },
+		{ {   0, 228, 213,  49, 183,  83,  98, 134, 115, 151, 166,  66, 196,  32,  17, 245 }, {   0, 230, 209,  55, 191,  89, 110, 136,  99, 133, 178,  84, 220,  58,  13, 235 } },
+		{ {   0, 198, 145,  87,  63, 249, 174, 104, 126, 184, 239,  41,  65, 135, 208,  22 }, {   0, 252, 229,  25, 215,  43,  50, 206, 179,  79,  86, 170, 100, 152, 129, 125 } },
+		{ {   0, 121, 242, 139, 249, 128,  11, 114, 239, 150,  29, 100,  22, 111, 228, 157 }, {   0, 195, 155,  88,  43, 232, 176, 115,  86, 149, 205,  14, 125, 190, 230,  37 } },
+		{ {   0, 121, 242, 139, 249, 128,  11, 114, 239, 150,  29, 100,  22, 111, 228, 157 }, {   0, 195, 155,  88,  43, 232, 176, 115,  86, 149, 205,  14, 125, 190, 230,  37 } },
+		{ {   0, 165,  87, 242, 174,  11, 249,  92,  65, 228,  22, 179, 239,  74, 184,  29 }, {   0, 130,  25, 155,  50, 176,  43, 169, 100, 230, 125, 255,  86, 212,  79, 205 } },
+		{ {   0, 174,  65, 239, 130,  44, 195, 109,  25, 183,  88, 246, 155,  53, 218, 116 }, {   0,  50, 100,  86, 200, 250, 172, 158, 141, 191, 233, 219,  69, 119,  33,  19 } },
+	},
+	{ // 22
+		{ {   0,  89, 178, 235, 121,  32, 203, 146, 242, 171,  64,  25, 139, 210,  57,  96 }, {   0, 249, 239,  22, 195,  58,  44, 213, 155,  98, 116, 141,  88, 161, 183,  78 } },
+		{ {   0, 179, 123, 200, 246,  69, 141,  62, 241,  66, 138,  57,   7, 180, 124, 207 }, {   0, 255, 227,  28, 219,  36,  56, 199, 171,  84,  72, 183, 112, 143, 147, 108 } },
+		{ {   0, 131,  27, 152,  54, 181,  45, 174, 108, 239, 119, 244,  90, 217,  65, 194 }, {   0, 216, 173, 117,  71, 159, 234,  50, 142,  86,  35, 251, 201,  17, 100, 188 } },
+		{ {   0, 176, 125, 205, 250,  74, 135,  55, 233,  89, 148,  36,  19, 163, 110, 222 }, {   0, 207, 131,  76,  27, 212, 152,  87,  54, 249, 181, 122,  45, 226, 174,  97 } },
+		{ {   0, 182, 113, 199, 226,  84, 147,  37, 217, 111, 168,  30,  59, 141,  74, 252 }, {   0, 175,  67, 236, 134,  41, 197, 106,  17, 190,  82, 253, 151,  56, 212, 123 } },
+		{ {   0, 244, 245,   1, 247,   3,   2, 246, 243,   7,   6, 242,   4, 240, 241,   5 }, {   0, 251, 235,  16, 203,  48,  32, 219, 139, 112,  96, 155,  64, 187, 171,  80 } },
+		{ {   0,  19,  38,  53,  76,  95, 106, 121, 152, 139, 190, 173, 212, 199, 242, 225 }, {   0,  45,  90, 119, 180, 153, 238, 195, 117,  88,  47,   2, 193, 236, 155, 182 } },
+		{ {   0, 189, 103, 218, 206, 115, 169,  20, 129,  60, 230,  91,  79, 242,  40, 149 }, {   0,  31,  62,  33, 124,  99,  66,  93, 248, 231, 198, 217, 132, 155, 186, 165 } },
+		{ {   0,  69, 138, 207,   9,  76, 131, 198,  18,  87, 152, 221,  27,  94, 145, 212 }, {   0,  36,  72, 108, 144, 180, 216, 252,  61,  25, 117,  81, 173, 137, 229, 193 } },
+		{ {   0,  40,  80, 120, 160, 136, 240, 216,  93, 117,  13,  37, 253, 213, 173, 133 }, {   0, 186, 105, 211, 210, 104, 187,   1, 185,   3, 208, 106, 107, 209,   2, 184 } },
+		{ {   0,  28,  56,  36, 112, 108,  72,  84, 224, 252, 216, 196, 144, 140, 168, 180 }, {   0, 221, 167, 122,  83, 142, 244,  41, 166, 123,   1, 220, 245,  40,  82, 143 } },
+		{ {   0, 137,  15, 134,  30, 151,  17, 152,  60, 181,  51, 186,  34, 171,  45, 164 }, {   0, 120, 240, 136, 253, 133,  13, 117, 231, 159,  23, 111,  26,  98, 234, 146 } },
+		{ {   0,  29,  58,  39, 116, 105,  78,  83, 232, 245, 210, 207, 156, 129, 166, 187 }, {   0, 205, 135,  74,  19, 222, 148,  89,  38, 235, 161, 108,  53, 248, 178, 127 } },
+		{ {   0, 123, 246, 141, 241, 138,   7, 124, 255, 132,   9, 114,  14, 117, 248, 131 }, {   0, 227, 219,  56, 171,  72, 112, 147,  75, 168, 144, 115, 224,   3,  59, 216 } },
+		{ {   0,  67, 134, 197,  17,  82, 151, 212,  34,  97, 164, 231,  51, 112, 181, 246 }, {   0,  68, 136, 204,  13,  73, 133, 193,  26,  94, 146, 214,  23,  83, 159, 219 } },
+		{ {   0, 253, 231,  26, 211,  46,  52, 201, 187,  70,  92, 161, 104, 149, 143, 114 }, {   0, 107, 214, 189, 177, 218, 103,  12, 127,  20, 169, 194, 206, 165,  24, 115 } },
+		{ {   0,  86, 172, 250,  69,  19, 233, 191, 138, 220,  38, 112, 207, 153,  99,  53 }, {   0,   9,  18,  27,  36,  45,  54,  63,  72,  65,  90,  83, 108, 101, 126, 119 } },
+		{ {   0, 218, 169, 115,  79, 149, 230,  60, 158,  68,  55, 237, 209,  11, 120, 162 }, {   0,  33,  66,  99, 132, 165, 198, 231,  21,  52,  87, 118, 145, 176, 211, 242 } },
+		{ {   0, 230, 209,  55, 191,  89, 110, 136,  99, 133, 178,  84, 220,  58,  13, 235 }, {   0, 198, 145,  87,  63, 249, 174, 104, 126, 184, 239,  41,  65, 135, 208,  22 } },
+		{ {   0,  26,  52,  46, 104, 114,  92,  70, 208, 202, 228, 254, 184, 162, 140, 150 }, {   0, 189, 103, 218, 206, 115, 169,  20, 129,  60, 230,  91,  79, 242,  40, 149 } },
+		{ {   0, 145,  63, 174, 126, 239,  65, 208, 252, 109, 195,  82, 130,  19, 189,  44 }, {   0, 229, 215,  50, 179,  86, 100, 129, 123, 158, 172,  73, 200,  45,  31, 250 } },
+		{ {   0, 245, 247,   2, 243,   6,   4, 241, 251,  14,  12, 249,   8, 253, 255,  10 }, {   0, 235, 203,  32, 139,  96,  64, 171,  11, 224, 192,  43, 128, 107,  75, 160 } },
+	},
+	{ // 24
+		{ {   0, 122, 244, 142, 245, 143,   1, 123, 247, 141,   3, 121,   2, 120, 246, 140 }, {   0, 243, 251,   8, 235,  24,  16, 227, 203,  56,  48, 195,  32, 211, 219,  40 } },
+		{ {   0, 118, 236, 154, 197, 179,  41,  95, 151, 225, 123,  13,  82,  36, 190, 200 }, {   0,  51, 102,  85, 204, 255, 170, 153, 133, 182, 227, 208,  73, 122,  47,  28 } },
+		{ {   0, 169,  79, 230, 158,  55, 209, 120,  33, 136, 110, 199, 191,  22, 240,  89 }, {   0,  66, 132, 198,  21,  87, 145, 211,  42, 104, 174, 236,  63, 125, 187, 249 } },
+		{ {   0,  70, 140, 202,   5,  67, 137, 207,  10,  76, 134, 192,  15,  73, 131, 197 }, {   0,  20,  40,  60,  80,  68, 120, 108, 160, 180, 136, 156, 240, 228, 216, 204 } },
+		{ {   0, 178, 121, 203, 242,  64, 139,  57, 249,  75, 128,  50,  11, 185, 114, 192 }, {   0, 239, 195,  44, 155, 116,  88, 183,  43, 196, 232,   7, 176,  95, 115, 156 } },
+		{ {   0, 237, 199,  42, 147, 126,  84, 185,  59, 214, 252,  17, 168,  69, 111, 130 }, {   0, 118, 236, 154, 197, 179,  41,  95, 151, 225, 123,  13,  82,  36, 190, 200 } },
+		{ {   0, 216, 173, 117,  71, 159, 234,  50, 142,  86,  35, 251, 201,  17, 100, 188 }, {   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15 } },
+		{ {   0, 102, 204, 170, 133, 227,  73,  47,  23, 113, 219, 189, 146, 244,  94,  56 }, {   0,  46,  92, 114, 184, 150, 228, 202, 109,  67,  49,  31, 213, 251, 137, 167 } },
+		{ {   0, 115, 230, 149, 209, 162,  55,  68, 191, 204,  89,  42, 110,  29, 136, 251 }, {   0,  99, 198, 165, 145, 242,  87,  52,  63,  92, 249, 154, 174, 205, 104,  11 } },
+		{ {   0, 150,  49, 167,  98, 244,  83, 197, 196,  82, 245,  99, 166,  48, 151,   1 }, {   0, 149,  55, 162, 110, 251,  89, 204, 220,  73, 235, 126, 178,  39, 133,  16 } },
+		{ {   0, 229, 215,  50, 179,  86, 100, 129, 123, 158, 172,  73, 200,  45,  31, 250 }, {   0, 246, 241,   7, 255,   9,  14, 248, 227,  21,  18, 228,  28, 234, 237,  27 } },
+		{ {   0,  73, 146, 219,  57, 112, 171, 226, 114,  59, 224, 169,  75,   2, 217, 144 }, {   0, 228, 213,  49, 183,  83,  98, 134, 115, 151, 166,  66, 196,  32,  17, 245 } },
+		{ {   0, 130,  25, 155,  50, 176,  43, 169, 100, 230, 125, 255,  86, 212,  79, 205 }, {   0, 200, 141,  69,   7, 207, 138,  66,  14, 198, 131,  75,   9, 193, 132,  76 } },
+		{ {   0,  72, 144, 216,  61, 117, 173, 229, 122,  50, 234, 162,  71,  15, 215, 159 }, {   0, 244, 245,   1, 247,   3,   2, 246, 243,   7,   6, 242,   4, 240, 241,   5 } },
+		{ {   0,  61, 122,  71, 244, 201, 142, 179, 245, 200, 143, 178,   1,  60, 123,  70 }, {   0, 247, 243,   4, 251,  12,   8, 255, 235,  28,  24, 239,  16, 231, 227,  20 } },
+		{ {   0,  43,  86, 125, 172, 135, 250, 209,  69, 110,  19,  56, 233, 194, 191, 148 }, {   0, 138,   9, 131,  18, 152,  27, 145,  36, 174,  45, 167,  54, 188,  63, 181 } },
+		{ {   0, 206, 129,  79,  31, 209, 158,  80,  62, 240, 191, 113,  33, 239, 160, 110 }, {   0, 124, 248, 132, 237, 145,  21, 105, 199, 187,  63,  67,  42,  86, 210, 174 } },
+		{ {   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15 }, {   0,  16,  32,  48,  64,  80,  96, 112, 128, 144, 160, 176, 192, 208, 224, 240 } },
+		{ {   0, 237, 199,  42, 147, 126,  84, 185,  59, 214, 252,  17, 168,  69, 111, 130 }, {   0, 118, 236, 154, 197, 179,  41,  95, 151, 225, 123,  13,  82,  36, 190, 200 } },
+		{ {   0, 247, 243,   4, 251,  12,   8, 255, 235,  28,  24, 239,  16, 231, 227,  20 }, {   0, 203, 139,  64,  11, 192, 128,  75,  22, 221, 157,  86,  29, 214, 150,  93 } },
+		{ {   0, 127, 254, 129, 225, 158,  31,  96, 223, 160,  33,  94,  62,  65, 192, 191 }, {   0, 163,  91, 248, 182,  21, 237,  78, 113, 210,  42, 137, 199, 100, 156,  63 } },
+		{ {   0, 217, 175, 118,  67, 154, 236,  53, 134,  95,  41, 240, 197,  28, 106, 179 }, {   0,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255 } },
+		{ {   0, 144,  61, 173, 122, 234,  71, 215, 244, 100, 201,  89, 142,  30, 179,  35 }, {   0, 245, 247,   2, 243,   6,   4, 241, 251,  14,  12, 249,   8, 253, 255,  10 } },
+		{ {   0, 117, 234, 159, 201, 188,  35,  86, 143, 250, 101,  16,  70,  51, 172, 217 }, {   0,   3,   6,   5,  12,  15,  10,   9,  24,  27,  30,  29,  20,  23,  18,  17 } },
+	},
+	{ // 26
+		{ {   0, 246, 241,   7, 255,   9,  14, 248, 227,  21,  18, 228,  28, 234, 237,  27 }, {   0, 219, 171, 112,  75, 144, 224,  59, 150,  77,  61, 230, 221,   6, 118, 173 } },
+		{ {   0,  51, 102,  85, 204, 255, 170, 153, 133, 182, 227, 208,  73, 122,  47,  28 }, {   0,  23,  46,  57,  92,  75, 114, 101, 184, 175, 150, 129, 228, 243, 202, 221 } },
+		{ {   0, 183, 115, 196, 230,  81, 149,  34, 209, 102, 162,  21,  55, 128,  68, 243 }, {   0, 191,  99, 220, 198, 121, 165,  26, 145,  46, 242,  77,  87, 232,  52, 139 } },
+		{ {   0,   4,   8,  12,  16,  20,  24,  28,  32,  36,  40,  44,  48,  52,  56,  60 }, {   0,  64, 128, 192,  29,  93, 157, 221,  58, 122, 186, 250,  39, 103, 167, 231 } },
+		{ {   0, 136,  13, 133,  26, 146,  23, 159,  52, 188,  57, 177,  46, 166,  35, 171 }, {   0, 104, 208, 184, 189, 213, 109,   5, 103,  15, 183, 223, 218, 178,  10,  98 } },
+		{ {   0,  98, 196, 166, 149, 247,  81,  51,  55,  85, 243, 145, 162, 192, 102,   4 }, {   0, 110, 220, 178, 165, 203, 121,  23,  87,  57, 139, 229, 242, 156,  46,  64 } },
+		{ {   0, 199, 147,  84,  59, 252, 168, 111, 118, 177, 229,  34,  77, 138, 222,  25 }, {   0, 236, 197,  41, 151, 123,  82, 190,  51, 223, 246,  26, 164,  72,  97, 141 } },
+		{ {   0, 152,  45, 181,  90, 194, 119, 239, 180,  44, 153,   1, 238, 118, 195,  91 }, {   0, 117, 234, 159, 201, 188,  35,  86, 143, 250, 101,  16,  70,  51, 172, 217 } },
+		{ {   0,  77, 154, 215,  41, 100, 179, 254,  82,  31, 200, 133, 123,  54, 225, 172 }, {   0, 164,  85, 241, 170,  14, 255,  91,  73, 237,  28, 184, 227,  71, 182,  18 } },
+		{ {   0,  56, 112,  72, 224, 216, 144, 168, 221, 229, 173, 149,  61,   5,  77, 117 }, {   0, 167,  83, 244, 166,   1, 245,  82,  81, 246,   2, 165, 247,  80, 164,   3 } },
+		{ {   0, 206, 129,  79,  31, 209, 158,  80,  62, 240, 191, 113,  33, 239, 160, 110 }, {   0, 124, 248, 132, 237, 145,  21, 105, 199, 187,  63,  67,  42,  86, 210, 174 } },
+		{ {   0,  24,  48,  40,  96, 120,  80,  72, 192, 216, 240, 232, 160, 184, 144, 136 }, {   0, 157,  39, 186,  78, 211, 105, 244, 156,   1, 187,  38, 210,  79, 245, 104 } },
+		{ {   0, 145,  63, 174, 126, 239,  65, 208, 252, 109, 195,  82, 130,  19, 189,  44 }, {   0, 229, 215,  50, 179,  86, 100, 129, 123, 158, 172,  73, 200,  45,  31, 250 } },
+		{ {   0,  40,  80, 120, 160, 136, 240, 216,  93, 117,  13,  37, 253, 213, 173, 133 }, {   0, 186, 105, 211, 210, 104, 187,   1, 185,   3, 208, 106, 107, 209,   2, 184 } },
+		{ {   0, 209, 191, 110,  99, 178, 220,  13, 198,  23, 121, 168, 165, 116,  26, 203 }, {   0, 145,  63, 174, 126, 239,  65, 208, 252, 109, 195,  82, 130,  19, 189,  44 } },
+		{ {   0, 117, 234, 159, 201, 188,  35,  86, 143, 250, 101,  16,  70,  51, 172, 217 }, {   0,   3,   6,   5,  12,  15,  10,   9,  24,  27,  30,  29,  20,  23,  18,  17 } },
+		{ {   0, 233, 207,  38, 131, 106,  76, 165,  27, 242, 212,  61, 152, 113,  87, 190 }, {   0,  54, 108,  90, 216, 238, 180, 130, 173, 155, 193, 247, 117,  67,  25,  47 } },
+		{ {   0,  42,  84, 126, 168, 130, 252, 214,  77, 103,  25,  51, 229, 207, 177, 155 }, {   0, 154,  41, 179,  82, 200, 123, 225, 164,  62, 141,  23, 246, 108, 223,  69 } },
+		{ {   0, 135,  19, 148,  38, 161,  53, 178,  76, 203,  95, 216, 106, 237, 121, 254 }, {   0, 152,  45, 181,  90, 194, 119, 239, 180,  44, 153,   1, 238, 118, 195,  91 } },
+		{ {   0,  68, 136, 204,  13,  73, 133, 193,  26,  94, 146, 214,  23,  83, 159, 219 }, {   0,  52, 104,  92, 208, 228, 184, 140, 189, 137, 213, 225, 109,  89,   5,  49 } },
+		{ {   0,  70, 140, 202,   5,  67, 137, 207,  10,  76, 134, 192,  15,  73, 131, 197 }, {   0,  20,  40,  60,  80,  68, 120, 108, 160, 180, 136, 156, 240, 228, 216, 204 } },
+		{ {   0, 144,  61, 173, 122, 234,  71, 215, 244, 100, 201,  89, 142,  30, 179,  35 }, {   0, 245, 247,   2, 243,   6,   4, 241, 251,  14,  12, 249,   8, 253, 255,  10 } },
+		{ {   0, 146,  57, 171, 114, 224,  75, 217, 228, 118, 221,  79, 150,   4, 175,  61 }, {   0, 213, 183,  98, 115, 166, 196,  17, 230,  51,  81, 132, 149,  64,  34, 247 } },
+		{ {   0,  77, 154, 215,  41, 100, 179, 254,  82,  31, 200, 133, 123,  54, 225, 172 }, {   0, 164,  85, 241, 170,  14, 255,  91,  73, 237,  28, 184, 227,  71, 182,  18 } },
+		{ {   0,  43,  86, 125, 172, 135, 250, 209,  69, 110,  19,  56, 233, 194, 191, 148 }, {   0, 138,   9, 131,  18, 152,  27, 145,  36, 174,  45, 167,  54, 188,  63, 181 } },
+		{ {   0,  94, 188, 226, 101,  59, 217, 135, 202, 148, 118,  40, 175, 241,  19,  77 }, {   0, 137,  15, 134,  30, 151,  17, 152,  60, 181,  51, 186,  34, 171,  45, 164 } },
+	},
+	{ // 28
+		{ {   0, 252, 229,  25, 215,  43,  50, 206, 179,  79,  86, 170, 100, 152, 129, 125 }, {   0, 123, 246, 141, 241, 138,   7, 124, 255, 132,   9, 114,  14, 117, 248, 131 } },
+		{ {   0,   9,  18,  27,  36,  45,  54,  63,  72,  65,  90,  83, 108, 101, 126, 119 }, {   0, 144,  61, 173, 122, 234,  71, 215, 244, 100, 201,  89, 142,  30, 179,  35 } },
+		{ {   0,  28,  56,  36, 112, 108,  72,  84, 224, 252, 216, 196, 144, 140, 168, 180 }, {   0, 221, 167, 122,  83, 142, 244,  41, 166, 123,   1, 220, 245,  40,  82, 143 } },
+		{ {   0,  13,  26,  23,  52,  57,  46,  35, 104, 101, 114, 127,  92,  81,  70,  75 }, {   0, 208, 189, 109, 103, 183, 218,  10, 206,  30, 115, 163, 169, 121,  20, 196 } },
+		{ {   0,  18,  36,  54,  72,  90, 108, 126, 144, 130, 180, 166, 216, 202, 252, 238 }, {   0,  61, 122,  71, 244, 201, 142, 179, 245, 200, 143, 178,   1,  60, 123,  70 } },
+		{ {   0, 251, 235,  16, 203,  48,  32, 219, 139, 112,  96, 155,  64, 187, 171,  80 }, {   0,  11,  22,  29,  44,  39,  58,  49,  88,  83,  78,  69, 116, 127,  98, 105 } },
+		{ {   0, 208, 189, 109, 103, 183, 218,  10, 206,  30, 115, 163, 169, 121,  20, 196 }, {   0, 129,  31, 158,  62, 191,  33, 160, 124, 253,  99, 226,  66, 195,  93, 220 } },
+		{ {   0, 150,  49, 167,  98, 244,  83, 197, 196,  82, 245,  99, 166,  48, 151,   1 }, {   0, 149,  55, 162, 110, 251,  89, 204, 220,  73, 235, 126, 178,  39, 133,  16 } },
+		{ {   0, 103, 206, 169, 129, 230,  79,  40,  31, 120, 209, 182, 158, 249,  80,  55 }, {   0,  62, 124,  66, 248, 198, 132, 186, 237, 211, 145, 175,  21,  43, 105,  87 } },
+		{ {   0, 174,  65, 239, 130,  44, 195, 109,  25, 183,  88, 246, 155,  53, 218, 116 }, {   0,  50, 100,  86, 200, 250, 172, 158, 141, 191, 233, 219,  69, 119,  33,  19 } },
+		{ {   0, 100, 200, 172, 141, 233,  69,  33,   7,  99, 207, 171, 138, 238,  66,  38 }, {   0,  14,  28,  18,  56,  54,  36,  42, 112, 126, 108,  98,  72,  70,  84,  90 } },
+		{ {   0,  41,  82, 123, 164, 141, 246, 223,  85, 124,   7,  46, 241, 216, 163, 138 }, {   0, 170,  73, 227, 146,  56, 219, 113,  57, 147, 112, 218, 171,   1, 226,  72 } },
+		{ {   0, 167,  83, 244, 166,   1, 245,  82,  81, 246,   2, 165, 247,  80, 164,   3 }, {   0, 162,  89, 251, 178,  16, 235,  73, 121, 219,  32, 130, 203, 105, 146,  48 } },
+		{ {   0,  12,  24,  20,  48,  60,  40,  36,  96, 108, 120, 116,  80,  92,  72,  68 }, {   0, 192, 157,  93,  39, 231, 186, 122,  78, 142, 211,  19, 105, 169, 244,  52 } },
+		{ {   0, 247, 243,   4, 251,  12,   8, 255, 235,  28,  24, 239,  16, 231, 227,  20 }, {   0, 203, 139,  64,  11, 192, 128,  75,  22, 221, 157,  86,  29, 214, 150,  93 } },
+		{ {   0,  56, 112,  72, 224, 216, 144, 168, 221, 229, 173, 149,  61,   5,  77, 117 }, {   0, 167,  83, 244, 166,   1, 245,  82,  81, 246,   2, 165, 247,  80, 164,   3 } },
+		{ {   0, 117, 234, 159, 201, 188,  35,  86, 143, 250, 101,  16,  70,  51, 172, 217 }, {   0,   3,   6,   5,  12,  15,  10,   9,  24,  27,  30,  29,  20,  23,  18,  17 } },
+		{ {   0, 119, 238, 153, 193, 182,  47,  88, 159, 232, 113,   6,  94,  41, 176, 199 }, {   0,  35,  70, 101, 140, 175, 202, 233,   5,  38,  67,  96, 137, 170, 207, 236 } },
+		{ {   0, 233, 207,  38, 131, 106,  76, 165,  27, 242, 212,  61, 152, 113,  87, 190 }, {   0,  54, 108,  90, 216, 238, 180, 130, 173, 155, 193, 247, 117,  67,  25,  47 } },
+		{ {   0, 127, 254, 129, 225, 158,  31,  96, 223, 160,  33,  94,  62,  65, 192, 191 }, {   0, 163,  91, 248, 182,  21, 237,  78, 113, 210,  42, 137, 199, 100, 156,  63 } },
+		{ {   0, 181, 119, 194, 238,  91, 153,  44, 193, 116, 182,   3,  47, 154,  88, 237 }, {   0, 159,  35, 188,  70, 217, 101, 250, 140,  19, 175,  48, 202,  85, 233, 118 } },
+		{ {   0, 100, 200, 172, 141, 233,  69,  33,   7,  99, 207, 171, 138, 238,  66,  38 }, {   0,  14,  28,  18,  56,  54,  36,  42, 112, 126, 108,  98,  72,  70,  84,  90 } },
+		{ {   0, 121, 242, 139, 249, 128,  11, 114, 239, 150,  29, 100,  22, 111, 228, 157 }, {   0, 195, 155,  88,  43, 232, 176, 115,  86, 149, 205,  14, 125, 190, 230,  37 } },
+		{ {   0, 147,  59, 168, 118, 229,  77, 222, 236, 127, 215,  68, 154,   9, 161,  50 }, {   0, 197, 151,  82,  51, 246, 164,  97, 102, 163, 241,  52,  85, 144, 194,   7 } },
+		{ {   0, 176, 125, 205, 250,  74, 135,  55, 233,  89, 148,  36,  19, 163, 110, 222 }, {   0, 207, 131,  76,  27, 212, 152,  87,  54, 249, 181, 122,  45, 226, 174,  97 } },
+		{ {   0,  74, 148, 222,  53, 127, 161, 235, 106,  32, 254, 180,  95,  21, 203, 129 }, {   0, 212, 181,  97, 119, 163, 194,  22, 238,  58,  91, 143, 153,  77,  44, 248 } },
+		{ {   0,  58, 116,  78, 232, 210, 156, 166, 205, 247, 185, 131,  37,  31,  81, 107 }, {   0, 135,  19, 148,  38, 161,  53, 178,  76, 203,  95, 216, 106, 237, 121, 254 } },
+		{ {   0, 197, 151,  82,  51, 246, 164,  97, 102, 163, 241,  52,  85, 144, 194,   7 }, {   0, 204, 133,  73,  23, 219, 146,  94,  46, 226, 171, 103,  57, 245, 188, 112 } },
+	},
+	{ // 30
+		{ {   0, 212, 181,  97, 119, 163, 194,  22, 238,  58,  91, 143, 153,  77,  44, 248 }, {   0, 193, 159,  94,  35, 226, 188, 125,  70, 135, 217,  24, 101, 164, 250,  59 } },
+		{ {   0, 246, 241,   7, 255,   9,  14, 248, 227,  21,  18, 228,  28, 234, 237,  27 }, {   0, 219, 171, 112,  75, 144, 224,  59, 150,  77,  61, 230, 221,   6, 118, 173 } },
+		{ {   0,  77, 154, 215,  41, 100, 179, 254,  82,  31, 200, 133, 123,  54, 225, 172 }, {   0, 164,  85, 241, 170,  14, 255,  91,  73, 237,  28, 184, 227,  71, 182,  18 } },
+		{ {   0,  73, 146, 219,  57, 112, 171, 226, 114,  59, 224, 169,  75,   2, 217, 144 }, {   0, 228, 213,  49, 183,  83,  98, 134, 115, 151, 166,  66, 196,  32,  17, 245 } },
+		{ {   0, 195, 155,  88,  43, 232, 176, 115,  86, 149, 205,  14, 125, 190, 230,  37 }, {   0, 172,  69, 233, 138,  38, 207,  99,   9, 165,  76, 224, 131,  47, 198, 106 } },
+		{ {   0, 192, 157,  93,  39, 231, 186, 122,  78, 142, 211,  19, 105, 169, 244,  52 }, {   0, 156,  37, 185,  74, 214, 111, 243, 148,   8, 177,  45, 222,  66, 251, 103 } },
+		{ {   0,  75, 150, 221,  49, 122, 167, 236,  98,  41, 244, 191,  83,  24, 197, 142 }, {   0, 196, 149,  81,  55, 243, 162, 102, 110, 170, 251,  63,  89, 157, 204,   8 } },
+		{ {   0,  98, 196, 166, 149, 247,  81,  51,  55,  85, 243, 145, 162, 192, 102,   4 }, {   0, 110, 220, 178, 165, 203, 121,  23,  87,  57, 139, 229, 242, 156,  46,  64 } },
+		{ {   0,   5,  10,  15,  20,  17,  30,  27,  40,  45,  34,  39,  60,  57,  54,  51 }, {   0,  80, 160, 240,  93,  13, 253, 173, 186, 234,  26,  74, 231, 183,  71,  23 } },
+		{ {   0,  70, 140, 202,   5,  67, 137, 207,  10,  76, 134, 192,  15,  73, 131, 197 }, {   0,  20,  40,  60,  80,  68, 120, 108, 160, 180, 136, 156, 240, 228, 216, 204 } },
+		{ {   0, 103, 206, 169, 129, 230,  79,  40,  31, 120, 209, 182, 158, 249,  80,  55 }, {   0,  62, 124,  66, 248, 198, 132, 186, 237, 211, 145, 175,  21,  43, 105,  87 } },
+		{ {   0, 177, 127, 206, 254,  79, 129,  48, 225,  80, 158,  47,  31, 174,  96, 209 }, {   0, 223, 163, 124,  91, 132, 248,  39, 182, 105,  21, 202, 237,  50,  78, 145 } },
+		{ {   0,  22,  44,  58,  88,  78, 116,  98, 176, 166, 156, 138, 232, 254, 196, 210 }, {   0, 125, 250, 135, 233, 148,  19, 110, 207, 178,  53,  72,  38,  91, 220, 161 } },
+		{ {   0, 217, 175, 118,  67, 154, 236,  53, 134,  95,  41, 240, 197,  28, 106, 179 }, {   0,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255 } },
+		{ {   0, 138,   9, 131,  18, 152,  27, 145,  36, 174,  45, 167,  54, 188,  63, 181 }, {   0,  72, 144, 216,  61, 117, 173, 229, 122,  50, 234, 162,  71,  15, 215, 159 } },
+		{ {   0,  51, 102,  85, 204, 255, 170, 153, 133, 182, 227, 208,  73, 122,  47,  28 }, {   0,  23,  46,  57,  92,  75, 114, 101, 184, 175, 150, 129, 228, 243, 202, 221 } },
+		{ {   0, 181, 119, 194, 238,  91, 153,  44, 193, 116, 182,   3,  47, 154,  88, 237 }, {   0, 159,  35, 188,  70, 217, 101, 250, 140,  19, 175,  48, 202,  85, 233, 118 } },
+		{ {   0, 246, 241,   7, 255,   9,  14, 248, 227,  21,  18, 228,  28, 234, 237,  27 }, {   0, 219, 171, 112,  75, 144, 224,  59, 150,  77,  61, 230, 221,   6, 118, 173 } },
+		{ {   0,  72, 144, 216,  61, 117, 173, 229, 122,  50, 234, 162,  71,  15, 215, 159 }, {   0, 244, 245,   1, 247,   3,   2, 246, 243,   7,   6, 242,   4, 240, 241,   5 } },
+		{ {   0,  25,  50,  43, 100, 125,  86,  79, 200, 209, 250, 227, 172, 181, 158, 135 }, {   0, 141,   7, 138,  14, 131,   9, 132,  28, 145,  27, 150,  18, 159,  21, 152 } },
+		{ {   0,  18,  36,  54,  72,  90, 108, 126, 144, 130, 180, 166, 216, 202, 252, 238 }, {   0,  61, 122,  71, 244, 201, 142, 179, 245, 200, 143, 178,   1,  60, 123,  70 } },
+		{ {   0,  46,  92, 114, 184, 150, 228, 202, 109,  67,  49,  31, 213, 251, 137, 167 }, {   0, 218, 169, 115,  79, 149, 230,  60, 158,  68,  55, 237, 209,  11, 120, 162 } },
+		{ {   0, 228, 213,  49, 183,  83,  98, 134, 115, 151, 166,  66, 196,  32,  17, 245 }, {   0, 230, 209,  55, 191,  89, 110, 136,  99, 133, 178,  84, 220,  58,  13, 235 } },
+		{ {   0,  74, 148, 222,  53, 127, 161, 235, 106,  32, 254, 180,  95,  21, 203, 129 }, {   0, 212, 181,  97, 119, 163, 194,  22, 238,  58,  91, 143, 153,  77,  44, 248 } },
+		{ {   0, 216, 173, 117,  71, 159, 234,  50, 142,  86,  35, 251, 201,  17, 100, 188 }, {   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15 } },
+		{ {   0, 195, 155,  88,  43, 232, 176, 115,  86, 149, 205,  14, 125, 190, 230,  37 }, {   0, 172,  69, 233, 138,  38, 207,  99,   9, 165,  76, 224, 131,  47, 198, 106 } },
+		{ {   0,  11,  22,  29,  44,  39,  58,  49,  88,  83,  78,  69, 116, 127,  98, 105 }, {   0, 176, 125, 205, 250,  74, 135,  55, 233,  89, 148,  36,  19, 163, 110, 222 } },
+		{ {   0, 106, 212, 190, 181, 223,  97,  11, 119,  29, 163, 201, 194, 168,  22, 124 }, {   0, 238, 193,  47, 159, 113,  94, 176,  35, 205, 226,  12, 188,  82, 125, 147 } },
+		{ {   0, 130,  25, 155,  50, 176,  43, 169, 100, 230, 125, 255,  86, 212,  79, 205 }, {   0, 200, 141,  69,   7, 207, 138,  66,  14, 198, 131,  75,   9, 193, 132,  76 } },
+		{ {   0, 150,  49, 167,  98, 244,  83, 197, 196,  82, 245,  99, 166,  48, 151,   1 }, {   0, 149,  55, 162, 110, 251,  89, 204, 220,  73, 235, 126, 178,  39, 133,  16 } },
+	},
+};
+
+#endif // QR_ECC_TABLES_H
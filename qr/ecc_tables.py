@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# generates qr/ecc_tables.h: python3 qr/ecc_tables.py > qr/ecc_tables.h
+
+# primitive polynomial of GF(256) used by qr codes
+PRIMITIVE = 0x11D
+
+# longest ec block of any version and level, and the ec block lengths that occur
+MAX_ECC_LENGTH = 30
+DEGREES = [7, 10, 13, 15, 16, 17, 18, 20, 22, 24, 26, 28, 30]
+
+PARITY_WORDS = (MAX_ECC_LENGTH + 7) // 8
+
+antilog = []
+log = [0] * 256
+x = 1
+for i in range(255):
+	antilog.append(x)
+	log[x] = i
+	x <<= 1
+	if x & 0x100:
+		x ^= PRIMITIVE
+
+def mul(a, b):
+	if a == 0 or b == 0:
+		return 0
+	return antilog[(log[a] + log[b]) % 255]
+
+# coefficients of (x - a^0) ... (x - a^(degree - 1)), constant term first and leading 1 last
+def generator(degree):
+	poly = [0] * degree + [1]
+	for i in range(degree):
+		coef = antilog[i]
+		for j in range(degree):
+			poly[j] = poly[j + 1] ^ mul(poly[j], coef)
+		poly[degree] = mul(poly[degree], coef)
+	return poly
+
+# byte j of a parity row lives in bits 8 * (j % 8) of word j / 8
+def product_row(feedback, coefficients):
+	words = [0] * PARITY_WORDS
+	for j, c in enumerate(coefficients):
+		words[j // 8] |= mul(feedback, c) << (8 * (j % 8))
+	return '{ ' + ', '.join('0x%016xULL' % w for w in words) + ' }'
+
+def nibble_entry(c):
+	low = ', '.join('%3d' % mul(f, c) for f in range(16))
+	high = ', '.join('%3d' % mul(f << 4, c) for f in range(16))
+	return '{ { %s }, { %s } }' % (low, high)
+
+index = [-1] * (MAX_ECC_LENGTH + 1)
+for i, degree in enumerate(DEGREES):
+	index[degree] = i
+
+out = []
+out.append('''#ifndef QR_ECC_TABLES_H
+#define QR_ECC_TABLES_H
+
+#include <qr/types.h>
+#include <stdint.h>
+
+// constant multiplication tables of the generator polynomials, generated by qr/ecc_tables.py; only the degrees
+// used by ec blocks are present, the tests check them against GF(256)
+
+#define GF_SIZE 256
+
+// longest ec block of any version and level
+#define MAX_ECC_LENGTH %d
+
+// parity register of an ec block, byte j lives in bits 8 * (j %% 8) of word j / 8
+#define PARITY_WORDS ((MAX_ECC_LENGTH + 7) / 8)
+typedef uint64_t parity_row[PARITY_WORDS];
+
+// split-nibble multiplication tables of one coefficient: products with the 16 low nibbles, then the 16 high nibbles
+typedef word nibble_table[2][16];
+
+#define ECC_DEGREE_COUNT %d
+
+// index into the tables below by generator degree, -1 for degrees no ec block uses
+static const int ECC_DEGREE_INDEX[MAX_ECC_LENGTH + 1] =
+{
+	%s
+};
+
+// products of every feedback value with the generator coefficients, packed like the parity register
+static const parity_row GENERATOR_PRODUCTS[ECC_DEGREE_COUNT][GF_SIZE] =
+{''' % (MAX_ECC_LENGTH, len(DEGREES), ', '.join(str(i) for i in index)))
+
+for degree in DEGREES:
+	coefficients = generator(degree)[1:]
+	out.append('\t{ // %d' % degree)
+	for f in range(0, 256, 2):
+		out.append('\t\t%s, %s,' % (product_row(f, coefficients), product_row(f + 1, coefficients)))
+	out.append('\t},')
+
+out.append('''};
+
+// split-nibble tables of every generator coefficient: products with the 16 low nibbles, then the 16 high nibbles
+static const nibble_table GENERATOR_NIBBLES[ECC_DEGREE_COUNT][MAX_ECC_LENGTH] =
+{''')
+
+for degree in DEGREES:
+	out.append('\t{ // %d' % degree)
+	for c in generator(degree)[1:]:
+		out.append('\t\t%s,' % nibble_entry(c))
+	out.append('\t},')
+
+out.append('''};
+
+#endif // QR_ECC_TABLES_H''')
+
+print('\n'.join(out))
@@ -1,7 +1,10 @@
 #include <assert.h>
+#include <qr/ecc.h>
 #include <qr/enc.h>
 #include <qr/types.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const size_t CAPACITY_BYTES[QR_EC_LEVEL_COUNT][QR_VERSION_COUNT] =
@@ -32,72 +35,546 @@ static const size_t CAPACITY_BYTES[QR_EC_LEVEL_COUNT][QR_VERSION_COUNT] =
 	}
 };
 
+static const size_t CAPACITY_NUMERIC[QR_EC_LEVEL_COUNT][QR_VERSION_COUNT] =
+{
+	{ // L
+		  41,   77,  127,  187,  255,  322,  370,  461,  552,  652,
+		 772,  883, 1022, 1101, 1250, 1408, 1548, 1725, 1903, 2061,
+		2232, 2409, 2620, 2812, 3057, 3283, 3517, 3669, 3909, 4158,
+		4417, 4686, 4965, 5253, 5529, 5836, 6153, 6479, 6743, 7089,
+	},
+	{ // M
+		  34,   63,  101,  149,  202,  255,  293,  365,  432,  513,
+		 604,  691,  796,  871,  991, 1082, 1212, 1346, 1500, 1600,
+		1708, 1872, 2059, 2188, 2395, 2544, 2701, 2857, 3035, 3289,
+		3486, 3693, 3909, 4134, 4343, 4588, 4775, 5039, 5313, 5596,
+	},
+	{ // Q
+		  27,   48,   77,  111,  144,  178,  207,  259,  312,  364,
+		 427,  489,  580,  621,  703,  775,  876,  948, 1063, 1159,
+		1224, 1358, 1468, 1588, 1718, 1804, 1933, 2085, 2181, 2358,
+		2473, 2670, 2805, 2949, 3081, 3244, 3417, 3599, 3791, 3993,
+	},
+	{ // H
+		  17,   34,   58,   82,  106,  139,  154,  202,  235,  288,
+		 331,  374,  427,  468,  530,  602,  674,  746,  813,  919,
+		 969, 1056, 1108, 1228, 1286, 1425, 1501, 1581, 1677, 1782,
+		1897, 2022, 2157, 2301, 2361, 2524, 2625, 2735, 2927, 3057,
+	}
+};
+
+static const size_t CAPACITY_ALPHANUMERIC[QR_EC_LEVEL_COUNT][QR_VERSION_COUNT] =
+{
+	{ // L
+		  25,   47,   77,  114,  154,  195,  224,  279,  335,  395,
+		 468,  535,  619,  667,  758,  854,  938, 1046, 1153, 1249,
+		1352, 1460, 1588, 1704, 1853, 1990, 2132, 2223, 2369, 2520,
+		2677, 2840, 3009, 3183, 3351, 3537, 3729, 3927, 4087, 4296,
+	},
+	{ // M
+		  20,   38,   61,   90,  122,  154,  178,  221,  262,  311,
+		 366,  419,  483,  528,  600,  656,  734,  816,  909,  970,
+		1035, 1134, 1248, 1326, 1451, 1542, 1637, 1732, 1839, 1994,
+		2113, 2238, 2369, 2506, 2632, 2780, 2894, 3054, 3220, 3391,
+	},
+	{ // Q
+		  16,   29,   47,   67,   87,  108,  125,  157,  189,  221,
+		 259,  296,  352,  376,  426,  470,  531,  574,  644,  702,
+		 742,  823,  890,  963, 1041, 1094, 1172, 1263, 1322, 1429,
+		1499, 1618, 1700, 1787, 1867, 1966, 2071, 2181, 2298, 2420,
+	},
+	{ // H
+		  10,   20,   35,   50,   64,   84,   93,  122,  143,  174,
+		 200,  227,  259,  283,  321,  365,  408,  452,  493,  557,
+		 587,  640,  672,  744,  779,  864,  910,  958, 1016, 1080,
+		1150, 1226, 1307, 1394, 1431, 1530, 1591, 1658, 1774, 1852,
+	}
+};
+
+static const size_t CAPACITY_KANJI[QR_EC_LEVEL_COUNT][QR_VERSION_COUNT] =
+{
+	{ // L
+		  10,   20,   32,   48,   65,   82,   95,  118,  141,  167,
+		 198,  226,  262,  282,  320,  361,  397,  442,  488,  528,
+		 572,  618,  672,  721,  784,  842,  902,  940, 1002, 1066,
+		1132, 1201, 1273, 1347, 1417, 1496, 1577, 1661, 1729, 1817,
+	},
+	{ // M
+		   8,   16,   26,   38,   52,   65,   75,   93,  111,  131,
+		 155,  177,  204,  223,  254,  277,  310,  345,  384,  410,
+		 438,  480,  528,  561,  614,  652,  692,  732,  778,  843,
+		 894,  947, 1002, 1060, 1113, 1176, 1224, 1292, 1362, 1435,
+	},
+	{ // Q
+		   7,   12,   20,   28,   37,   45,   53,   66,   80,   93,
+		 109,  125,  149,  159,  180,  198,  224,  243,  272,  297,
+		 314,  348,  376,  407,  440,  462,  496,  534,  559,  604,
+		 634,  684,  719,  756,  790,  832,  876,  923,  972, 1024,
+	},
+	{ // H
+		   4,    8,   15,   21,   27,   36,   39,   52,   60,   74,
+		  85,   96,  109,  120,  136,  154,  173,  191,  208,  235,
+		 248,  270,  284,  315,  330,  365,  385,  405,  430,  457,
+		 486,  518,  553,  590,  605,  647,  673,  701,  750,  784,
+	}
+};
+
+// alphanumeric value of each character plus one, zero for characters outside the set
+static const uint8_t ALPHANUMERIC[256] =
+{
+	['0'] =  1, ['1'] =  2, ['2'] =  3, ['3'] =  4, ['4'] =  5, ['5'] =  6, ['6'] =  7, ['7'] =  8, ['8'] =  9, ['9'] = 10,
+	['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16, ['G'] = 17, ['H'] = 18, ['I'] = 19, ['J'] = 20,
+	['K'] = 21, ['L'] = 22, ['M'] = 23, ['N'] = 24, ['O'] = 25, ['P'] = 26, ['Q'] = 27, ['R'] = 28, ['S'] = 29, ['T'] = 30,
+	['U'] = 31, ['V'] = 32, ['W'] = 33, ['X'] = 34, ['Y'] = 35, ['Z'] = 36, [' '] = 37, ['$'] = 38, ['%'] = 39, ['*'] = 40,
+	['+'] = 41, ['-'] = 42, ['.'] = 43, ['/'] = 44, [':'] = 45,
+};
+
+// mode indicators and character count indicator widths for versions 1-9, 10-26 and 27-40
+static const unsigned MODE_INDICATOR[QR_MODE_COUNT] =
+{
+	[QR_MODE_BYTE] = 0x4,
+	[QR_MODE_NUMERIC] = 0x1,
+	[QR_MODE_ALPHANUMERIC] = 0x2,
+	[QR_MODE_KANJI] = 0x8,
+};
+
+static const unsigned COUNT_BITS[QR_MODE_COUNT][3] =
+{
+	[QR_MODE_BYTE] = { 8, 16, 16 },
+	[QR_MODE_NUMERIC] = { 10, 12, 14 },
+	[QR_MODE_ALPHANUMERIC] = { 9, 11, 13 },
+	[QR_MODE_KANJI] = { 8, 10, 12 },
+};
+
+static unsigned
+version_range(unsigned version)
+{
+	return version < 9 ? 0 : version < 26 ? 1 : 2;
+}
+
+static unsigned
+count_bits(qr_encoding_mode mode, unsigned version)
+{
+	return COUNT_BITS[mode][version_range(version)];
+}
+
+static size_t
+capacity(qr_encoding_mode mode, qr_ec_level level, unsigned version)
+{
+	switch (mode)
+	{
+	case QR_MODE_NUMERIC:
+		return CAPACITY_NUMERIC[level][version];
+	case QR_MODE_ALPHANUMERIC:
+		return CAPACITY_ALPHANUMERIC[level][version];
+	case QR_MODE_KANJI:
+		return CAPACITY_KANJI[level][version];
+	case QR_MODE_BYTE:
+	default:
+		return CAPACITY_BYTES[level][version];
+	}
+}
+
+// the 13-bit kanji mode value of a Shift-JIS double-byte character, -1 if kanji mode cannot hold it
+static int
+kanji_value(uint8_t high, uint8_t low)
+{
+	unsigned code = ((unsigned) high << 8) | low;
+
+	if (low < 0x40 || low > 0xFC || low == 0x7F)
+		return -1;
+
+	if (code >= 0x8140 && code <= 0x9FFC)
+		code -= 0x8140;
+	else if (code >= 0xE040 && code <= 0xEBBF)
+		code -= 0xC140;
+	else
+		return -1;
+
+	return (int) (((code >> 8) * 0xC0) + (code & 0xFF));
+}
+
 unsigned
-qr_min_version(size_t bytes, qr_ec_level level)
+qr_min_version_mode(size_t characters, qr_ec_level level, qr_encoding_mode mode)
 {
 	size_t i;
 
-	for (i = 0; i < QR_VERSION_COUNT && bytes > CAPACITY_BYTES[level][i]; ++i);
+	for (i = 0; i < QR_VERSION_COUNT && characters > capacity(mode, level, i); ++i);
 
 	return (unsigned) i;
 }
 
+size_t
+qr_mode_characters(const uint8_t *message, size_t length, qr_encoding_mode mode)
+{
+	size_t i;
+
+	switch (mode)
+	{
+	case QR_MODE_NUMERIC:
+		for (i = 0; i < length; ++i)
+			if (message[i] < '0' || message[i] > '9')
+				return SIZE_MAX;
+		return length;
+	case QR_MODE_ALPHANUMERIC:
+		for (i = 0; i < length; ++i)
+			if (!ALPHANUMERIC[message[i]])
+				return SIZE_MAX;
+		return length;
+	case QR_MODE_KANJI:
+		if (length % 2)
+			return SIZE_MAX;
+		for (i = 0; i < length; i += 2)
+			if (kanji_value(message[i], message[i + 1]) < 0)
+				return SIZE_MAX;
+		return length / 2;
+	case QR_MODE_BYTE:
+	default:
+		return length;
+	}
+}
+
+// modes a mixed message is split into, and the cost of one character in each in sixths of a bit
+#define SEGMENT_MODE_COUNT 3
+static const qr_encoding_mode SEGMENT_MODES[SEGMENT_MODE_COUNT] = { QR_MODE_NUMERIC, QR_MODE_ALPHANUMERIC, QR_MODE_BYTE };
+static const uint32_t SEGMENT_COST[SEGMENT_MODE_COUNT] = { 20, 33, 48 };
+#define SEGMENT_NONE 0xFF
+
+// shortest data bit stream splitting the message into segments for the version range. state m after character i is
+// the cheapest stream of the first i + 1 characters whose next character goes to a segment of SEGMENT_MODES[m], its
+// mode and count indicators already paid; costs are kept in sixths of a bit and rounded up to whole bits only when a
+// segment closes, which prices a segment exactly. trace[i][m] records the mode character i went to in that state, and
+// on return trace[i][0] holds the mode of character i in the shortest stream
+static size_t
+segment_message(const uint8_t *message, size_t length, unsigned range, uint8_t (*trace)[SEGMENT_MODE_COUNT])
+{
+	uint32_t head[SEGMENT_MODE_COUNT], cost[SEGMENT_MODE_COUNT], next[SEGMENT_MODE_COUNT], switched;
+	uint8_t from[SEGMENT_MODE_COUNT], c;
+	unsigned m, k, best;
+	size_t i;
+
+	if (!length)
+		return 0;
+
+	for (m = 0; m < SEGMENT_MODE_COUNT; ++m)
+		cost[m] = head[m] = (4 + COUNT_BITS[SEGMENT_MODES[m]][range]) * 6;
+
+	for (i = 0; i < length; ++i)
+	{
+		c = message[i];
+
+		// the character extends the segment of each mode able to hold it
+		from[0] = c >= '0' && c <= '9' ? 0 : SEGMENT_NONE;
+		from[1] = ALPHANUMERIC[c] ? 1 : SEGMENT_NONE;
+		from[2] = 2;
+		for (m = 0; m < SEGMENT_MODE_COUNT; ++m)
+			next[m] = from[m] == SEGMENT_NONE ? UINT32_MAX : cost[m] + SEGMENT_COST[m];
+
+		// or closes it, opening a segment of another mode for what follows
+		for (m = 0; m < SEGMENT_MODE_COUNT; ++m)
+		{
+			for (k = 0; k < SEGMENT_MODE_COUNT; ++k)
+			{
+				if (k == m || from[k] != k)
+					continue;
+
+				switched = (((cost[k] + SEGMENT_COST[k] + 5) / 6) * 6) + head[m];
+				if (switched < next[m])
+				{
+					next[m] = switched;
+					from[m] = (uint8_t) k;
+				}
+			}
+		}
+
+		if (trace)
+			memcpy(trace[i], from, sizeof(from));
+		memcpy(cost, next, sizeof(cost));
+	}
+
+	for (best = 0, m = 1; m < SEGMENT_MODE_COUNT; ++m)
+		if (cost[m] < cost[best])
+			best = m;
+
+	// walk back through the states; trace[i][0] is only overwritten once row i has been read
+	if (trace)
+	{
+		for (i = length, m = best; i-- > 0;)
+		{
+			m = trace[i][m];
+			trace[i][0] = (uint8_t) m;
+		}
+	}
+
+	return (cost[best] + 5) / 6;
+}
+
+unsigned
+qr_min_version(const uint8_t *message, size_t length, qr_ec_level level, qr_encoding_mode mode)
+{
+	size_t bits[3], characters;
+	unsigned range, version;
+
+	if (mode != QR_MODE_MIXED)
+	{
+		characters = qr_mode_characters(message, length, mode);
+		return characters == SIZE_MAX ? QR_VERSION_COUNT : qr_min_version_mode(characters, level, mode);
+	}
+
+	if (length > QR_MAX_MESSAGE_LENGTH)
+		return QR_VERSION_COUNT;
+
+	for (range = 0; range < 3; ++range)
+		bits[range] = segment_message(message, length, range, NULL);
+
+	for (version = 0; version < QR_VERSION_COUNT; ++version)
+		if (bits[version_range(version)] <= qr_data_codeword_count(level, version) * 8)
+			break;
+
+	return version;
+}
+
+qr_ec_level
+qr_max_level(const uint8_t *message, size_t length, qr_ec_level level, qr_encoding_mode mode, unsigned version)
+{
+	unsigned higher;
+
+	for (higher = QR_EC_LEVEL_H; higher > level; --higher)
+		if (qr_min_version(message, length, (qr_ec_level) higher, mode) <= version)
+			return (qr_ec_level) higher;
+
+	return level;
+}
+
+// msb-first bit stream; bits collect in a 64-bit accumulator and leave it as whole codewords, most significant first,
+// codeword n going to codewords[positions[n]], its place in the interleaved message
+typedef struct
+{
+	word *codewords;
+	const uint16_t *positions;
+	size_t count;
+	uint64_t bits;
+	unsigned length;
+} bit_writer;
+
+static void
+bit_writer_flush(bit_writer *writer)
+{
+	while (writer->length >= 8)
+	{
+		writer->length -= 8;
+		writer->codewords[writer->positions[writer->count++]] = writer->bits >> writer->length;
+	}
+
+	writer->bits &= ((uint64_t) 1 << writer->length) - 1;
+}
+
+// the lowest `length` bits of value, at most 56
+static void
+bit_writer_put(bit_writer *writer, uint64_t value, unsigned length)
+{
+	assert(length <= 56 && "Too many bits for one write");
+
+	writer->bits = (writer->bits << length) | (value & (((uint64_t) 1 << length) - 1));
+	writer->length += length;
+	bit_writer_flush(writer);
+}
+
+// whole bytes at whatever bit offset the stream is at, shifted eight at a time
+static void
+bit_writer_put_bytes(bit_writer *writer, const uint8_t *bytes, size_t count)
+{
+	uint64_t chunk, out;
+	unsigned k, offset = writer->length;
+	size_t i;
+
+	for (i = 0; i + 8 <= count; i += 8)
+	{
+		for (k = 0, chunk = 0; k < 8; ++k)
+			chunk = (chunk << 8) | bytes[i + k];
+
+		// the pending bits lead, the lowest `offset` bits of the chunk stay pending
+		out = offset ? (writer->bits << (64 - offset)) | (chunk >> offset) : chunk;
+		writer->bits = offset ? chunk & (((uint64_t) 1 << offset) - 1) : 0;
+
+		for (k = 0; k < 8; ++k)
+			writer->codewords[writer->positions[writer->count++]] = out >> (56 - (8 * k));
+	}
+
+	for (; i < count; ++i)
+		bit_writer_put(writer, bytes[i], 8);
+}
+
+// groups of three digits in 10 bits, a trailing pair in 7 and a single digit in 4
 static void
-append_bit(word *buffer, size_t *byte, size_t *bit, int value)
+encode_numeric(bit_writer *writer, const uint8_t *message, size_t length)
 {
-	buffer[*byte] |= (value & 1) << (7 - *bit);
+	size_t i, k, n;
+	unsigned group;
 
-	if (++*bit == 8)
+	for (i = 0; i < length; i += n)
 	{
-		*bit = 0;
-		++*byte;
+		n = length - i < 3 ? length - i : 3;
+
+		for (k = 0, group = 0; k < n; ++k)
+		{
+			assert(message[i + k] >= '0' && message[i + k] <= '9' && "Numeric mode only encodes digits");
+			group = (group * 10) + (unsigned) (message[i + k] - '0');
+		}
+
+		bit_writer_put(writer, group, (unsigned) ((n * 3) + 1));
 	}
 }
 
+// pairs of characters as 45 * first + second in 11 bits, a trailing character in 6
 static void
-append_byte(word *buffer, size_t *byte, size_t *bit, word value)
+encode_alphanumeric(bit_writer *writer, const uint8_t *message, size_t length)
 {
 	size_t i;
+	unsigned first, second;
 
-	for (i = 7; i < 8; --i)
-		append_bit(buffer, byte, bit, (value >> i) & 1);
+	for (i = 0; i + 1 < length; i += 2)
+	{
+		first = ALPHANUMERIC[message[i]];
+		second = ALPHANUMERIC[message[i + 1]];
+		assert(first && second && "Alphanumeric mode only encodes 0-9, A-Z and space $ % * + - . / :");
+		bit_writer_put(writer, ((first - 1) * 45) + (second - 1), 11);
+	}
+
+	if (i < length)
+	{
+		first = ALPHANUMERIC[message[i]];
+		assert(first && "Alphanumeric mode only encodes 0-9, A-Z and space $ % * + - . / :");
+		bit_writer_put(writer, first - 1, 6);
+	}
+}
+
+// Shift-JIS double-byte characters in 13 bits each
+static void
+encode_kanji(bit_writer *writer, const uint8_t *message, size_t characters)
+{
+	size_t i;
+	int value;
+
+	for (i = 0; i < characters; ++i)
+	{
+		value = kanji_value(message[2 * i], message[(2 * i) + 1]);
+		assert(value >= 0 && "Kanji mode only encodes Shift-JIS double-byte characters");
+		bit_writer_put(writer, (uint64_t) value, 13);
+	}
 }
 
-void
-qr_encode_data(qr_code *qr, const char *message)
+// mode indicator, character count and data of one segment, `length` bytes of the message
+static void
+encode_segment(bit_writer *writer, qr_encoding_mode mode, unsigned version, const uint8_t *message, size_t length)
 {
-	size_t i, length, byte = 0, bit = 0;
+	size_t characters = mode == QR_MODE_KANJI ? length / 2 : length;
 
-	switch (qr->mode)
+	assert((mode != QR_MODE_KANJI || length % 2 == 0) && "Kanji mode takes whole Shift-JIS characters");
+	assert(characters < ((size_t) 1 << count_bits(mode, version)) && "Segment too long for its character count indicator");
+
+	bit_writer_put(writer, MODE_INDICATOR[mode], 4);
+	bit_writer_put(writer, characters, count_bits(mode, version));
+
+	switch (mode)
 	{
+	case QR_MODE_NUMERIC:
+		encode_numeric(writer, message, length);
+		break;
+	case QR_MODE_ALPHANUMERIC:
+		encode_alphanumeric(writer, message, length);
+		break;
+	case QR_MODE_KANJI:
+		encode_kanji(writer, message, characters);
+		break;
 	case QR_MODE_BYTE:
-		length = strlen(message);
-		assert(length <= CAPACITY_BYTES[qr->level][qr->version] && "Message provided is too large");
+	default:
+		bit_writer_put_bytes(writer, message, length);
+		break;
+	}
+}
 
-		// byte mode indicator
-		append_bit(qr->codewords, &byte, &bit, 0);
-		append_bit(qr->codewords, &byte, &bit, 1);
-		append_bit(qr->codewords, &byte, &bit, 0);
-		append_bit(qr->codewords, &byte, &bit, 0);
+// the message split into the segments of the shortest stream for the symbol's version; -1 if that stream does not fit
+// the data codewords or the trace cannot be allocated, in which case nothing is written
+static int
+encode_mixed(bit_writer *writer, const qr_code *qr, const uint8_t *message, size_t length, size_t data_codewords)
+{
+	uint8_t (*trace)[SEGMENT_MODE_COUNT];
+	size_t start, end;
 
-		// character count indicator
-		for (i = qr->version <= 9 ? 7 : 15; i < 16; --i)
-			append_bit(qr->codewords, &byte, &bit, (length >> i) & 1);
+	// no version holds more characters, and the workspace trace is sized for this many
+	if (length > QR_MAX_MESSAGE_LENGTH)
+		return -1;
 
-		// data
-		for (i = 0; i < length; ++i)
-			append_byte(qr->codewords, &byte, &bit, message[i]);
+	trace = qr->workspace ? qr->workspace->segment_trace : malloc(length * sizeof(*trace));
+	if (!trace && length)
+		return -1;
 
-		// terminator
-		append_bit(qr->codewords, &byte, &bit, 0);
-		append_bit(qr->codewords, &byte, &bit, 0);
-		append_bit(qr->codewords, &byte, &bit, 0);
-		append_bit(qr->codewords, &byte, &bit, 0);
+	if (segment_message(message, length, version_range(qr->version), trace) > data_codewords * 8)
+	{
+		if (!qr->workspace) free(trace);
+		return -1;
+	}
 
-		// padding
-		while (bit % 8)
-			append_bit(qr->codewords, &byte, &bit, 0);
-		for (i = 0; i < CAPACITY_BYTES[qr->level][qr->version] - length; ++i)
-			append_byte(qr->codewords, &byte, &bit, i % 2 == 0 ? 0xEC : 0x11);
+	for (start = 0; start < length; start = end)
+	{
+		for (end = start + 1; end < length && trace[end][0] == trace[start][0]; ++end);
+		encode_segment(writer, SEGMENT_MODES[trace[start][0]], qr->version, message + start, end - start);
 	}
+
+	if (!qr->workspace)
+		free(trace);
+
+	return 0;
+}
+
+int
+qr_encode_data(qr_code *qr, const uint8_t *message, size_t length)
+{
+	size_t i, used, characters, data_codewords = qr_data_codeword_count(qr->level, qr->version);
+	uint16_t *positions;
+	bit_writer writer = { .codewords = qr->codewords };
+
+	if (qr->mode != QR_MODE_MIXED)
+	{
+		characters = qr_mode_characters(message, length, qr->mode);
+		if (characters == SIZE_MAX || characters > capacity(qr->mode, qr->level, qr->version))
+			return -1;
+	}
+
+	positions = qr->workspace ? qr->workspace->codeword_positions : malloc(qr->codeword_count * sizeof(uint16_t));
+	if (!positions)
+		return -1;
+	writer.positions = positions;
+
+	qr_codeword_positions(qr, positions);
+
+	if (qr->mode == QR_MODE_MIXED)
+	{
+		if (encode_mixed(&writer, qr, message, length, data_codewords))
+		{
+			if (!qr->workspace) free(positions);
+			return -1;
+		}
+	}
+	else
+	{
+		encode_segment(&writer, qr->mode, qr->version, message, length);
+	}
+
+	// terminator, cut short when the symbol is full
+	used = (writer.count * 8) + writer.length;
+	bit_writer_put(&writer, 0, (data_codewords * 8) - used < 4 ? (unsigned) ((data_codewords * 8) - used) : 4);
+
+	// padding
+	bit_writer_put(&writer, 0, (8 - writer.length) % 8);
+	for (i = 0; writer.count < data_codewords; ++i)
+		bit_writer_put(&writer, i % 2 == 0 ? 0xEC : 0x11, 8);
+
+	assert(writer.count == data_codewords && writer.length == 0 && "Data bit stream does not fill the data codewords");
+
+	if (!qr->workspace)
+		free(positions);
+
+	return 0;
 }
@@ -3,8 +3,21 @@
 
 #include <qr/types.h>
 #include <stddef.h>
+#include <stdint.h>
 
-unsigned qr_min_version(size_t bytes, qr_ec_level level);
-void qr_encode_data(qr_code *qr, const char *message);
+// messages are length-delimited byte strings and may hold NUL bytes
+
+// smallest version holding the message in the given mode, QR_VERSION_COUNT if none does or the mode cannot encode it
+unsigned qr_min_version(const uint8_t *message, size_t length, qr_ec_level level, qr_encoding_mode mode);
+// highest error correction level, no lower than the given one, at which the message still fits the version
+qr_ec_level qr_max_level(const uint8_t *message, size_t length, qr_ec_level level, qr_encoding_mode mode, unsigned version);
+// smallest version holding the characters in the given mode, QR_VERSION_COUNT if none does
+unsigned qr_min_version_mode(size_t characters, qr_ec_level level, qr_encoding_mode mode);
+// characters the message holds in the given mode, SIZE_MAX if the mode cannot encode it; kanji mode
+// reads the message as Shift-JIS double-byte characters
+size_t qr_mode_characters(const uint8_t *message, size_t length, qr_encoding_mode mode);
+// 0 on success, -1 if the symbol's mode cannot encode the message, it does not fit the symbol or a scratch buffer
+// could not be allocated; nothing is written on failure
+int qr_encode_data(qr_code *qr, const uint8_t *message, size_t length);
 
 #endif // QR_ENC_H
@@ -20,47 +20,60 @@ static const unsigned FORMAT_INFO_MAP[QR_EC_LEVEL_COUNT * QR_MASK_PATTERN_COUNT]
 	0x355F, 0x3068, 0x3F31, 0x3A06, 0x24B4, 0x2183, 0x2EDA, 0x2BED,
 };
 
+// both copies of every format information bit; negative coordinates count back from the far edge (-1 is the last row/column)
+static const int FORMAT_INFO_POSITIONS[QR_FORMAT_INFO_BITS][2][2] =
+{
+	{ { 0, 8 }, { 8, -1 } },
+	{ { 1, 8 }, { 8, -2 } },
+	{ { 2, 8 }, { 8, -3 } },
+	{ { 3, 8 }, { 8, -4 } },
+	{ { 4, 8 }, { 8, -5 } },
+	{ { 5, 8 }, { 8, -6 } },
+	{ { 7, 8 }, { 8, -7 } },
+	{ { 8, 8 }, { 8, -8 } },
+	{ { 8, 7 }, { -7, 8 } },
+	{ { 8, 5 }, { -6, 8 } },
+	{ { 8, 4 }, { -5, 8 } },
+	{ { 8, 3 }, { -4, 8 } },
+	{ { 8, 2 }, { -3, 8 } },
+	{ { 8, 1 }, { -2, 8 } },
+	{ { 8, 0 }, { -1, 8 } },
+};
+
+unsigned
+qr_format_info(qr_ec_level level, unsigned mask)
+{
+	return FORMAT_INFO_MAP[ECL_INDICATOR_MAP[level] + mask];
+}
+
 void
-qr_format_info_apply(qr_code *qr)
+qr_format_info_position(size_t side_length, unsigned bit, unsigned copy, size_t *i, size_t *j)
 {
-	unsigned format_info = FORMAT_INFO_MAP[ECL_INDICATOR_MAP[qr->level] + qr->mask];
+	int i_ = FORMAT_INFO_POSITIONS[bit][copy][0];
+	int j_ = FORMAT_INFO_POSITIONS[bit][copy][1];
 
-	// upper left
-	qr_module_set(qr, 0, 8, (format_info >> 0) & 1);
-	qr_module_set(qr, 1, 8, (format_info >> 1) & 1);
-	qr_module_set(qr, 2, 8, (format_info >> 2) & 1);
-	qr_module_set(qr, 3, 8, (format_info >> 3) & 1);
-	qr_module_set(qr, 4, 8, (format_info >> 4) & 1);
-	qr_module_set(qr, 5, 8, (format_info >> 5) & 1);
-	qr_module_set(qr, 7, 8, (format_info >> 6) & 1);
-	qr_module_set(qr, 8, 8, (format_info >> 7) & 1);
-	qr_module_set(qr, 8, 7, (format_info >> 8) & 1);
-	qr_module_set(qr, 8, 5, (format_info >> 9) & 1);
-	qr_module_set(qr, 8, 4, (format_info >> 10) & 1);
-	qr_module_set(qr, 8, 3, (format_info >> 11) & 1);
-	qr_module_set(qr, 8, 2, (format_info >> 12) & 1);
-	qr_module_set(qr, 8, 1, (format_info >> 13) & 1);
-	qr_module_set(qr, 8, 0, (format_info >> 14) & 1);
+	*i = i_ < 0 ? side_length + i_ : (size_t) i_;
+	*j = j_ < 0 ? side_length + j_ : (size_t) j_;
+}
 
-	// upper right
-	qr_module_set(qr, 8, qr->side_length - 1, (format_info >> 0) & 1);
-	qr_module_set(qr, 8, qr->side_length - 2, (format_info >> 1) & 1);
-	qr_module_set(qr, 8, qr->side_length - 3, (format_info >> 2) & 1);
-	qr_module_set(qr, 8, qr->side_length - 4, (format_info >> 3) & 1);
-	qr_module_set(qr, 8, qr->side_length - 5, (format_info >> 4) & 1);
-	qr_module_set(qr, 8, qr->side_length - 6, (format_info >> 5) & 1);
-	qr_module_set(qr, 8, qr->side_length - 7, (format_info >> 6) & 1);
-	qr_module_set(qr, 8, qr->side_length - 8, (format_info >> 7) & 1);
+void
+qr_format_info_apply(qr_code *qr)
+{
+	unsigned format_info = qr_format_info(qr->level, qr->mask);
+	unsigned bit, copy;
+	size_t i, j;
+
+	// upper left, then upper right and lower left
+	for (bit = 0; bit < QR_FORMAT_INFO_BITS; ++bit)
+	{
+		for (copy = 0; copy < 2; ++copy)
+		{
+			qr_format_info_position(qr->side_length, bit, copy, &i, &j);
+			qr_module_set(qr, i, j, (format_info >> bit) & 1);
+		}
+	}
 
-	// lower left
 	qr_module_set(qr, qr->side_length - 8, 8, QR_MODULE_DARK);
-	qr_module_set(qr, qr->side_length - 7, 8, (format_info >> 8) & 1);
-	qr_module_set(qr, qr->side_length - 6, 8, (format_info >> 9) & 1);
-	qr_module_set(qr, qr->side_length - 5, 8, (format_info >> 10) & 1);
-	qr_module_set(qr, qr->side_length - 4, 8, (format_info >> 11) & 1);
-	qr_module_set(qr, qr->side_length - 3, 8, (format_info >> 12) & 1);
-	qr_module_set(qr, qr->side_length - 2, 8, (format_info >> 13) & 1);
-	qr_module_set(qr, qr->side_length - 1, 8, (format_info >> 14) & 1);
 }
 
 static const unsigned VERSION_INFO_MAP[QR_VERSION_COUNT] =
@@ -2,7 +2,12 @@
 #define QR_INFO
 
 #include <qr/types.h>
+#include <stddef.h>
 
+#define QR_FORMAT_INFO_BITS 15
+
+unsigned qr_format_info(qr_ec_level level, unsigned mask);
+void qr_format_info_position(size_t side_length, unsigned bit, unsigned copy, size_t *i, size_t *j);
 void qr_format_info_apply(qr_code *qr);
 void qr_version_info_apply(qr_code *qr);
 
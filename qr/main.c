@@ -3,6 +3,7 @@
 #include <qr/qr.h>
 #include <qr/types.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -23,8 +24,10 @@ log_(const char *fmt, ...)
 static void
 print_usage(const char *program_name)
 {
-	log_("Usage: %s <string> [error_correction]\n", program_name);
+	log_("Usage: %s <string> [error_correction] [mode]\n", program_name);
 	log_("  error_correction: L (7%%), M (15%%), Q (25%%), H (30%%). Default: M\n");
+	log_("    append '+' (e.g. M+) to raise the level as far as the symbol's version allows\n");
+	log_("  mode: N (numeric), A (alphanumeric), B (byte), K (kanji, Shift-JIS input), M (mixed). Default: M\n");
 }
 
 static qr_ec_level
@@ -44,6 +47,24 @@ parse_ec_level(const char *level_str)
 	}
 }
 
+static qr_encoding_mode
+parse_mode(const char *mode_str)
+{
+	if (!mode_str) return QR_MODE_MIXED;
+
+	switch (mode_str[0])
+	{
+	case 'N': case 'n': return QR_MODE_NUMERIC;
+	case 'A': case 'a': return QR_MODE_ALPHANUMERIC;
+	case 'B': case 'b': return QR_MODE_BYTE;
+	case 'K': case 'k': return QR_MODE_KANJI;
+	case 'M': case 'm': return QR_MODE_MIXED;
+	default:
+		log_("Warn: Invalid mode %s, using 'M'\n", mode_str);
+		return QR_MODE_MIXED;
+	}
+}
+
 int
 main(int argc, char **argv)
 {
@@ -53,24 +74,47 @@ main(int argc, char **argv)
 		return 1;
 	}
 
-	const char *input = argv[1];
+	const uint8_t *input = (const uint8_t *) argv[1];
+	size_t length = strlen(argv[1]);
 	qr_ec_level ec_level = (argc > 2) ? parse_ec_level(argv[2]) : QR_EC_LEVEL_M;
+	int raise_ec_level = (argc > 2) && argv[2][0] && argv[2][1] == '+';
 
-	unsigned version = qr_min_version(strlen(input), ec_level);
-	if (version > QR_VERSION_COUNT)
+	qr_encoding_mode mode = parse_mode((argc > 3) ? argv[3] : NULL);
+	if (mode != QR_MODE_MIXED && qr_mode_characters(input, length, mode) == SIZE_MAX)
+	{
+		log_("Error: Input cannot be encoded in the requested mode\n");
+		return 1;
+	}
+
+	unsigned version = qr_min_version(input, length, ec_level, mode);
+	if (version >= QR_VERSION_COUNT)
 	{
 		log_("Error: Input too large for QR code\n");
 		return 1;
 	}
 
+	if (raise_ec_level)
+		ec_level = qr_max_level(input, length, ec_level, mode, version);
+
 	log_("QR Code Generation:\n");
-	log_("  Input: %s\n", input);
+	log_("  Input: %s\n", argv[1]);
 	log_("  Error Correction: %s\n", (const char *[]) { "L (7%)", "M (15%)", "Q (25%)", "H (30%)" }[ec_level]);
 	log_("  Version: %u\n", version + 1);
 	log_("\n");
 
-	qr_code *qr = qr_create(ec_level, QR_MODE_BYTE, version);
-	qr_encode_message(qr, input);
+	qr_code *qr = qr_create(ec_level, mode, version);
+	if (!qr)
+	{
+		log_("Error: Out of memory\n");
+		return 1;
+	}
+
+	if (qr_encode_bytes(qr, input, length))
+	{
+		log_("Error: Input could not be encoded\n");
+		qr_destroy(qr);
+		return 1;
+	}
 	log_("\n");
 	#ifndef NDEBUG
 	qr_matrix_print(qr, stderr);
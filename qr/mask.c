@@ -1,9 +1,18 @@
+#include <assert.h>
 #include <limits.h>
+#include <pthread.h>
 #include <qr/info.h>
 #include <qr/mask.h>
 #include <qr/matrix.h>
+#include <qr/pool.h>
 #include <qr/types.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 static int mask_pattern_0(size_t i, size_t j) { return (i + j) % 2 == 0; }
 static int mask_pattern_1(size_t i, size_t j) { (void) j; return i % 2 == 0; }
@@ -22,212 +31,732 @@ static int (* const MASK_PREDICATES[QR_MASK_PATTERN_COUNT])(size_t i, size_t j)
 
 static const int N[4] = { 3, 3, 40, 10 };
 
-static int
-feature_1_evaluation(const qr_code *qr)
+#define MAX_ROW_WORDS QR_ROW_WORDS(QR_MAX_SIDE_LENGTH)
+
+typedef qr_mask_bitboard bitboard;
+
+// lines (rows and columns) scored between two checks against the bound of a search
+#define BAND_LINES 16
+
+// word w of line shifted towards column 0 by k (bit j of the result is module j + k)
+static inline qr_module_word
+shr(const qr_module_word *line, size_t w, size_t n, unsigned k)
 {
-	// adjacent modules in row in same color
-	int points = 0;
-	size_t i, j, run_row, run_column;
-	qr_module_state color_row, color_column;
+	return (line[w] >> k) | (w + 1 < n ? line[w + 1] << (QR_MODULE_WORD_BITS - k) : 0);
+}
 
-	for (i = 0; i < qr->side_length; ++i)
+// word w of line shifted away from column 0 by k (bit j of the result is module j - k)
+static inline qr_module_word
+shl(const qr_module_word *line, size_t w, unsigned k)
+{
+	return (line[w] << k) | (w > 0 ? line[w - 1] >> (QR_MODULE_WORD_BITS - k) : 0);
+}
+
+static inline int
+popcount(qr_module_word x)
+{
+	return __builtin_popcountll(x);
+}
+
+static void
+transpose_block(qr_module_word block[QR_MODULE_WORD_BITS])
+{
+	unsigned j, k;
+	qr_module_word m, t;
+
+	// swap off-diagonal quadrants, halving the quadrant size each round
+	for (j = QR_MODULE_WORD_BITS / 2, m = 0x00000000FFFFFFFFULL; j; j >>= 1, m ^= m << j)
 	{
-		run_row = run_column = 0;
-		for (j = 0; j < qr->side_length; ++j)
+		for (k = 0; k < QR_MODULE_WORD_BITS; k = ((k | j) + 1) & ~j)
 		{
-			if (qr_module_get(qr, i, j) != color_row)
-			{
-				color_row = qr_module_get(qr, i, j);
-				if (run_row >= 5)
-					points += N[0] + run_row - 5;
-				run_row = 0;
-			}
-			if (qr_module_get(qr, j, i) != color_column)
-			{
-				color_column = qr_module_get(qr, j, i);
-				if (run_column >= 5)
-					points += N[0] + run_column - 5;
-				run_column = 0;
-			}
+			t = ((block[k] >> j) ^ block[k | j]) & m;
+			block[k] ^= t << j;
+			block[k | j] ^= t;
+		}
+	}
+}
+
+static void
+bitboard_init(bitboard *b, size_t side_length)
+{
+	size_t w, r;
+
+	b->side_length = side_length;
+	b->row_words = QR_ROW_WORDS(side_length);
+	b->transposed_columns = 0;
+
+	for (w = 0; w < b->row_words; ++w)
+	{
+		r = b->side_length - (w * QR_MODULE_WORD_BITS);
+		b->valid[w] = r >= QR_MODULE_WORD_BITS ? ~(qr_module_word) 0 : ((qr_module_word) 1 << r) - 1;
+	}
+}
+
+// fills the transposed copy for at least the first `columns` columns, one 64 column block at a time
+static void
+bitboard_transpose(bitboard *b, size_t columns)
+{
+	size_t bi, bj, r;
+	qr_module_word block[QR_MODULE_WORD_BITS];
+
+	for (bj = b->transposed_columns / QR_MODULE_WORD_BITS; b->transposed_columns < columns; ++bj)
+	{
+		for (bi = 0; bi < b->row_words; ++bi)
+		{
+			for (r = 0; r < QR_MODULE_WORD_BITS; ++r)
+				block[r] = (bi * QR_MODULE_WORD_BITS) + r < b->side_length ? b->rows[(((bi * QR_MODULE_WORD_BITS) + r) * b->row_words) + bj] : 0;
 
-			++run_row;
-			++run_column;
+			transpose_block(block);
+
+			for (r = 0; r < QR_MODULE_WORD_BITS && (bj * QR_MODULE_WORD_BITS) + r < b->side_length; ++r)
+				b->columns[(((bj * QR_MODULE_WORD_BITS) + r) * b->row_words) + bi] = block[r];
 		}
 
-		if (run_row >= 5)
-			points += N[0] + run_row - 5;
-		if (run_column >= 5)
-			points += N[0] + run_column - 5;
+		b->transposed_columns = (bj + 1) * QR_MODULE_WORD_BITS;
+		if (b->transposed_columns > b->side_length)
+			b->transposed_columns = b->side_length;
 	}
+}
 
-	return points;
+static void
+bitboard_load(bitboard *b, const qr_code *qr)
+{
+	size_t i, w;
+
+	bitboard_init(b, qr->side_length);
+
+	for (i = 0; i < b->side_length; ++i)
+		for (w = 0; w < b->row_words; ++w)
+			b->rows[(i * b->row_words) + w] = qr_matrix_row(qr, i)[w] & b->valid[w];
+
+	bitboard_transpose(b, b->side_length);
 }
 
 static int
-feature_2_evaluation(const qr_code *qr)
+feature_2_evaluation(const bitboard *b, size_t first, size_t last)
 {
-	// block of modules in same color
+	// block of modules in same color, for the blocks whose upper row is in [first, last)
 	int points = 0;
-	size_t i, j;
-	qr_module_state m[4];
+	size_t i, w, n = b->row_words;
+	const qr_module_word *upper, *lower;
+	qr_module_word same;
 
-	for (i = 0; i < qr->side_length - 1; ++i)
+	for (i = first; i < last && i + 1 < b->side_length; ++i)
 	{
-		for (j = 0; j < qr->side_length - 1; ++j)
-		{
-			m[0] = qr_module_get(qr, i, j);
-			m[1] = qr_module_get(qr, i, j + 1);
-			m[2] = qr_module_get(qr, i + 1, j);
-			m[3] = qr_module_get(qr, i + 1, j + 1);
+		upper = b->rows + (i * n);
+		lower = upper + n;
 
-			if (m[0] == m[1] && m[1] == m[2] && m[2] == m[3])
-				points += N[1];
+		for (w = 0; w < n; ++w)
+		{
+			same = ~(upper[w] ^ lower[w]) & ~(upper[w] ^ shr(upper, w, n, 1)) & ~(lower[w] ^ shr(lower, w, n, 1));
+			points += N[1] * popcount(same & b->valid[w] & shr(b->valid, w, n, 1));
 		}
 	}
 
 	return points;
 }
 
-static int
-feature_3_evaluation(const qr_code *qr)
+// lengths of the runs of equal modules in a line; returns the run count, *dark tells whether the first run is dark
+static size_t
+line_run_lengths(const qr_module_word *line, size_t n, size_t length, uint8_t *runs, int *dark)
 {
-	// 1:1:3:1:1 ratio (dark:light:dark:light:dark) pattern in row/column, preceded or followed by light area 4 modules wide
-	int points = 0;
-	size_t i, j;
-	int pattern_row, pattern_column;
-	int preceded_row, preceded_column;
-	int followed_row, followed_column;
+	size_t w, count = 0, start = 0, position;
+	qr_module_word transitions;
 
-	for (i = 0; i < qr->side_length; ++i)
+	*dark = line[0] & 1;
+
+	for (w = 0; w < n; ++w)
 	{
-		for (j = 0; j < qr->side_length - 6; ++j)
+		// bit j is set where module j differs from module j - 1
+		transitions = (line[w] ^ shl(line, w, 1)) & (w + 1 < n ? ~(qr_module_word) 0 : ((qr_module_word) 2 << ((length - 1) % QR_MODULE_WORD_BITS)) - 1);
+		if (w == 0) transitions &= ~(qr_module_word) 1;
+
+		for (; transitions; transitions &= transitions - 1)
 		{
-			pattern_row =
-				qr_module_get(qr, i, j + 0) == QR_MODULE_DARK &&
-				qr_module_get(qr, i, j + 1) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j + 2) == QR_MODULE_DARK &&
-				qr_module_get(qr, i, j + 3) == QR_MODULE_DARK &&
-				qr_module_get(qr, i, j + 4) == QR_MODULE_DARK &&
-				qr_module_get(qr, i, j + 5) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j + 6) == QR_MODULE_DARK;
-
-			preceded_row = j >= 4 &&
-				qr_module_get(qr, i, j - 1) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j - 2) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j - 3) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j - 4) == QR_MODULE_LIGHT;
-
-			followed_row = j < qr->side_length - 10 &&
-				qr_module_get(qr, i, j + 7) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j + 8) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j + 9) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, i, j + 10) == QR_MODULE_LIGHT;
-
-
-			pattern_column =
-				qr_module_get(qr, j + 0, i) == QR_MODULE_DARK &&
-				qr_module_get(qr, j + 1, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j + 2, i) == QR_MODULE_DARK &&
-				qr_module_get(qr, j + 3, i) == QR_MODULE_DARK &&
-				qr_module_get(qr, j + 4, i) == QR_MODULE_DARK &&
-				qr_module_get(qr, j + 5, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j + 6, i) == QR_MODULE_DARK;
-
-			preceded_column = j >= 4 &&
-				qr_module_get(qr, j - 1, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j - 2, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j - 3, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j - 4, i) == QR_MODULE_LIGHT;
-
-			followed_column = j < qr->side_length - 10 &&
-				qr_module_get(qr, j + 7, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j + 8, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j + 9, i) == QR_MODULE_LIGHT &&
-				qr_module_get(qr, j + 10, i) == QR_MODULE_LIGHT;
-
-			if ((pattern_row && (preceded_row || followed_row)) || (pattern_column && (preceded_column || followed_column)))
-				points += N[2];
+			position = (w * QR_MODULE_WORD_BITS) + __builtin_ctzll(transitions);
+			runs[count++] = position - start;
+			start = position;
 		}
 	}
+	runs[count++] = length - start;
+
+	return count;
+}
+
+// run penalties of a line, plus the last module of every 1:1:3:1:1 pattern with a 4 module light margin marked in hits
+static int
+line_run_evaluation(const qr_module_word *line, size_t n, size_t length, qr_module_word *hits)
+{
+	int points = 0, dark, preceded, followed;
+	size_t k, count, start, end;
+	uint8_t runs[QR_MAX_SIDE_LENGTH];
+
+	count = line_run_lengths(line, n, length, runs, &dark);
+
+	for (k = 0, start = 0; k < count; start += runs[k], ++k)
+	{
+		if (runs[k] >= 5)
+			points += N[0] + runs[k] - 5;
+
+		if (!(dark ^ (k & 1)) || k + 4 >= count || runs[k + 1] != 1 || runs[k + 2] != 3 || runs[k + 3] != 1)
+			continue;
+
+		preceded = runs[k] == 1 && k >= 1 && runs[k - 1] >= 4;
+		followed = runs[k + 4] == 1 && k + 5 < count && runs[k + 5] >= 4;
+		if (!preceded && !followed)
+			continue;
+
+		end = start + runs[k] - 1;
+		hits[end / QR_MODULE_WORD_BITS] |= (qr_module_word) 1 << (end % QR_MODULE_WORD_BITS);
+	}
 
 	return points;
 }
 
 static int
-feature_4_evaluation(const qr_code *qr)
+feature_1_3_evaluation(const bitboard *b, size_t first, size_t last)
 {
-	// proportion of dark modules in entire symbol
-	size_t i, j, dark_modules = 0;
+	// features 1 and 3 from a single run-length pass over rows and columns [first, last), which must be transposed already
+	// a row hit at (i, j) and a column hit at (j, i) are scored once together
+	int points = 0;
+	size_t i, w, n = b->row_words;
+	qr_module_word hits[MAX_ROW_WORDS];
 
-	for (i = 0; i < qr->side_length; ++i)
+	assert(last <= b->transposed_columns && "Columns are not transposed yet");
+
+	for (i = first; i < last; ++i)
 	{
-		for (j = 0; j < qr->side_length; ++j)
-		{
-			if (qr_module_get(qr, i, j) == QR_MODULE_DARK)
-				++dark_modules;
-		}
+		for (w = 0; w < n; ++w)
+			hits[w] = 0;
+
+		points += line_run_evaluation(b->rows + (i * n), n, b->side_length, hits);
+		points += line_run_evaluation(b->columns + (i * n), n, b->side_length, hits);
+
+		for (w = 0; w < n; ++w)
+			points += N[2] * popcount(hits[w]);
 	}
 
-	int percentage = (dark_modules * 100) / (qr->side_length * qr->side_length);
+	return points;
+}
+
+static int
+feature_4_evaluation(const bitboard *b)
+{
+	// proportion of dark modules in entire symbol
+	size_t i, dark_modules = 0;
+
+	for (i = 0; i < b->side_length * b->row_words; ++i)
+		dark_modules += popcount(b->rows[i]);
+
+	int percentage = (dark_modules * 100) / (b->side_length * b->side_length);
 	int deviation = percentage - 50;
 	if (deviation < 0) deviation = -deviation;
 	return N[3] * (deviation / 5);
 }
 
+// score of the bitboard, or some value above bound as soon as the running sum exceeds it
+static int
+bitboard_evaluate(bitboard *b, int bound)
+{
+	// feature 4 is exact and cheap, it gives the bound a head start
+	int points = feature_4_evaluation(b);
+	size_t first, last;
+
+	for (first = 0; first < b->side_length && points <= bound; first = last)
+	{
+		last = first + BAND_LINES < b->side_length ? first + BAND_LINES : b->side_length;
+		bitboard_transpose(b, last);
+
+		points += feature_1_3_evaluation(b, first, last) + feature_2_evaluation(b, first, last);
+	}
+
+	return points;
+}
+
+static int
+evaluate_in(const qr_code *qr, bitboard *b)
+{
+	bitboard_load(b, qr);
+
+	return bitboard_evaluate(b, INT_MAX);
+}
+
+// kept out of line, so the bitboard only takes stack space when there is no workspace
+__attribute__((noinline))
+static int
+evaluate_on_stack(const qr_code *qr)
+{
+	bitboard b;
+
+	return evaluate_in(qr, &b);
+}
+
 int
 qr_mask_evaluate(const qr_code *qr)
 {
-	return
-		feature_1_evaluation(qr) +
-		feature_2_evaluation(qr) +
-		feature_3_evaluation(qr) +
-		feature_4_evaluation(qr);
+	if (qr->workspace)
+		return evaluate_in(qr, &qr->workspace->mask_bitboard);
+
+	return evaluate_on_stack(qr);
+}
+
+// allocated and built once per version and pattern on first use, published like the placement maps
+static qr_module_word *mask_planes[QR_VERSION_COUNT][QR_MASK_PATTERN_COUNT];
+static pthread_mutex_t mask_planes_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static qr_module_word *
+mask_plane_build(unsigned version, unsigned mask_pattern)
+{
+	qr_code view = { .version = version, .side_length = QR_SIDE_LENGTH(version) };
+	const qr_module_word *reserved = qr_reserved_map(version);
+	size_t i, j;
+
+	if (!(view.matrix = malloc(qr_matrix_size(view.side_length))))
+		return NULL;
+
+	for (i = 0; i < view.side_length; ++i)
+		for (j = 0; j < view.side_length; ++j)
+			qr_module_set(&view, i, j, MASK_PREDICATES[mask_pattern](i, j));
+
+	// function patterns are never masked
+	for (i = 0; i < view.side_length * QR_ROW_WORDS(view.side_length); ++i)
+		view.matrix[i] &= ~reserved[i];
+
+	return view.matrix;
 }
 
-void
+const qr_module_word *
+qr_mask_plane(unsigned version, unsigned mask_pattern)
+{
+	qr_module_word *plane = __atomic_load_n(&mask_planes[version][mask_pattern], __ATOMIC_ACQUIRE);
+
+	if (!plane)
+	{
+		pthread_mutex_lock(&mask_planes_lock);
+
+		if (!(plane = mask_planes[version][mask_pattern]) && (plane = mask_plane_build(version, mask_pattern)))
+			__atomic_store_n(&mask_planes[version][mask_pattern], plane, __ATOMIC_RELEASE);
+
+		pthread_mutex_unlock(&mask_planes_lock);
+	}
+
+	return plane;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// dst = a ^ b for the whole 4-word groups, dst may alias a
+__attribute__((target("avx2")))
+static size_t
+xor_words_avx2(qr_module_word *dst, const qr_module_word *a, const qr_module_word *b, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+		_mm256_storeu_si256((__m256i *) (dst + i), _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) (a + i)), _mm256_loadu_si256((const __m256i *) (b + i))));
+
+	return i;
+}
+#endif
+
+// dst = a ^ b, dst may alias a
+static void
+xor_words(qr_module_word *dst, const qr_module_word *a, const qr_module_word *b, size_t n)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	size_t done;
+
+	if (__builtin_cpu_supports("avx2"))
+	{
+		done = xor_words_avx2(dst, a, b, n);
+		dst += done;
+		a += done;
+		b += done;
+		n -= done;
+	}
+#endif
+#if defined(__SSE2__)
+	for (; n >= 2; n -= 2, dst += 2, a += 2, b += 2)
+		_mm_storeu_si128((__m128i *) dst, _mm_xor_si128(_mm_loadu_si128((const __m128i *) a), _mm_loadu_si128((const __m128i *) b)));
+#endif
+	for (; n; --n)
+		*(dst++) = *(a++) ^ *(b++);
+}
+
+int
 qr_mask_apply_pattern(qr_code *qr, unsigned mask_pattern)
 {
-	if (mask_pattern >= QR_MASK_PATTERN_COUNT) return;
+	const qr_module_word *plane;
 
-	size_t i, j;
+	if (mask_pattern >= QR_MASK_PATTERN_COUNT) return 0;
+
+	assert(qr->side_length == QR_SIDE_LENGTH(qr->version) && "Matrix size does not match version");
+
+	if (!(plane = qr_mask_plane(qr->version, mask_pattern)))
+		return -1;
+
+	xor_words(qr->matrix, qr->matrix, plane, qr->side_length * QR_ROW_WORDS(qr->side_length));
+
+	return 0;
+}
 
-	for (i = 0; i < qr->side_length; ++i)
+// the masked symbol is built straight into the bitboard, qr itself is left untouched
+static int
+evaluate_pattern_in(const qr_code *qr, unsigned mask_pattern, int bound, bitboard *b)
+{
+	const qr_module_word *plane = qr_mask_plane(qr->version, mask_pattern);
+	qr_code candidate = *qr;
+	size_t i;
+
+	assert(mask_pattern < QR_MASK_PATTERN_COUNT && "Invalid mask pattern");
+	assert(qr->side_length == QR_SIDE_LENGTH(qr->version) && "Matrix size does not match version");
+
+	if (!plane)
+		return -1;
+
+	bitboard_init(b, qr->side_length);
+	candidate.matrix = b->rows;
+	candidate.mask = mask_pattern;
+	xor_words(b->rows, qr->matrix, plane, qr->side_length * b->row_words);
+	qr_format_info_apply(&candidate);
+
+	for (i = 0; i < qr->side_length * b->row_words; ++i)
+		b->rows[i] &= b->valid[i % b->row_words];
+
+	return bitboard_evaluate(b, bound);
+}
+
+// always scores on the stack, as the parallel search calls it from several threads on one symbol
+__attribute__((noinline))
+int
+qr_mask_evaluate_pattern_bounded(const qr_code *qr, unsigned mask_pattern, int bound)
+{
+	bitboard b;
+
+	return evaluate_pattern_in(qr, mask_pattern, bound, &b);
+}
+
+int
+qr_mask_evaluate_pattern(const qr_code *qr, unsigned mask_pattern)
+{
+	return qr_mask_evaluate_pattern_bounded(qr, mask_pattern, INT_MAX);
+}
+
+// mask with the lowest score, lowest index on ties; candidates that cannot beat the best so far are abandoned early
+static unsigned
+search_bounded(const qr_code *qr)
+{
+	unsigned order[QR_MASK_PATTERN_COUNT], mask, k, t, best_mask = QR_MASK_PATTERN_COUNT;
+	long predicted[QR_MASK_PATTERN_COUNT], dark;
+	int score, bound, best_score = INT_MAX;
+	size_t i, words = qr->side_length * QR_ROW_WORDS(qr->side_length);
+	const qr_module_word *plane;
+
+	// predict by the distance from a 50% dark ratio, so a low bound is usually found first
+	for (mask = 0; mask < QR_MASK_PATTERN_COUNT; ++mask)
+	{
+		plane = qr_mask_plane(qr->version, mask);
+		for (i = 0, dark = 0; i < words; ++i)
+			dark += popcount(qr->matrix[i] ^ plane[i]);
+		predicted[mask] = labs((2 * dark) - (long) (qr->side_length * qr->side_length));
+
+		for (k = mask; k > 0 && predicted[order[k - 1]] > predicted[mask]; --k)
+			order[k] = order[k - 1];
+		order[k] = mask;
+	}
+
+	for (t = 0; t < QR_MASK_PATTERN_COUNT; ++t)
+	{
+		mask = order[t];
+
+		// a lower index wins ties, a higher one has to be strictly better
+		bound = mask < best_mask ? best_score : best_score - 1;
+		score = qr->workspace ? evaluate_pattern_in(qr, mask, bound, &qr->workspace->mask_bitboard) : qr_mask_evaluate_pattern_bounded(qr, mask, bound);
+
+		if (score <= bound)
+		{
+			best_score = score;
+			best_mask = mask;
+		}
+	}
+
+	return best_mask;
+}
+
+// one byte per module, bit k holds the module under mask pattern k
+typedef uint8_t mask_slice;
+
+#define SLICE_ALL ((mask_slice) 0xFF)
+
+// adds weight times the number of bytes with bit k set to scores[k], for all eight k
+static void
+count_slices(const mask_slice *slices, size_t n, int weight, int scores[QR_MASK_PATTERN_COUNT])
+{
+	size_t i = 0;
+	unsigned k;
+	int counts[QR_MASK_PATTERN_COUNT] = { 0 };
+
+#if defined(__SSE2__)
+	// byte accumulators count at most n / 16 <= 11 hits each, so they never overflow
+	const __m128i zero = _mm_setzero_si128();
+	__m128i bits[QR_MASK_PATTERN_COUNT], sums[QR_MASK_PATTERN_COUNT], v;
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+	{
+		bits[k] = _mm_set1_epi8((char) (1 << k));
+		sums[k] = zero;
+	}
+
+	for (; i + 16 <= n; i += 16)
+	{
+		v = _mm_loadu_si128((const __m128i *) (slices + i));
+		for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+			sums[k] = _mm_sub_epi8(sums[k], _mm_cmpeq_epi8(_mm_and_si128(v, bits[k]), bits[k]));
+	}
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+	{
+		sums[k] = _mm_sad_epu8(sums[k], zero);
+		counts[k] = _mm_cvtsi128_si32(sums[k]) + _mm_cvtsi128_si32(_mm_srli_si128(sums[k], 8));
+	}
+#endif
+
+	for (; i < n; ++i)
+		for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+			counts[k] += (slices[i] >> k) & 1;
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+		scores[k] += weight * counts[k];
+}
+
+// 5 equal modules starting at p, stepping by step
+static inline mask_slice
+slice_run(const mask_slice *p, size_t step)
+{
+	return ~(p[0] ^ p[step]) & ~(p[step] ^ p[2 * step]) & ~(p[2 * step] ^ p[3 * step]) & ~(p[3 * step] ^ p[4 * step]);
+}
+
+// 1011101 starting at p, preceded and/or followed by 4 light modules where the symbol allows
+static inline mask_slice
+slice_finder_like(const mask_slice *p, ptrdiff_t step, int can_precede, int can_follow)
+{
+	mask_slice pattern = p[0] & ~p[step] & p[2 * step] & p[3 * step] & p[4 * step] & ~p[5 * step] & p[6 * step];
+	mask_slice preceded = can_precede ? ~(p[-step] | p[-2 * step] | p[-3 * step] | p[-4 * step]) : 0;
+	mask_slice followed = can_follow ? ~(p[7 * step] | p[8 * step] | p[9 * step] | p[10 * step]) : 0;
+
+	return pattern & (preceded | followed);
+}
+
+static void
+slices_load(const qr_code *qr, mask_slice *slices)
+{
+	size_t i, j, side = qr->side_length, row_words = QR_ROW_WORDS(side);
+	unsigned k, bit, copy;
+	const qr_module_word *planes[QR_MASK_PATTERN_COUNT], *row;
+	mask_slice s;
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+		planes[k] = qr_mask_plane(qr->version, k);
+
+	for (i = 0; i < side; ++i)
+	{
+		row = qr_matrix_row(qr, i);
+		for (j = 0; j < side; ++j)
+		{
+			s = (row[j / QR_MODULE_WORD_BITS] >> (j % QR_MODULE_WORD_BITS)) & 1 ? SLICE_ALL : 0;
+			for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+				s ^= ((planes[k][(i * row_words) + (j / QR_MODULE_WORD_BITS)] >> (j % QR_MODULE_WORD_BITS)) & 1) << k;
+			slices[(i * side) + j] = s;
+		}
+	}
+
+	// format information differs between the candidates
+	for (bit = 0; bit < QR_FORMAT_INFO_BITS; ++bit)
 	{
-		for (j = 0; j < qr->side_length; ++j)
+		for (s = 0, k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+			s |= ((qr_format_info(qr->level, k) >> bit) & 1) << k;
+
+		for (copy = 0; copy < 2; ++copy)
 		{
-			if (qr_module_is_reserved(qr, i, j) || !MASK_PREDICATES[mask_pattern](i, j)) continue;
+			qr_format_info_position(side, bit, copy, &i, &j);
+			slices[(i * side) + j] = s;
+		}
+	}
+	slices[((side - 8) * side) + 8] = SLICE_ALL;
+}
+
+int
+qr_mask_evaluate_sliced(const qr_code *qr, int scores[QR_MASK_PATTERN_COUNT])
+{
+	size_t i, j, side = qr->side_length;
+	unsigned k;
+	mask_slice *slices = qr->workspace ? qr->workspace->mask_slices : malloc(2 * side * side * sizeof(mask_slice));
+	mask_slice *column_hits = slices + (side * side);
+	mask_slice line[QR_MAX_SIDE_LENGTH], starts[QR_MAX_SIDE_LENGTH];
+	const mask_slice *p;
+	int dark[QR_MASK_PATTERN_COUNT] = { 0 };
+
+	assert(qr->side_length == QR_SIDE_LENGTH(qr->version) && "Matrix size does not match version");
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+	{
+		if (!qr_mask_plane(qr->version, k))
+		{
+			if (!qr->workspace) free(slices);
+			return -1;
+		}
+	}
+
+	if (!slices)
+		return -1;
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+		scores[k] = 0;
+
+	slices_load(qr, slices);
+
+	// feature 1 and 3, columns: every start row is scored for all columns at once
+	for (i = 0; i < side; ++i)
+	{
+		p = slices + (i * side);
+
+		if (i + 4 < side)
+		{
+			for (j = 0; j < side; ++j)
+			{
+				line[j] = slice_run(p + j, side);
+				starts[j] = line[j] & (i ? p[j - side] ^ p[j] : SLICE_ALL);
+			}
+			count_slices(line, side, 1, scores);
+			count_slices(starts, side, N[0] - 1, scores);
+		}
+
+		if (i + 6 < side)
+		{
+			for (j = 0; j < side; ++j)
+				column_hits[(j * side) + i] = slice_finder_like(p + j, side, i >= 4, i + 10 < side);
+		}
+	}
+
+	for (i = 0; i < side; ++i)
+	{
+		p = slices + (i * side);
+
+		// feature 1, rows
+		for (j = 0; j + 4 < side; ++j)
+		{
+			line[j] = slice_run(p + j, 1);
+			starts[j] = line[j] & (j ? p[j - 1] ^ p[j] : SLICE_ALL);
+		}
+		count_slices(line, side - 4, 1, scores);
+		count_slices(starts, side - 4, N[0] - 1, scores);
 
-			qr_module_set(qr, i, j, qr_module_get(qr, i, j) ^ 1);
+		// feature 2
+		if (i + 1 < side)
+		{
+			for (j = 0; j + 1 < side; ++j)
+				line[j] = ~(p[j] ^ p[j + 1]) & ~(p[j] ^ p[j + side]) & ~(p[j + side] ^ p[j + side + 1]);
+			count_slices(line, side - 1, N[1], scores);
 		}
+
+		// feature 3, a row hit at (i, j) and a column hit at (j, i) are scored once together
+		for (j = 0; j + 6 < side; ++j)
+			line[j] = slice_finder_like(p + j, 1, j >= 4, j + 10 < side) | column_hits[(i * side) + j];
+		count_slices(line, side - 6, N[2], scores);
+
+		// feature 4
+		count_slices(p, side, 1, dark);
 	}
+
+	for (k = 0; k < QR_MASK_PATTERN_COUNT; ++k)
+	{
+		int percentage = (dark[k] * 100) / (int) (side * side);
+		int deviation = percentage - 50;
+		if (deviation < 0) deviation = -deviation;
+		scores[k] += N[3] * (deviation / 5);
+	}
+
+	if (!qr->workspace) free(slices);
+
+	return 0;
 }
 
-void
+typedef struct
+{
+	const qr_code *qr;
+	unsigned stride;
+	int *scores;
+} mask_task;
+
+// share index of the candidates, every stride-th one
+static void
+mask_task_run(void *arg, size_t index)
+{
+	mask_task *task = arg;
+	unsigned mask;
+
+	for (mask = index; mask < QR_MASK_PATTERN_COUNT; mask += task->stride)
+		task->scores[mask] = qr_mask_evaluate_pattern(task->qr, mask);
+}
+
+// the candidates are split into one share per thread and scored on the shared worker pool
+static void
+evaluate_parallel(const qr_code *qr, unsigned threads, int scores[QR_MASK_PATTERN_COUNT])
+{
+	mask_task task = { .qr = qr, .scores = scores };
+
+	if (threads > QR_MASK_PATTERN_COUNT) threads = QR_MASK_PATTERN_COUNT;
+	if (threads > QR_POOL_MAX_THREADS) threads = QR_POOL_MAX_THREADS;
+
+	task.stride = threads;
+	qr_pool_run(mask_task_run, &task, threads);
+}
+
+static unsigned
+best_pattern(const int scores[QR_MASK_PATTERN_COUNT])
+{
+	unsigned mask, best_mask = 0;
+
+	// lowest index wins ties
+	for (mask = 1; mask < QR_MASK_PATTERN_COUNT; ++mask)
+		if (scores[mask] < scores[best_mask])
+			best_mask = mask;
+
+	return best_mask;
+}
+
+int
 qr_mask_apply(qr_code *qr)
 {
-	int score, best_score = INT_MAX;
-	unsigned mask, best_mask;
+	int scores[QR_MASK_PATTERN_COUNT];
+	unsigned mask;
+
+	// with every plane built up front, the searches below cannot fail
+	for (mask = 0; mask < QR_MASK_PATTERN_COUNT; ++mask)
+		if (!qr_mask_plane(qr->version, mask))
+			return -1;
 
 	// version info is necessary for mask evaluation
 	qr_version_info_apply(qr);
 
-	for (mask = 0; mask < QR_MASK_PATTERN_COUNT; ++mask)
+	switch (qr->mask_search)
 	{
-		qr->mask = mask;
-		qr_mask_apply_pattern(qr, mask);
-		qr_format_info_apply(qr);
-
-		score = qr_mask_evaluate(qr);
-
-		if (score < best_score)
+	case QR_MASK_SEARCH_SLICED:
+		if (!qr_mask_evaluate_sliced(qr, scores))
+			break;
+		// without memory for the slices the candidates are scored one at a time
+		// fall through
+	case QR_MASK_SEARCH_PER_PATTERN:
+	default:
+		if (qr->mask_threads > 1 && qr->version >= QR_MASK_PARALLEL_MIN_VERSION)
 		{
-			best_score = score;
-			best_mask = mask;
+			evaluate_parallel(qr, qr->mask_threads, scores);
+			break;
 		}
 
-		qr_mask_apply_pattern(qr, mask);
+		return qr_mask_apply_pattern(qr, qr->mask = search_bounded(qr));
 	}
 
-	qr->mask = best_mask;
-	qr_mask_apply_pattern(qr, best_mask);
+	qr->mask = best_pattern(scores);
+
+	return qr_mask_apply_pattern(qr, qr->mask);
 }
@@ -5,8 +5,20 @@
 
 #define QR_MASK_PATTERN_COUNT 8
 
+// smallest version (0-based) for which qr_code.mask_threads > 1 fans the mask candidates out to worker threads
+#define QR_MASK_PARALLEL_MIN_VERSION 19
+
 int qr_mask_evaluate(const qr_code *qr);
-void qr_mask_apply_pattern(qr_code *qr, unsigned mask_pattern);
-void qr_mask_apply(qr_code *qr);
+// NULL if the plane could not be allocated
+const qr_module_word *qr_mask_plane(unsigned version, unsigned mask_pattern);
+// 0 on success, -1 if the mask plane could not be allocated
+int qr_mask_apply_pattern(qr_code *qr, unsigned mask_pattern);
+// the candidate's score, -1 if the mask plane could not be allocated
+int qr_mask_evaluate_pattern(const qr_code *qr, unsigned mask_pattern);
+int qr_mask_evaluate_pattern_bounded(const qr_code *qr, unsigned mask_pattern, int bound);
+// 0 on success, -1 if the slices or mask planes could not be allocated
+int qr_mask_evaluate_sliced(const qr_code *qr, int scores[QR_MASK_PATTERN_COUNT]);
+// 0 on success, -1 if the mask planes could not be allocated
+int qr_mask_apply(qr_code *qr);
 
 #endif // QR_MASK
@@ -1,20 +1,48 @@
 #include <assert.h>
+#include <pthread.h>
 #include <qr/matrix.h>
 #include <qr/patterns.h>
 #include <qr/types.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+size_t
+qr_matrix_size(size_t side_length)
+{
+	return side_length * QR_ROW_WORDS(side_length) * sizeof(qr_module_word);
+}
+
+const qr_module_word *
+qr_matrix_row(const qr_code *qr, size_t i)
+{
+	return qr->matrix + (i * QR_ROW_WORDS(qr->side_length));
+}
+
+qr_module_word *
+qr_matrix_row_mut(qr_code *qr, size_t i)
+{
+	return qr->matrix + (i * QR_ROW_WORDS(qr->side_length));
+}
 
 qr_module_state
 qr_module_get(const qr_code *qr, size_t i, size_t j)
 {
-	return qr->matrix[i * qr->side_length + j] ? QR_MODULE_DARK : QR_MODULE_LIGHT;
+	if (i >= qr->side_length || j >= qr->side_length) return QR_MODULE_LIGHT;
+
+	return (qr_matrix_row(qr, i)[j / QR_MODULE_WORD_BITS] >> (j % QR_MODULE_WORD_BITS)) & 1;
 }
 
 void
 qr_module_set(qr_code *qr, size_t i, size_t j, qr_module_state value)
 {
-	qr->matrix[i * qr->side_length + j] = value;
+	if (i >= qr->side_length || j >= qr->side_length) return;
+
+	qr_module_word *w = qr_matrix_row_mut(qr, i) + (j / QR_MODULE_WORD_BITS);
+	qr_module_word bit = (qr_module_word) 1 << (j % QR_MODULE_WORD_BITS);
+
+	*w = value ? (*w | bit) : (*w & ~bit);
 }
 
 void
@@ -53,8 +81,8 @@ qr_matrix_print(const qr_code *qr, FILE *stream)
 	}
 }
 
-int
-qr_module_is_reserved(const qr_code *qr, size_t i, size_t j)
+static int
+module_is_reserved_uncached(const qr_code *qr, size_t i, size_t j)
 {
 	// finder pattern (7) + separator (1)
 	int in_finder_upper_left = i < 8 && j < 8;
@@ -77,42 +105,71 @@ qr_module_is_reserved(const qr_code *qr, size_t i, size_t j)
 	return in_finder || in_timing || in_alignment || in_version || in_format;
 }
 
-static void
-place_bit(qr_code *qr, size_t *i, size_t *j, int *left, int *up, qr_module_state value)
+// built once per version on first use; the flag is published with release semantics after the map is complete,
+// so readers that see it set with an acquire load never see a partial map
+static qr_module_word reserved_maps[QR_VERSION_COUNT][QR_MAX_MATRIX_WORDS];
+static int reserved_maps_initialized[QR_VERSION_COUNT];
+static pthread_mutex_t reserved_maps_lock = PTHREAD_MUTEX_INITIALIZER;
+
+const qr_module_word *
+qr_reserved_map(unsigned version)
 {
-	int exit = 0;
+	qr_code view = { .version = version, .side_length = QR_SIDE_LENGTH(version), .matrix = reserved_maps[version] };
+	size_t i, j;
+
+	if (__atomic_load_n(&reserved_maps_initialized[version], __ATOMIC_ACQUIRE)) return view.matrix;
+
+	pthread_mutex_lock(&reserved_maps_lock);
 
-	while (!exit)
+	if (!reserved_maps_initialized[version])
 	{
-		if (!qr_module_is_reserved(qr, *i, *j))
-		{
-			qr_module_set(qr, *i, *j, value);
-			exit = 1;
-		}
+		for (i = 0; i < view.side_length; ++i)
+			for (j = 0; j < view.side_length; ++j)
+				qr_module_set(&view, i, j, module_is_reserved_uncached(&view, i, j));
+
+		__atomic_store_n(&reserved_maps_initialized[version], 1, __ATOMIC_RELEASE);
+	}
+
+	pthread_mutex_unlock(&reserved_maps_lock);
 
-		if (!*left)
+	return view.matrix;
+}
+
+int
+qr_module_is_reserved(const qr_code *qr, size_t i, size_t j)
+{
+	size_t side_length = QR_SIDE_LENGTH(qr->version);
+
+	if (i >= side_length || j >= side_length) return 0;
+
+	return (qr_reserved_map(qr->version)[(i * QR_ROW_WORDS(side_length)) + (j / QR_MODULE_WORD_BITS)] >> (j % QR_MODULE_WORD_BITS)) & 1;
+}
+
+static void
+advance(size_t side_length, size_t *i, size_t *j, int *left, int *up)
+{
+	if (!*left)
+	{
+		if ((*up && *i == 0) || (!*up && *i == side_length - 1))
 		{
-			if ((*up && *i == 0) || (!*up && *i == qr->side_length - 1))
-			{
-				*up ^= 1;
-				*j -= 2;
-			}
-			else
-			{
-				*i += *up ? -1 : 1;
-			}
-			++*j;
+			*up ^= 1;
+			*j -= 2;
 		}
 		else
 		{
-			--*j;
+			*i += *up ? -1 : 1;
 		}
+		++*j;
+	}
+	else
+	{
+		--*j;
+	}
 
-		*left ^= 1;
+	*left ^= 1;
 
-		// skip vertical timing pattern
-		if (*j == 6) --*j;
-	}
+	// skip vertical timing pattern
+	if (*j == 6) --*j;
 }
 
 static const size_t REMAINDER_BITS[QR_VERSION_COUNT] =
@@ -123,23 +180,97 @@ static const size_t REMAINDER_BITS[QR_VERSION_COUNT] =
 	3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
 };
 
-void
+// allocated and built once per version on first use, published like the reserved maps
+static uint16_t *placement_maps[QR_VERSION_COUNT];
+static size_t placement_map_lengths[QR_VERSION_COUNT];
+static pthread_mutex_t placement_maps_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint16_t *
+placement_map_build(unsigned version, size_t *length)
+{
+	qr_code view = { .version = version, .side_length = QR_SIDE_LENGTH(version) };
+	size_t bit, i, j, modules;
+	int left = 1, up = 1;
+	uint16_t *map;
+
+	modules = view.side_length * view.side_length;
+	for (i = 0; i < view.side_length; ++i)
+		for (j = 0; j < view.side_length; ++j)
+			modules -= qr_module_is_reserved(&view, i, j);
+
+	assert(modules <= QR_MAX_DATA_MODULES && "Data modules do not fit into placement map");
+
+	if (!(map = malloc(modules * sizeof(uint16_t))))
+		return NULL;
+
+	i = j = view.side_length - 1;
+	for (bit = 0; bit < modules; ++bit)
+	{
+		while (qr_module_is_reserved(&view, i, j))
+			advance(view.side_length, &i, &j, &left, &up);
+
+		map[bit] = (i * QR_ROW_WORDS(view.side_length) * QR_MODULE_WORD_BITS) + j;
+		advance(view.side_length, &i, &j, &left, &up);
+	}
+
+	assert(i == view.side_length - (version + 1 >= 7 ? 11 : 8) && j == 1 && "Codewords do not fill symbol completely");
+
+	*length = modules;
+
+	return map;
+}
+
+const uint16_t *
+qr_placement_map(unsigned version, size_t *length)
+{
+	uint16_t *map = __atomic_load_n(&placement_maps[version], __ATOMIC_ACQUIRE);
+
+	if (!map)
+	{
+		// the lock is separate from the reserved maps' since building reads them
+		pthread_mutex_lock(&placement_maps_lock);
+
+		if (!(map = placement_maps[version]) && (map = placement_map_build(version, &placement_map_lengths[version])))
+			__atomic_store_n(&placement_maps[version], map, __ATOMIC_RELEASE);
+
+		pthread_mutex_unlock(&placement_maps_lock);
+
+		if (!map) return NULL;
+	}
+
+	*length = placement_map_lengths[version];
+
+	return map;
+}
+
+static inline void
+place_bit(qr_code *qr, uint16_t offset, qr_module_state value)
+{
+	qr_module_word *w = qr->matrix + (offset / QR_MODULE_WORD_BITS);
+	qr_module_word bit = (qr_module_word) 1 << (offset % QR_MODULE_WORD_BITS);
+
+	*w = (*w & ~bit) | (value ? bit : 0);
+}
+
+int
 qr_place_codewords(qr_code *qr)
 {
-	size_t word, bit;
+	size_t word, bit, length;
+	const uint16_t *offset = qr_placement_map(qr->version, &length);
 
-	size_t i, j;
-	int left = 1, up = 1;
-	i = j = qr->side_length - 1;
+	if (!offset) return -1;
+
+	assert(qr->side_length == QR_SIDE_LENGTH(qr->version) && "Matrix size does not match version");
+	assert(length == (qr->codeword_count * 8) + REMAINDER_BITS[qr->version] && "Codewords do not fill symbol completely");
 
 	for (word = 0; word < qr->codeword_count; ++word)
 	{
 		for (bit = 7; bit < 8; --bit)
-			place_bit(qr, &i, &j, &left, &up, (qr->codewords[word] >> bit) & 1);
+			place_bit(qr, *(offset++), (qr->codewords[word] >> bit) & 1);
 	}
 
 	for (bit = 0; bit < REMAINDER_BITS[qr->version]; ++bit)
-		place_bit(qr, &i, &j, &left, &up, 0);
+		place_bit(qr, *(offset++), QR_MODULE_LIGHT);
 
-	assert(i == qr->side_length - (qr->version + 1 >= 7 ? 11 : 8) && j == 1 && "Codewords do not fill symbol completely");
+	return 0;
 }
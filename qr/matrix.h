@@ -3,8 +3,12 @@
 
 #include <qr/types.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
+// largest number of data modules in any symbol (version 40 has no remainder bits)
+#define QR_MAX_DATA_MODULES (QR_MAX_CODEWORD_COUNT * 8)
+
 typedef enum
 {
 	QR_MODULE_LIGHT = 0,
@@ -13,8 +17,15 @@ typedef enum
 
 qr_module_state qr_module_get(const qr_code *qr, size_t i, size_t j);
 void qr_module_set(qr_code *qr, size_t i, size_t j, qr_module_state value);
+const qr_module_word *qr_matrix_row(const qr_code *qr, size_t i);
+qr_module_word *qr_matrix_row_mut(qr_code *qr, size_t i);
+size_t qr_matrix_size(size_t side_length);
 int qr_module_is_reserved(const qr_code *qr, size_t i, size_t j);
-void qr_place_codewords(qr_code *qr);
+const qr_module_word *qr_reserved_map(unsigned version);
+// NULL if the map could not be allocated
+const uint16_t *qr_placement_map(unsigned version, size_t *length);
+// 0 on success, -1 if the placement map could not be allocated
+int qr_place_codewords(qr_code *qr);
 void qr_matrix_print(const qr_code *qr, FILE *stream);
 
 #endif // QR_MATRIX_H
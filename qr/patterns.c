@@ -1,7 +1,10 @@
+#include <assert.h>
+#include <pthread.h>
 #include <qr/matrix.h>
 #include <qr/patterns.h>
 #include <qr/types.h>
 #include <stddef.h>
+#include <string.h>
 
 static void
 add_finder_pattern_at(qr_code *qr, size_t i, size_t j)
@@ -176,3 +179,40 @@ qr_is_in_alignment_patterns(const qr_code *qr, size_t i_, size_t j_)
 
 	return 0;
 }
+
+// built once per version on first use and published with release semantics, like the reserved maps
+static qr_module_word skeletons[QR_VERSION_COUNT][QR_MAX_MATRIX_WORDS];
+static int skeletons_initialized[QR_VERSION_COUNT];
+static pthread_mutex_t skeletons_lock = PTHREAD_MUTEX_INITIALIZER;
+
+const qr_module_word *
+qr_skeleton(unsigned version)
+{
+	qr_code view = { .version = version, .side_length = QR_SIDE_LENGTH(version), .matrix = skeletons[version] };
+
+	if (__atomic_load_n(&skeletons_initialized[version], __ATOMIC_ACQUIRE)) return view.matrix;
+
+	pthread_mutex_lock(&skeletons_lock);
+
+	if (!skeletons_initialized[version])
+	{
+		qr_finder_patterns_apply(&view);
+		qr_separators_apply(&view);
+		qr_timing_patterns_apply(&view);
+		qr_alignment_patterns_apply(&view);
+
+		__atomic_store_n(&skeletons_initialized[version], 1, __ATOMIC_RELEASE);
+	}
+
+	pthread_mutex_unlock(&skeletons_lock);
+
+	return view.matrix;
+}
+
+void
+qr_skeleton_apply(qr_code *qr)
+{
+	assert(qr->side_length == QR_SIDE_LENGTH(qr->version) && "Matrix size does not match version");
+
+	memcpy(qr->matrix, qr_skeleton(qr->version), qr_matrix_size(qr->side_length));
+}
@@ -9,6 +9,9 @@ void qr_separators_apply(qr_code *qr);
 void qr_timing_patterns_apply(qr_code *qr);
 void qr_alignment_patterns_apply(qr_code *qr);
 
+const qr_module_word *qr_skeleton(unsigned version);
+void qr_skeleton_apply(qr_code *qr);
+
 int qr_is_in_alignment_patterns(const qr_code *qr, size_t i, size_t j);
 
 #endif // QR_PATTERNS_H
@@ -0,0 +1,96 @@
+#include <pthread.h>
+#include <qr/pool.h>
+#include <stddef.h>
+
+// the indices of one call; queued while some are unclaimed, lives on the caller's stack until all are done
+typedef struct pool_job
+{
+	void (*task)(void *arg, size_t index);
+	void *arg;
+	size_t count;
+	size_t claimed;
+	size_t done;
+	struct pool_job *next;
+} pool_job;
+
+// guards everything below and the claimed and done counts of every job
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_finished = PTHREAD_COND_INITIALIZER;
+static pool_job *pool_jobs;
+static unsigned pool_workers;
+
+// claims and runs the next index of a queued job; called and returns with pool_lock held, drops it while running
+static void
+run_index(pool_job *job)
+{
+	pool_job **link;
+	size_t index = job->claimed++;
+
+	if (job->claimed == job->count)
+	{
+		for (link = &pool_jobs; *link != job; link = &(*link)->next);
+		*link = job->next;
+	}
+
+	pthread_mutex_unlock(&pool_lock);
+	job->task(job->arg, index);
+	pthread_mutex_lock(&pool_lock);
+
+	// the caller may return as soon as it sees the last index done, so the job is not touched after this
+	if (++job->done == job->count)
+		pthread_cond_broadcast(&pool_finished);
+}
+
+static void *
+worker_run(void *arg)
+{
+	(void) arg;
+
+	pthread_mutex_lock(&pool_lock);
+
+	for (;;)
+	{
+		while (!pool_jobs)
+			pthread_cond_wait(&pool_queued, &pool_lock);
+
+		run_index(pool_jobs);
+	}
+
+	return NULL;
+}
+
+void
+qr_pool_run(void (*task)(void *arg, size_t index), void *arg, size_t count)
+{
+	pool_job job = { .task = task, .arg = arg, .count = count }, **link;
+	pthread_t id;
+
+	if (count <= 1)
+	{
+		if (count) task(arg, 0);
+		return;
+	}
+
+	pthread_mutex_lock(&pool_lock);
+
+	// the pool grows to what the widest call so far can use; if a worker cannot be started the others do its share
+	while (pool_workers + 1 < count && pool_workers + 1 < QR_POOL_MAX_THREADS && !pthread_create(&id, NULL, worker_run, NULL))
+	{
+		pthread_detach(id);
+		++pool_workers;
+	}
+
+	for (link = &pool_jobs; *link; link = &(*link)->next);
+	*link = &job;
+	pthread_cond_broadcast(&pool_queued);
+
+	// the caller works on its own job rather than waiting idle
+	while (job.claimed < job.count)
+		run_index(&job);
+
+	while (job.done < job.count)
+		pthread_cond_wait(&pool_finished, &pool_lock);
+
+	pthread_mutex_unlock(&pool_lock);
+}
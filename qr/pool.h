@@ -0,0 +1,14 @@
+#ifndef QR_POOL_H
+#define QR_POOL_H
+
+#include <stddef.h>
+
+// largest number of threads, the caller included, that work on the indices of one call
+#define QR_POOL_MAX_THREADS 8
+
+// runs task(arg, index) for every index in [0, count) on the calling thread and up to count - 1 shared workers,
+// which are started on first use and kept for later calls; returns once every index is done
+// without workers, e.g. if none could be started, the caller runs every index itself
+void qr_pool_run(void (*task)(void *arg, size_t index), void *arg, size_t count);
+
+#endif // QR_POOL_H
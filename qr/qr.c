@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 extern void log_(const char *fmt, ...);
 
@@ -20,19 +21,42 @@ static const size_t CODEWORD_COUNT[QR_VERSION_COUNT] =
 	2323, 2465, 2611, 2761, 2876, 3034, 3196, 3362, 3532, 3706,
 };
 
-qr_code *
-qr_create(qr_ec_level level, qr_encoding_mode mode, unsigned version)
+static void
+init_symbol(qr_code *qr, qr_ec_level level, qr_encoding_mode mode, unsigned version)
 {
-	qr_code *qr = malloc(sizeof(qr_code));
-
 	qr->level = level;
 	qr->mode = mode;
 	qr->version = version;
-	qr->side_length = 21 + (qr->version * 4);
-	qr->matrix = malloc((qr->side_length * qr->side_length) * sizeof(*qr->matrix));
-
+	qr->mask_search = QR_MASK_SEARCH_PER_PATTERN;
+	qr->mask_threads = 1;
+	qr->side_length = QR_SIDE_LENGTH(qr->version);
 	qr->codeword_count = CODEWORD_COUNT[qr->version];
-	qr->codewords = malloc(qr->codeword_count * sizeof(word));
+	qr->ecc_threads = 1;
+}
+
+void
+qr_init(qr_code *qr, qr_workspace *workspace, qr_ec_level level, qr_encoding_mode mode, unsigned version)
+{
+	init_symbol(qr, level, mode, version);
+	qr->matrix = workspace->matrix;
+	qr->codewords = workspace->codewords;
+	qr->workspace = workspace;
+}
+
+qr_code *
+qr_create(qr_ec_level level, qr_encoding_mode mode, unsigned version)
+{
+	size_t matrix_size = qr_matrix_size(QR_SIDE_LENGTH(version));
+	// matrix and codewords follow the qr_code in one block sized for the version; sizeof(qr_code) keeps the matrix word aligned
+	qr_code *qr = malloc(sizeof(qr_code) + matrix_size + (CODEWORD_COUNT[version] * sizeof(word)));
+
+	if (!qr) return NULL;
+
+	init_symbol(qr, level, mode, version);
+	qr->matrix = (qr_module_word *) (qr + 1);
+	qr->codewords = (word *) ((char *) qr->matrix + matrix_size);
+	// without a workspace the stages allocate their scratch buffers per symbol
+	qr->workspace = NULL;
 
 	return qr;
 }
@@ -40,17 +64,25 @@ qr_create(qr_ec_level level, qr_encoding_mode mode, unsigned version)
 void
 qr_destroy(qr_code *qr)
 {
-	free(qr->codewords);
-	free(qr->matrix);
 	free(qr);
 }
 
-void
+int
 qr_encode_message(qr_code *qr, const char *message)
+{
+	return qr_encode_bytes(qr, (const uint8_t *) message, strlen(message));
+}
+
+int
+qr_encode_bytes(qr_code *qr, const uint8_t *message, size_t length)
 {
 	// 1. enc
 	log_("Encoding message............");
-	qr_encode_data(qr, message);
+	if (qr_encode_data(qr, message, length))
+	{
+		log_("FAILED\n");
+		return -1;
+	}
 	log_("OK\n");
 
 	// 2. ecc
@@ -58,36 +90,39 @@ qr_encode_message(qr_code *qr, const char *message)
 	qr_ec_encode(qr);
 	log_("OK\n");
 
-	// 3. block
-	log_("Interleaving codewords......");
-	qr_interleave_codewords(qr);
-	log_("OK\n");
-
-	// 4. matrix
+	// 3. matrix
 	log_("Generating matrix...........");
-	qr_place_codewords(qr);
-	qr_finder_patterns_apply(qr);
-	qr_separators_apply(qr);
-	qr_timing_patterns_apply(qr);
-	qr_alignment_patterns_apply(qr);
+	qr_skeleton_apply(qr);
+	if (qr_place_codewords(qr))
+	{
+		log_("FAILED\n");
+		return -1;
+	}
 	log_("OK\n");
 
-	// 5. masking
+	// 4. masking
 	log_("Masking.....................");
-	qr_mask_apply(qr);
+	if (qr_mask_apply(qr))
+	{
+		log_("FAILED\n");
+		return -1;
+	}
 	log_("OK\n");
 
-	// 6. info
+	// 5. info
 	log_("Applying meta information...");
 	qr_format_info_apply(qr);
 	qr_version_info_apply(qr);
 	log_("OK\n");
+
+	return 0;
 }
 
 void
 qr_svg_print(qr_code *qr, FILE *stream)
 {
 	size_t i, j;
+	const qr_module_word *row;
 	char *color;
 	char *fmt_str =
 		"<svg xmlns=\"http://www.w3.org/2000/svg\" "
@@ -99,9 +134,10 @@ qr_svg_print(qr_code *qr, FILE *stream)
 
 	for (i = 0; i < qr->side_length; ++i)
 	{
+		row = qr_matrix_row(qr, i);
 		for (j = 0; j < qr->side_length; ++j)
 		{
-			color = qr_module_get(qr, i, j) ? "black" : "white";
+			color = (row[j / QR_MODULE_WORD_BITS] >> (j % QR_MODULE_WORD_BITS)) & 1 ? "black" : "white";
 			fprintf(stream, "<rect x=\"%zu\" y=\"%zu\" width=\"%d\" height=\"%d\" fill=\"%s\"/>\n", j + 4, i + 4, 1, 1, color);
 		}
 	}
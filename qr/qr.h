@@ -2,11 +2,19 @@
 #define QR_QR_H
 
 #include <qr/types.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
+// sets up qr to encode into the caller's workspace, without allocating; the workspace must outlive qr
+void qr_init(qr_code *qr, qr_workspace *workspace, qr_ec_level level, qr_encoding_mode mode, unsigned version);
+// allocates a symbol with buffers sized for its version and no workspace, NULL if out of memory
 qr_code *qr_create(qr_ec_level level, qr_encoding_mode mode, unsigned version);
 void qr_destroy(qr_code *qr);
-void qr_encode_message(qr_code *qr, const char *message);
+// 0 on success, -1 if the message could not be encoded into the symbol
+int qr_encode_message(qr_code *qr, const char *message);
+// length-delimited message, which may hold NUL bytes
+int qr_encode_bytes(qr_code *qr, const uint8_t *message, size_t length);
 void qr_svg_print(qr_code *qr, FILE *stream);
 
 #endif // QR_QR_H
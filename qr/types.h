@@ -14,27 +14,85 @@ typedef enum
 } qr_ec_level;
 
 #define QR_VERSION_COUNT 40
+#define QR_SIDE_LENGTH(version) (21 + ((version) * 4))
+#define QR_MAX_SIDE_LENGTH QR_SIDE_LENGTH(QR_VERSION_COUNT - 1)
+
+// codewords of the largest version
+#define QR_MAX_CODEWORD_COUNT 3706
+// characters of the longest message, digits in version 40-L
+#define QR_MAX_MESSAGE_LENGTH 7089
 
 typedef enum
 {
 	QR_MODE_BYTE,
+	QR_MODE_NUMERIC,
+	QR_MODE_ALPHANUMERIC,
+	QR_MODE_KANJI,
+	QR_MODE_COUNT,
+	// numeric, alphanumeric and byte segments, split wherever that shortens the bit stream
+	QR_MODE_MIXED = QR_MODE_COUNT
 } qr_encoding_mode;
 
+typedef enum
+{
+	QR_MASK_SEARCH_PER_PATTERN = 0,
+	QR_MASK_SEARCH_SLICED,
+} qr_mask_search;
+
 typedef uint8_t word;
 
+// modules are packed one bit per module, row-major; every row starts on a fresh
+// word and module j of a row lives in bit (j % QR_MODULE_WORD_BITS) of word (j / QR_MODULE_WORD_BITS)
+typedef uint64_t qr_module_word;
+#define QR_MODULE_WORD_BITS 64
+#define QR_ROW_WORDS(side_length) (((side_length) + QR_MODULE_WORD_BITS - 1) / QR_MODULE_WORD_BITS)
+
+// words needed to hold the largest matrix (version 40)
+#define QR_MAX_MATRIX_WORDS (QR_MAX_SIDE_LENGTH * QR_ROW_WORDS(QR_MAX_SIDE_LENGTH))
+
+// matrix rows plus a transposed copy, so the mask search can scan columns with the same word operations as rows
+typedef struct
+{
+	size_t side_length;
+	size_t row_words;
+	qr_module_word valid[QR_ROW_WORDS(QR_MAX_SIDE_LENGTH)];
+	size_t transposed_columns;
+	qr_module_word rows[QR_MAX_MATRIX_WORDS];
+	qr_module_word columns[QR_MAX_MATRIX_WORDS];
+} qr_mask_bitboard;
+
+// memory for encoding one symbol, sized for the largest version so a single workspace can be reused for any symbol
+// only a mask search split across qr_code.mask_threads > 1 threads still scores on the stack, one bitboard per thread
+typedef struct
+{
+	qr_module_word matrix[QR_MAX_MATRIX_WORDS];
+	word codewords[QR_MAX_CODEWORD_COUNT];
+	// scratch buffers of the encoding stages
+	uint16_t codeword_positions[QR_MAX_CODEWORD_COUNT];
+	qr_mask_bitboard mask_bitboard;
+	uint8_t mask_slices[2 * QR_MAX_SIDE_LENGTH * QR_MAX_SIDE_LENGTH];
+	uint8_t segment_trace[QR_MAX_MESSAGE_LENGTH][3];
+} qr_workspace;
+
 typedef struct
 {
 	qr_ec_level level;
 	qr_encoding_mode mode;
 	unsigned version;
 
-	int *matrix;
+	qr_module_word *matrix;
 	size_t side_length;
 
 	unsigned mask;
+	qr_mask_search mask_search;
+	unsigned mask_threads;
 
 	size_t codeword_count;
 	word *codewords;
+	unsigned ecc_threads;
+
+	// scratch buffers for the encoding stages, stages allocate their own when NULL
+	qr_workspace *workspace;
 } qr_code;
 
 #endif // QR_TYPES_H
@@ -15,15 +15,142 @@
 #include "../qr/qr.c"
 
 /**
- * @brief Initialize the test environment
+ * @brief Log and antilog tables of GF(256) with the primitive polynomial 0x11D
  *
- * Sets up the Galois Field log/antilog tables required for ECC calculations.
- * This function is automatically called before each test case.
+ * Reference arithmetic the constant generator tables are checked against; the
+ * antilog table is repeated, so a product never needs a modulo 255.
+ */
+static const word gf_log[GF_SIZE] =
+{
+	  0,   0,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
+	  4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
+	  5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
+	 29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
+	  6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
+	 54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
+	 30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
+	202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
+	  7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
+	227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
+	 55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
+	242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
+	 31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
+	108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
+	203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
+	 79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175,
+};
+
+static const word gf_antilog[(GF_SIZE * 2) - 2] =
+{
+	  1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
+	 76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
+	157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
+	 70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
+	 95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
+	253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
+	217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
+	129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
+	133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
+	168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
+	230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+	227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
+	130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
+	 81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
+	 18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
+	 44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,   1,
+	  2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,  76,
+	152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192, 157,
+	 39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,  70,
+	140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,  95,
+	190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240, 253,
+	231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226, 217,
+	175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206, 129,
+	 31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204, 133,
+	 23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84, 168,
+	 77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115, 230,
+	209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255, 227,
+	219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65, 130,
+	 25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,  81,
+	162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,  18,
+	 36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,  44,
+	 88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,
+};
+
+/**
+ * @brief Multiply two elements of GF(256) through the log tables
+ */
+static inline word
+gf_mul(word a, word b)
+{
+	if (a == 0 || b == 0) return 0;
+	return gf_antilog[gf_log[a] + gf_log[b]];
+}
+
+/**
+ * @brief Build a generator polynomial by multiplying out its factors
  *
- * @return 0 on success, non-zero on failure
+ * Reference for the constant generator tables: poly receives the degree + 1
+ * coefficients of (x - a^0) ... (x - a^(degree - 1)), leading 1 last.
+ */
+static void
+generator_polynomial(word *poly, size_t degree)
+{
+	for (size_t i = 0; i < degree; i++)
+		poly[i] = 0;
+	poly[degree] = 1;
+
+	for (size_t i = 0; i < degree; i++) {
+		word coef = gf_antilog[i];
+
+		for (size_t j = 0; j < degree; j++)
+			poly[j] = gf_add(poly[j + 1], gf_mul(poly[j], coef));
+		poly[degree] = gf_mul(poly[degree], coef);
+	}
+}
+
+/**
+ * @brief Describe a single block stored contiguously
  */
-BEFORE() {
-	gf_init_log_antilog();
+static block_group
+single_block(const word *data, size_t data_length, word *ecc)
+{
+	return (block_group) { .data = data, .last = data + data_length - 1, .ecc = ecc, .stride = 1, .data_length = data_length, .block_count = 1 };
+}
+
+/**
+ * @brief Interleave a message given in block order, as the data encoder and ec encoder lay it out
+ */
+static void
+interleave_codewords(qr_code *qr)
+{
+	uint16_t positions[QR_MAX_CODEWORD_COUNT];
+	word *final_message = malloc(qr->codeword_count);
+
+	qr_codeword_positions(qr, positions);
+	for (size_t i = 0; i < qr->codeword_count; i++)
+		final_message[positions[i]] = qr->codewords[i];
+
+	memcpy(qr->codewords, final_message, qr->codeword_count);
+	free(final_message);
+}
+
+/**
+ * @brief Test the constant log and antilog tables
+ *
+ * Verifies that the antilog table enumerates the powers of the primitive
+ * element modulo 0x11D, repeated once, and that the log table inverts it.
+ *
+ * @return 0 on success, non-zero error code on failure
+ */
+TEST(gf_tables) {
+	unsigned x = 1;
+
+	for (size_t i = 0; i < GF_SIZE - 1; i++) {
+		if (gf_antilog[i] != x || gf_antilog[i + GF_SIZE - 1] != x) return 1;
+		if (gf_log[x] != i) return 2;
+		x = (x << 1) ^ ((x & 0x80) ? 0x11D : 0);
+	}
+
 	return 0;
 }
 
@@ -105,13 +232,12 @@ TEST(ecc_generation) {
 	// Simple test case: Version 1-L (7 data codewords, 10 ECC codewords)
 	word data[7] = {40, 88, 12, 6, 46, 77, 36};
 	word ecc[10] = {0};
-	word g[10 + 1] = {0};  // +1 for leading coefficient
-
-	// Generate the generator polynomial for 10 ECC codewords
-	generator_polynomial(g, 10);
 
-	// Generate ECC (skip the leading coefficient in g)
-	ecc_generate(data, 7, ecc, 10, g + 1);
+	// Generate ECC with the generator for 10 ECC codewords
+	generator_tables g;
+	generator_tables_init(&g, 10);
+	block_group block = single_block(data, 7, ecc);
+	ecc_generate(&block, 0, &g);
 
 	// Expected ECC values for the test data
 	word expected_ecc[10] = {214, 246, 18, 193, 38, 69, 160, 197, 199, 15};
@@ -169,7 +295,7 @@ TEST(codeword_interleaving_version1_h) {
 	qr.codewords = test_codewords;
 
 	// Perform interleaving
-	qr_interleave_codewords(&qr);
+	interleave_codewords(&qr);
 
 	// For Version 1-H with 1 block, the codewords should remain in the same order
 	for (size_t i = 0; i < qr.codeword_count; i++) {
@@ -223,7 +349,7 @@ TEST(codeword_interleaving_version8_m) {
 	qr.codewords = test_codewords;
 
 	// Perform interleaving
-	qr_interleave_codewords(&qr);
+	interleave_codewords(&qr);
 
 	// Expected interleaving order:
 	// 1. Data codewords from all blocks, interleaved
@@ -317,3 +443,273 @@ TEST(ecc_table_consistency) {
 
 	return 0;
 }
+
+/**
+ * @brief Test the constant generator polynomials
+ *
+ * Verifies that the constant product and nibble tables match products with
+ * freshly built generators for every ec block length, and that the table
+ * driven encoder produces the same ec codewords as long division by the
+ * coefficient form.
+ *
+ * @return 0 on success, non-zero error code on failure
+ */
+TEST(generator_tables) {
+	word poly[MAX_ECC_LENGTH + 1];
+	word data[160], expected[MAX_ECC_LENGTH], actual[MAX_ECC_LENGTH];
+	unsigned seed = 1;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		seed = (seed * 1103515245) + 12345;
+		data[i] = (word)(seed >> 16);
+	}
+	data[3] = data[4] = 0;  // exercise zero feedback
+
+	for (int level = 0; level < QR_EC_LEVEL_COUNT; level++) {
+		for (int version = 0; version < QR_VERSION_COUNT; version++) {
+			for (int block_type = 0; block_type < BLOCK_TYPES_PER_VERSION; block_type++) {
+				if (!BLOCK_COUNT[level][version][block_type]) continue;
+
+				size_t data_length = DATA_CODEWORD_COUNT[level][version][block_type];
+				size_t ecc_length = TOTAL_CODEWORD_COUNT[level][version][block_type] - data_length;
+
+				generator_polynomial(poly, ecc_length);
+
+				generator_tables g;
+				generator_tables_init(&g, ecc_length);
+
+				for (size_t f = 0; f < GF_SIZE; f++) {
+					for (size_t j = 0; j < PARITY_WORDS * 8; j++) {
+						word product = j < ecc_length ? gf_mul(f, poly[j + 1]) : 0;
+						if ((word)(g.products[f][j / 8] >> (8 * (j % 8))) != product) return 1;
+						if (f < 16 && j < ecc_length && (g.nibbles[j][0][f] != product || g.nibbles[j][1][f] != gf_mul(f << 4, poly[j + 1]))) return 2;
+					}
+				}
+
+				// plain long division by the coefficient form
+				memset(expected, 0, ecc_length);
+				for (size_t i = 0; i < data_length; i++) {
+					word feedback = gf_add(data[i], expected[0]);
+					for (size_t j = 0; j < ecc_length; j++)
+						expected[j] = gf_add(j + 1 < ecc_length ? expected[j + 1] : 0, gf_mul(feedback, poly[j + 1]));
+				}
+				block_group block = single_block(data, data_length, actual);
+				ecc_generate(&block, 0, &g);
+
+				if (memcmp(expected, actual, ecc_length)) return 3;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test the vector lane encoders
+ *
+ * Verifies that encoding the blocks of every version and level side by side
+ * in vector lanes produces the same ec codewords as the scalar encoder, for
+ * every instruction set the CPU supports.
+ *
+ * @return 0 on success, non-zero error code on failure
+ */
+TEST(ecc_lanes_match_scalar) {
+#if ECC_LANES
+	static word data[3706], expected[3706 * 2], actual[3706 * 2];
+	unsigned seed = 7;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		seed = (seed * 1103515245) + 12345;
+		data[i] = (word)(seed >> 16);
+	}
+
+	for (int level = 0; level < QR_EC_LEVEL_COUNT; level++) {
+		for (int version = 0; version < QR_VERSION_COUNT; version++) {
+			for (int block_type = 0; block_type < BLOCK_TYPES_PER_VERSION; block_type++) {
+				size_t block_count = BLOCK_COUNT[level][version][block_type];
+				if (!block_count) continue;
+
+				size_t data_length = DATA_CODEWORD_COUNT[level][version][block_type];
+				size_t ecc_length = TOTAL_CODEWORD_COUNT[level][version][block_type] - data_length;
+
+				generator_tables g;
+				generator_tables_init(&g, ecc_length);
+				memset(expected, 0, sizeof(expected));
+
+				// rows wider than the group and a last row elsewhere, like the longer blocks of an interleaved message
+				block_group blocks = { .data = data, .last = data + 3000, .ecc = expected, .stride = block_count + 3, .data_length = data_length, .block_count = block_count };
+
+				for (size_t block = 0; block < block_count; block++)
+					ecc_generate(&blocks, block, &g);
+
+				if (__builtin_cpu_supports("ssse3")) {
+					memset(actual, 0, sizeof(actual));
+					blocks.ecc = actual;
+					ecc_generate_lanes_ssse3(&blocks, &g);
+					if (memcmp(expected, actual, sizeof(actual))) return 1000 + (level * 100) + version;
+				}
+
+				if (__builtin_cpu_supports("avx2")) {
+					memset(actual, 0, sizeof(actual));
+					blocks.ecc = actual;
+					ecc_generate_lanes_avx2(&blocks, &g);
+					if (memcmp(expected, actual, sizeof(actual))) return 2000 + (level * 100) + version;
+				}
+			}
+		}
+	}
+#endif
+
+	return 0;
+}
+
+/**
+ * @brief Test multi-threaded ec generation
+ *
+ * Verifies that splitting the blocks of every version and level between
+ * worker threads produces the same codewords as encoding them on a single
+ * thread, for several thread counts.
+ *
+ * @return 0 on success, non-zero error code on failure
+ */
+TEST(ecc_parallel_matches_serial) {
+	static word serial[3706], parallel[3706];
+	unsigned seed = 11;
+
+	for (size_t i = 0; i < sizeof(serial); i++) {
+		seed = (seed * 1103515245) + 12345;
+		serial[i] = (word)(seed >> 16);
+	}
+
+	for (int level = 0; level < QR_EC_LEVEL_COUNT; level++) {
+		for (int version = 0; version < QR_VERSION_COUNT; version++) {
+			qr_code qr = { .level = level, .version = version, .codeword_count = CODEWORD_COUNT[version], .codewords = serial, .ecc_threads = 1 };
+			size_t block_count = BLOCK_COUNT[level][version][0] + BLOCK_COUNT[level][version][1];
+
+			qr_ec_encode(&qr);
+
+			for (unsigned threads = 2; threads <= QR_POOL_MAX_THREADS + 1; threads++) {
+				memcpy(parallel, serial, TOTAL_DATA_CODEWORD_COUNT[level][version]);
+				memset(parallel + TOTAL_DATA_CODEWORD_COUNT[level][version], 0, qr.codeword_count - TOTAL_DATA_CODEWORD_COUNT[level][version]);
+				qr.codewords = parallel;
+
+				// below the threshold qr_ec_encode stays on one thread, so split the blocks directly
+				ecc_generate_parallel(&qr, threads, block_count);
+				qr.codewords = serial;
+
+				if (memcmp(serial, parallel, qr.codeword_count)) {
+					printf("Mismatch for level %d, version %d, %u threads\n", level, version + 1, threads);
+					return 1000 + (level * 100) + version;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test ec generation on the interleaved message
+ *
+ * Verifies that scattering the data codewords to their interleaved positions
+ * and encoding them in place yields the same message as encoding every block
+ * on its own and interleaving the result afterwards.
+ *
+ * @return 0 on success, non-zero error code on failure
+ */
+TEST(ecc_interleaved_matches_block_order) {
+	static word expected[3706], actual[3706];
+	uint16_t positions[QR_MAX_CODEWORD_COUNT];
+	unsigned seed = 13;
+
+	for (int level = 0; level < QR_EC_LEVEL_COUNT; level++) {
+		for (int version = 0; version < QR_VERSION_COUNT; version++) {
+			qr_code qr = { .level = level, .version = version, .codeword_count = CODEWORD_COUNT[version], .codewords = expected, .ecc_threads = 1 };
+			size_t data_count = TOTAL_DATA_CODEWORD_COUNT[level][version];
+
+			for (size_t i = 0; i < data_count; i++) {
+				seed = (seed * 1103515245) + 12345;
+				expected[i] = (word)(seed >> 16);
+			}
+
+			// block order: the data of every block, then the ec codewords of every block
+			word *data = expected, *ecc = expected + data_count;
+			for (int block_type = 0; block_type < BLOCK_TYPES_PER_VERSION; block_type++) {
+				size_t data_length = DATA_CODEWORD_COUNT[level][version][block_type];
+				size_t ecc_length = TOTAL_CODEWORD_COUNT[level][version][block_type] - data_length;
+				if (!BLOCK_COUNT[level][version][block_type]) continue;
+
+				generator_tables g;
+				generator_tables_init(&g, ecc_length);
+				for (size_t block = 0; block < BLOCK_COUNT[level][version][block_type]; block++) {
+					block_group single = single_block(data, data_length, ecc);
+					ecc_generate(&single, 0, &g);
+					data += data_length;
+					ecc += ecc_length;
+				}
+			}
+
+			qr_codeword_positions(&qr, positions);
+			memset(actual, 0, sizeof(actual));
+			for (size_t i = 0; i < data_count; i++)
+				actual[positions[i]] = expected[i];
+
+			interleave_codewords(&qr);
+			qr.codewords = actual;
+			qr_ec_encode(&qr);
+
+			if (memcmp(expected, actual, qr.codeword_count)) {
+				printf("Mismatch for level %d, version %d\n", level, version + 1);
+				return 1000 + (level * 100) + version;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test encoding into a reused workspace
+ *
+ * Verifies that symbols encoded one after another into the same caller
+ * provided workspace, large and small in turn, match symbols encoded into
+ * freshly allocated ones.
+ *
+ * @return 0 on success, non-zero error code on failure
+ */
+TEST(workspace_reuse) {
+	static char large[1001];
+	const char *messages[] = {large, "hello", large, "https://example.com/workspace"};
+	const unsigned versions[] = {39, 0, 29, 3};
+	qr_workspace *workspace = malloc(sizeof(qr_workspace));
+	if (!workspace) return 1;
+
+	memset(large, 'q', sizeof(large) - 1);
+
+	for (int m = 0; m < 4; m++) {
+		qr_code reused;
+		qr_init(&reused, workspace, QR_EC_LEVEL_M, QR_MODE_BYTE, versions[m]);
+		reused.mask_search = m % 2 ? QR_MASK_SEARCH_SLICED : QR_MASK_SEARCH_PER_PATTERN;
+		qr_encode_message(&reused, messages[m]);
+
+		qr_code *fresh = qr_create(QR_EC_LEVEL_M, QR_MODE_BYTE, versions[m]);
+		if (!fresh || qr_encode_message(fresh, messages[m])) {
+			qr_destroy(fresh);
+			free(workspace);
+			return 1;
+		}
+
+		int same = reused.mask == fresh->mask
+			&& !memcmp(reused.codewords, fresh->codewords, fresh->codeword_count)
+			&& !memcmp(reused.matrix, fresh->matrix, qr_matrix_size(fresh->side_length));
+		qr_destroy(fresh);
+
+		if (!same) {
+			free(workspace);
+			return 2 + m;
+		}
+	}
+
+	free(workspace);
+	return 0;
+}
@@ -0,0 +1,565 @@
+/**
+ * @file enc.c
+ * @brief Test cases for QR code data encoding
+ *
+ * This file contains test cases for the data encoding module, including the
+ * bit stream writer and the layout of the encoded data codewords.
+ */
+
+#include <test/base.h>
+#include <qr/types.h>
+#include <qr/ecc.h>
+#include <string.h>
+#include <stdlib.h>
+
+// Include the source file directly to test static functions
+#include "../qr/enc.c"
+#include "../qr/qr.c"
+
+// a string literal as a length-delimited message
+#define BYTES(text) (const uint8_t *) (text), sizeof(text) - 1
+
+/**
+ * @brief Reference writer appending one bit at a time, msb first, into a zeroed buffer
+ */
+static void reference_put(word *buffer, size_t *bit, uint64_t value, unsigned length) {
+	for (unsigned i = length - 1; i < length; i--, (*bit)++)
+		buffer[*bit / 8] |= ((value >> i) & 1) << (7 - (*bit % 8));
+}
+
+/**
+ * @brief Reads `length` bits of the data stream, codeword n stored at codewords[positions[n]]
+ */
+static unsigned read_bits(const word *codewords, const uint16_t *positions, size_t *bit, unsigned length) {
+	unsigned value = 0;
+	for (unsigned i = 0; i < length; i++, (*bit)++)
+		value = (value << 1) | ((codewords[positions[*bit / 8]] >> (7 - (*bit % 8))) & 1);
+	return value;
+}
+
+/**
+ * @brief Reference decoder of the numeric, alphanumeric, byte and kanji segments of an encoded symbol
+ *
+ * Kanji characters are written back as their two Shift-JIS bytes.
+ *
+ * @return length of the decoded message, or (size_t) -1 if the stream is malformed
+ */
+static size_t decode_data(const qr_code *qr, char *message) {
+	static const char set[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+	static uint16_t positions[QR_MAX_CODEWORD_COUNT];
+	size_t bit = 0, length = 0, bits = qr_data_codeword_count(qr->level, qr->version) * 8;
+
+	qr_codeword_positions(qr, positions);
+
+	while (bits - bit >= 4) {
+		unsigned indicator = read_bits(qr->codewords, positions, &bit, 4), count;
+		if (indicator == 0) break;
+
+		switch (indicator) {
+		case 0x1:
+			count = read_bits(qr->codewords, positions, &bit, count_bits(QR_MODE_NUMERIC, qr->version));
+			for (unsigned i = 0; i < count; i += 3) {
+				unsigned n = count - i < 3 ? count - i : 3;
+				unsigned group = read_bits(qr->codewords, positions, &bit, (n * 3) + 1);
+				for (unsigned k = n; k-- > 0; group /= 10) message[length + k] = (char) ('0' + (group % 10));
+				length += n;
+			}
+			break;
+		case 0x2:
+			count = read_bits(qr->codewords, positions, &bit, count_bits(QR_MODE_ALPHANUMERIC, qr->version));
+			for (unsigned i = 0; i + 1 < count; i += 2) {
+				unsigned pair = read_bits(qr->codewords, positions, &bit, 11);
+				message[length++] = set[pair / 45];
+				message[length++] = set[pair % 45];
+			}
+			if (count % 2) message[length++] = set[read_bits(qr->codewords, positions, &bit, 6)];
+			break;
+		case 0x4:
+			count = read_bits(qr->codewords, positions, &bit, count_bits(QR_MODE_BYTE, qr->version));
+			for (unsigned i = 0; i < count; i++) message[length++] = (char) read_bits(qr->codewords, positions, &bit, 8);
+			break;
+		case 0x8:
+			count = read_bits(qr->codewords, positions, &bit, count_bits(QR_MODE_KANJI, qr->version));
+			for (unsigned i = 0; i < count; i++) {
+				unsigned value = read_bits(qr->codewords, positions, &bit, 13);
+				unsigned code = ((value / 0xC0) << 8) | (value % 0xC0);
+				code += code + 0x8140 <= 0x9FFC ? 0x8140 : 0xC140;
+				message[length++] = (char) (code >> 8);
+				message[length++] = (char) (code & 0xFF);
+			}
+			break;
+		default:
+			return (size_t) -1;
+		}
+
+		if (bit > bits) return (size_t) -1;
+	}
+
+	message[length] = '\0';
+	return length;
+}
+
+/**
+ * @brief Test the accumulating bit writer
+ *
+ * Verifies that mixing short writes with byte runs of every length, starting
+ * at every bit offset, produces the same stream as writing one bit at a time,
+ * and that every codeword is written regardless of what the buffer held.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(bit_writer_matches_reference) {
+	uint16_t positions[64];
+	uint8_t bytes[40];
+	word expected[64], actual[64];
+
+	for (int i = 0; i < 64; i++) positions[i] = i;
+	for (int i = 0; i < 40; i++) bytes[i] = (uint8_t)((i * 97) + 13);
+
+	for (unsigned offset = 0; offset < 8; offset++) {
+		for (size_t count = 0; count <= 24; count++) {
+			size_t bit = 0;
+			memset(expected, 0, sizeof(expected));
+			memset(actual, 0xA5, sizeof(actual));  // stale contents must be overwritten
+			bit_writer writer = { .codewords = actual, .positions = positions };
+
+			bit_writer_put(&writer, 0x5A, offset);
+			reference_put(expected, &bit, 0x5A, offset);
+			bit_writer_put(&writer, 0x3, 12);
+			reference_put(expected, &bit, 0x3, 12);
+			bit_writer_put_bytes(&writer, bytes, count);
+			for (size_t i = 0; i < count; i++)
+				reference_put(expected, &bit, bytes[i], 8);
+			bit_writer_put(&writer, 0, (8 - writer.length) % 8);
+			bit = (bit + 7) / 8 * 8;
+
+			if (writer.length != 0 || writer.count != bit / 8) return 1000 + (offset * 100) + count;
+			if (memcmp(expected, actual, bit / 8)) return 2000 + (offset * 100) + count;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test byte mode data encoding
+ *
+ * Verifies the mode indicator, character count and padding of a short byte
+ * mode message, and that leftover codewords from a previous symbol do not
+ * leak into the encoding.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_byte_mode) {
+	// Version 1-M: 16 data codewords
+	const word expected[16] = {
+		0x40, 0x56, 0x86, 0x56, 0xC6, 0xC6, 0xF0, 0xEC,
+		0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC,
+	};
+	word codewords[26];
+	qr_code qr = { .level = QR_EC_LEVEL_M, .version = 0, .mode = QR_MODE_BYTE, .codeword_count = 26, .codewords = codewords };
+
+	memset(codewords, 0xFF, sizeof(codewords));
+	qr_encode_data(&qr, BYTES("hello"));
+
+	for (int i = 0; i < 16; i++)
+		if (codewords[i] != expected[i]) return i + 1;
+
+	return 0;
+}
+
+/**
+ * @brief Test numeric mode data encoding
+ *
+ * Verifies the encoding of "01234567" in a version 1-M symbol against the
+ * worked example of the QR code specification.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_numeric_mode) {
+	const word expected[16] = {
+		0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11,
+		0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11,
+	};
+	word codewords[26];
+	qr_code qr = { .level = QR_EC_LEVEL_M, .version = 0, .mode = QR_MODE_NUMERIC, .codeword_count = 26, .codewords = codewords };
+
+	if (qr_mode_characters(BYTES("01234567"), QR_MODE_NUMERIC) != 8) return 100;
+	if (qr_mode_characters(BYTES("0123456a"), QR_MODE_NUMERIC) != SIZE_MAX) return 101;
+
+	memset(codewords, 0xFF, sizeof(codewords));
+	qr_encode_data(&qr, BYTES("01234567"));
+
+	for (int i = 0; i < 16; i++)
+		if (codewords[i] != expected[i]) return i + 1;
+
+	return 0;
+}
+
+/**
+ * @brief Test alphanumeric mode data encoding
+ *
+ * Verifies the encoding of "AC-42" in a version 1-M symbol against the worked
+ * example of the QR code specification, and the character count of messages
+ * inside and outside the alphanumeric set.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_alphanumeric_mode) {
+	const word expected[16] = {
+		0x20, 0x29, 0xCE, 0xE7, 0x21, 0x00, 0xEC, 0x11,
+		0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11,
+	};
+	word codewords[26];
+	qr_code qr = { .level = QR_EC_LEVEL_M, .version = 0, .mode = QR_MODE_ALPHANUMERIC, .codeword_count = 26, .codewords = codewords };
+
+	if (qr_mode_characters(BYTES("AC-42"), QR_MODE_ALPHANUMERIC) != 5) return 100;
+	if (qr_mode_characters(BYTES("HTTPS://EXAMPLE.COM/$%*+"), QR_MODE_ALPHANUMERIC) != 24) return 101;
+	if (qr_mode_characters(BYTES("AC-42a"), QR_MODE_ALPHANUMERIC) != SIZE_MAX) return 102;
+	if (qr_mode_characters(BYTES("AC_42"), QR_MODE_ALPHANUMERIC) != SIZE_MAX) return 103;
+	if (qr_mode_characters(BYTES(""), QR_MODE_ALPHANUMERIC) != 0) return 104;
+
+	memset(codewords, 0xFF, sizeof(codewords));
+	qr_encode_data(&qr, BYTES("AC-42"));
+
+	for (int i = 0; i < 16; i++)
+		if (codewords[i] != expected[i]) return i + 1;
+
+	return 0;
+}
+
+/**
+ * @brief Test kanji mode data encoding
+ *
+ * Verifies the encoding of the Shift-JIS characters 0x935F and 0xE4AA in a
+ * version 1-M symbol against the worked example of the QR code specification,
+ * and the validation of Shift-JIS input.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_kanji_mode) {
+	const word expected[16] = {
+		0x80, 0x26, 0xCF, 0xEA, 0xA8, 0x00, 0xEC, 0x11,
+		0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11,
+	};
+	word codewords[26];
+	qr_code qr = { .level = QR_EC_LEVEL_M, .version = 0, .mode = QR_MODE_KANJI, .codeword_count = 26, .codewords = codewords };
+
+	if (qr_mode_characters(BYTES("\x93\x5F\xE4\xAA"), QR_MODE_KANJI) != 2) return 100;
+	if (qr_mode_characters(BYTES("\x81\x40\x9F\xFC\xE0\x40\xEB\xBF"), QR_MODE_KANJI) != 4) return 101;
+	if (qr_mode_characters(BYTES("\x93\x5F\xE4"), QR_MODE_KANJI) != SIZE_MAX) return 102;     // half a character
+	if (qr_mode_characters(BYTES("\x93\x7F"), QR_MODE_KANJI) != SIZE_MAX) return 103;         // invalid trail byte
+	if (qr_mode_characters(BYTES("\xEB\xC0"), QR_MODE_KANJI) != SIZE_MAX) return 104;         // past the kanji range
+	if (qr_mode_characters(BYTES("\xA0\x40"), QR_MODE_KANJI) != SIZE_MAX) return 105;         // half-width katakana
+	if (qr_mode_characters(BYTES("AB"), QR_MODE_KANJI) != SIZE_MAX) return 106;
+	if (qr_mode_characters(BYTES("AB"), QR_MODE_NUMERIC) != SIZE_MAX) return 107;
+	if (qr_mode_characters(BYTES("ab"), QR_MODE_ALPHANUMERIC) != SIZE_MAX) return 108;
+	if (qr_mode_characters(BYTES("ab"), QR_MODE_BYTE) != 2) return 109;
+
+	memset(codewords, 0xFF, sizeof(codewords));
+	qr_encode_data(&qr, BYTES("\x93\x5F\xE4\xAA"));
+
+	for (int i = 0; i < 16; i++)
+		if (codewords[i] != expected[i]) return i + 1;
+
+	return 0;
+}
+
+/**
+ * @brief Test the capacity tables of every mode
+ *
+ * Verifies that every capacity is the largest character count whose mode
+ * indicator, count indicator and data fit the data codewords of the symbol,
+ * that a message of exactly that length encodes into the symbol's real
+ * codewords and decodes back to itself, and that qr_min_version_mode agrees
+ * with the tables.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(capacity_tables) {
+	static const char set[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+	static const uint8_t kanji[][2] = { {0x93, 0x5F}, {0xE4, 0xAA}, {0x81, 0x40}, {0x9F, 0xFC}, {0xE0, 0x40}, {0xEB, 0xBF} };
+	static uint8_t message[QR_MAX_MESSAGE_LENGTH + 1];
+	static char decoded[QR_MAX_MESSAGE_LENGTH + 1];
+	static word codewords[QR_MAX_CODEWORD_COUNT];
+	const qr_encoding_mode modes[] = {QR_MODE_BYTE, QR_MODE_NUMERIC, QR_MODE_ALPHANUMERIC, QR_MODE_KANJI};
+
+	for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+		qr_encoding_mode mode = modes[m];
+
+		for (int level = 0; level < QR_EC_LEVEL_COUNT; level++) {
+			for (unsigned version = 0; version < QR_VERSION_COUNT; version++) {
+				size_t n = capacity(mode, level, version);
+				size_t bits = (qr_data_codeword_count(level, version) * 8) - 4 - count_bits(mode, version);
+				size_t needed = 0, needed_next = 0, length = n;
+
+				switch (mode) {
+				case QR_MODE_NUMERIC:
+					needed = (10 * (n / 3)) + (n % 3 ? (3 * (n % 3)) + 1 : 0);
+					needed_next = (10 * ((n + 1) / 3)) + ((n + 1) % 3 ? (3 * ((n + 1) % 3)) + 1 : 0);
+					for (size_t i = 0; i < n; i++) message[i] = (uint8_t) ('0' + ((i * 7) % 10));
+					break;
+				case QR_MODE_ALPHANUMERIC:
+					needed = (11 * (n / 2)) + (6 * (n % 2));
+					needed_next = (11 * ((n + 1) / 2)) + (6 * ((n + 1) % 2));
+					for (size_t i = 0; i < n; i++) message[i] = (uint8_t) set[(i * 7) % 45];
+					break;
+				case QR_MODE_KANJI:
+					needed = 13 * n;
+					needed_next = 13 * (n + 1);
+					for (size_t i = 0; i < n; i++) memcpy(message + (2 * i), kanji[i % 6], 2);
+					length = 2 * n;
+					break;
+				default:
+					needed = 8 * n;
+					needed_next = 8 * (n + 1);
+					for (size_t i = 0; i < n; i++) message[i] = (uint8_t) ((i * 37) + level);
+					break;
+				}
+
+				if (needed > bits || needed_next <= bits) return 1000 + (m * 200) + (level * 40) + version;
+				if (qr_min_version_mode(n, level, mode) > version) return 2000 + (m * 200) + (level * 40) + version;
+				if (qr_min_version_mode(n + 1, level, mode) <= version) return 3000 + (m * 200) + (level * 40) + version;
+
+				// a full symbol must encode into the version's own codewords and decode to the message
+				memset(codewords, 0xFF, sizeof(codewords));
+				qr_code qr = { .level = level, .version = version, .mode = mode, .codeword_count = CODEWORD_COUNT[version], .codewords = codewords };
+				if (qr_encode_data(&qr, message, length)) return 4000 + (m * 200) + (level * 40) + version;
+				if (decode_data(&qr, decoded) != length || memcmp(decoded, message, length)) return 5000 + (m * 200) + (level * 40) + version;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Bits of a segmentation, one mode per character, for a version range
+ */
+static size_t segmentation_bits(const char *message, const uint8_t *modes, size_t length, unsigned range) {
+	size_t bits = 0;
+
+	for (size_t start = 0, end; start < length; start = end) {
+		for (end = start + 1; end < length && modes[end] == modes[start]; end++);
+		size_t n = end - start;
+		qr_encoding_mode mode = SEGMENT_MODES[modes[start]];
+
+		for (size_t i = start; i < end; i++) {
+			if (mode == QR_MODE_NUMERIC && (message[i] < '0' || message[i] > '9')) return SIZE_MAX;
+			if (mode == QR_MODE_ALPHANUMERIC && !ALPHANUMERIC[(uint8_t) message[i]]) return SIZE_MAX;
+		}
+
+		bits += 4 + COUNT_BITS[mode][range];
+		switch (mode) {
+		case QR_MODE_NUMERIC: bits += (10 * (n / 3)) + (n % 3 ? (3 * (n % 3)) + 1 : 0); break;
+		case QR_MODE_ALPHANUMERIC: bits += (11 * (n / 2)) + (6 * (n % 2)); break;
+		default: bits += 8 * n; break;
+		}
+	}
+
+	return bits;
+}
+
+/**
+ * @brief Test the mixed mode segmentation against an exhaustive search
+ *
+ * Verifies for short random messages of digits, capitals and lowercase letters
+ * that the segmentation is as short as the best of every possible assignment
+ * of modes to characters, in all three version ranges, and that the traced
+ * segments add up to the reported length.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(segmentation_is_optimal) {
+	const char alphabet[] = "0123456789012345ABCDEFG:/a";
+	char message[9];
+	uint8_t modes[8], trace[8][SEGMENT_MODE_COUNT];
+
+	srand(7);
+	for (int t = 0; t < 300; t++) {
+		size_t length = 1 + (size_t) (rand() % 8);
+		for (size_t i = 0; i < length; i++) message[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+		message[length] = '\0';
+
+		for (unsigned range = 0; range < 3; range++) {
+			size_t best = SIZE_MAX, combinations = 1;
+			for (size_t i = 0; i < length; i++) combinations *= SEGMENT_MODE_COUNT;
+
+			for (size_t c = 0; c < combinations; c++) {
+				for (size_t i = 0, v = c; i < length; i++, v /= SEGMENT_MODE_COUNT) modes[i] = (uint8_t) (v % SEGMENT_MODE_COUNT);
+				size_t bits = segmentation_bits(message, modes, length, range);
+				if (bits < best) best = bits;
+			}
+
+			size_t bits = segment_message((const uint8_t *) message, length, range, trace);
+			if (bits != best) return 1000 + t;
+
+			for (size_t i = 0; i < length; i++) modes[i] = trace[i][0];
+			if (segmentation_bits(message, modes, length, range) != bits) return 2000 + t;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test mixed mode data encoding
+ *
+ * Verifies that mixed messages decode back to themselves from every version
+ * range, that the chosen version is never larger than the best single mode
+ * gives, and that an all-digit message encodes exactly as numeric mode does.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_mixed_mode) {
+	const char *messages[] = {
+		"https://EXAMPLE.COM/ORDER/000123456789",
+		"HTTPS://EXAMPLE.COM/ORDER/000123456789",
+		"SKU-0042 lot 77 / 1234567890123 / ABCDEFGHIJ",
+		"a",
+		"",
+	};
+	static word codewords[QR_MAX_CODEWORD_COUNT], reference[QR_MAX_CODEWORD_COUNT];
+	static char decoded[QR_MAX_MESSAGE_LENGTH + 1];
+
+	for (size_t m = 0; m < sizeof(messages) / sizeof(messages[0]); m++) {
+		const uint8_t *message = (const uint8_t *) messages[m];
+		size_t length = strlen(messages[m]);
+		unsigned version = qr_min_version(message, length, QR_EC_LEVEL_H, QR_MODE_MIXED);
+
+		// never larger than any single mode able to hold the whole message
+		for (qr_encoding_mode single = 0; single < QR_MODE_COUNT; single++)
+			if (version > qr_min_version(message, length, QR_EC_LEVEL_H, single)) return 100 + m;
+
+		// one version per count indicator range as well as the smallest
+		const unsigned versions[] = {version, 12, 30};
+		for (size_t v = 0; v < 3; v++) {
+			qr_code qr = { .level = QR_EC_LEVEL_H, .version = versions[v], .mode = QR_MODE_MIXED, .codeword_count = CODEWORD_COUNT[versions[v]], .codewords = codewords };
+
+			memset(codewords, 0xFF, sizeof(codewords));
+			qr_encode_data(&qr, message, length);
+			if (decode_data(&qr, decoded) != length || memcmp(decoded, message, length)) return 200 + (m * 10) + v;
+		}
+	}
+
+	// the URL is shorter mixed than as bytes
+	const uint8_t *url = (const uint8_t *) messages[0];
+	if (qr_min_version(url, strlen(messages[0]), QR_EC_LEVEL_H, QR_MODE_MIXED) >= qr_min_version(url, strlen(messages[0]), QR_EC_LEVEL_H, QR_MODE_BYTE)) return 300;
+
+	qr_code mixed = { .level = QR_EC_LEVEL_M, .version = 0, .mode = QR_MODE_MIXED, .codeword_count = 26, .codewords = codewords };
+	qr_code numeric = { .level = QR_EC_LEVEL_M, .version = 0, .mode = QR_MODE_NUMERIC, .codeword_count = 26, .codewords = reference };
+	qr_encode_data(&mixed, BYTES("01234567"));
+	qr_encode_data(&numeric, BYTES("01234567"));
+	if (memcmp(codewords, reference, 16)) return 400;
+
+	return 0;
+}
+
+/**
+ * @brief Test raising the error correction level within a version
+ *
+ * Verifies that the level is raised to the highest one whose capacity in the
+ * version still holds the message, and never lowered.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(max_level_within_version) {
+	// version 1 data codewords: L 19, M 16, Q 13, H 9
+	if (qr_max_level(BYTES("hello"), QR_EC_LEVEL_M, QR_MODE_MIXED, 0) != QR_EC_LEVEL_H) return 1;
+	if (qr_max_level(BYTES("hello world"), QR_EC_LEVEL_M, QR_MODE_MIXED, 0) != QR_EC_LEVEL_Q) return 2;
+	if (qr_max_level(BYTES("hello world!!"), QR_EC_LEVEL_L, QR_MODE_BYTE, 0) != QR_EC_LEVEL_M) return 3;
+	if (qr_max_level(BYTES("hello world, hello"), QR_EC_LEVEL_L, QR_MODE_BYTE, 0) != QR_EC_LEVEL_L) return 4;
+	if (qr_max_level(BYTES("hello"), QR_EC_LEVEL_H, QR_MODE_BYTE, 0) != QR_EC_LEVEL_H) return 5;
+	if (qr_max_level(BYTES("hello world"), QR_EC_LEVEL_L, QR_MODE_MIXED, 1) != QR_EC_LEVEL_H) return 6;
+
+	return 0;
+}
+
+/**
+ * @brief Test encoding a payload holding NUL bytes
+ *
+ * Verifies that a length-delimited message is encoded in full past its NUL
+ * bytes, in byte mode and split into mixed segments, and that the NUL byte
+ * keeps a message out of the numeric and alphanumeric modes.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_binary_payload) {
+	const uint8_t payload[] = { 0x00, 0x01, 'A', 'B', 0x00, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x00, 0xFF };
+	const qr_encoding_mode modes[] = {QR_MODE_BYTE, QR_MODE_MIXED};
+	static word codewords[QR_MAX_CODEWORD_COUNT];
+	char decoded[sizeof(payload) + 1];
+
+	if (qr_mode_characters(payload + 4, 10, QR_MODE_NUMERIC) != SIZE_MAX) return 100;
+	if (qr_mode_characters(payload + 5, 9, QR_MODE_NUMERIC) != 9) return 101;
+	if (qr_mode_characters(payload, sizeof(payload), QR_MODE_BYTE) != sizeof(payload)) return 102;
+	if (qr_mode_characters(payload + 4, 10, QR_MODE_ALPHANUMERIC) != SIZE_MAX) return 103;
+
+	for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+		unsigned version = qr_min_version(payload, sizeof(payload), QR_EC_LEVEL_M, modes[m]);
+		if (version >= QR_VERSION_COUNT) return 200 + m;
+
+		qr_code qr = { .level = QR_EC_LEVEL_M, .version = version, .mode = modes[m], .codeword_count = CODEWORD_COUNT[version], .codewords = codewords };
+
+		memset(codewords, 0xFF, sizeof(codewords));
+		qr_encode_data(&qr, payload, sizeof(payload));
+		if (decode_data(&qr, decoded) != sizeof(payload) || memcmp(decoded, payload, sizeof(payload))) return 300 + m;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test messages that do not fit the symbol
+ *
+ * Verifies that the data encoder reports messages too long for the symbol's
+ * version and level, longer than any symbol, or outside the symbol's mode,
+ * and leaves the codewords untouched, with and without a workspace.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(encode_data_rejects_unfit_messages) {
+	static uint8_t digits[QR_MAX_MESSAGE_LENGTH + 1];
+	static word codewords[QR_MAX_CODEWORD_COUNT];
+	qr_workspace *workspace = malloc(sizeof(qr_workspace));
+	const struct {
+		qr_encoding_mode mode;
+		unsigned version;
+		size_t length;
+	} cases[] = {
+		{QR_MODE_NUMERIC, 0, 35},                       // 1-M holds 34 digits
+		{QR_MODE_MIXED, 0, 35},
+		{QR_MODE_MIXED, 39, QR_MAX_MESSAGE_LENGTH + 1}, // past the segment trace
+		{QR_MODE_BYTE, 39, 2332},                       // 40-M holds 2331 bytes
+		{QR_MODE_ALPHANUMERIC, 39, 1},                  // lowercase letter
+		{QR_MODE_KANJI, 39, 3},                         // half a character
+	};
+
+	if (!workspace) return 1;
+
+	memset(digits, '1', sizeof(digits));
+	digits[sizeof(digits) - 1] = 'a';
+
+	for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+		const uint8_t *message = cases[c].mode == QR_MODE_ALPHANUMERIC || cases[c].mode == QR_MODE_KANJI ? digits + sizeof(digits) - cases[c].length : digits;
+
+		for (int w = 0; w < 2; w++) {
+			qr_code qr = { .level = QR_EC_LEVEL_M, .version = cases[c].version, .mode = cases[c].mode, .codeword_count = CODEWORD_COUNT[cases[c].version], .codewords = codewords, .workspace = w ? workspace : NULL };
+
+			memset(codewords, 0xA5, sizeof(codewords));
+			if (qr_encode_data(&qr, message, cases[c].length) != -1) {
+				free(workspace);
+				return 100 + (c * 10) + w;
+			}
+			for (size_t i = 0; i < qr.codeword_count; i++) {
+				if (codewords[i] != 0xA5) {
+					free(workspace);
+					return 200 + (c * 10) + w;
+				}
+			}
+		}
+	}
+
+	free(workspace);
+	return 0;
+}
@@ -9,6 +9,7 @@
 #include <test/base.h>
 #include <qr/types.h>
 #include <qr/matrix.h>
+#include <qr/patterns.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -28,7 +29,7 @@ static qr_code *create_test_qr(unsigned version, size_t size) {
 
 	qr->version = version;
 	qr->side_length = size;
-	qr->matrix = calloc(size * size, sizeof(int));
+	qr->matrix = calloc(1, qr_matrix_size(size));
 	
 	if (!qr->matrix) {
 		free(qr);
@@ -68,7 +69,7 @@ TEST(codeword_placement) {
 	if (!qr) return 1;
 
 	// Initialize all matrix modules to QR_MODULE_LIGHT (0)
-	memset(qr->matrix, 0, size * size * sizeof(int));
+	memset(qr->matrix, 0, qr_matrix_size(size));
 
 	// Allocate and initialize test codewords (all bits set to 1)
 	qr->codewords = calloc(num_codewords, sizeof(word));
@@ -82,7 +83,10 @@ TEST(codeword_placement) {
 	memset(qr->codewords, 0xFF, num_codewords * sizeof(word));
 
 	// Place codewords in the matrix
-	qr_place_codewords(qr);
+	if (qr_place_codewords(qr)) {
+		free_test_qr(qr);
+		return 1;
+	}
 
 	// Verify the results
 	for (size_t i = 0; i < size; i++) {
@@ -213,3 +217,150 @@ TEST(module_edge_cases) {
 	free_test_qr(qr);
 	return 0;
 }
+
+/**
+ * @brief Test the packed row layout
+ *
+ * Verifies that modules are stored one bit per module, that every row starts
+ * on a fresh word and that the row accessor sees the same bits as qr_module_get.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(matrix_row_packing) {
+	const size_t size = 177;  // Version 40 QR code
+	qr_code *qr = create_test_qr(39, size);
+	if (!qr) return 1;
+
+	if (QR_ROW_WORDS(size) != 3) {
+		free_test_qr(qr);
+		return 2;
+	}
+
+	qr_module_set(qr, 5, 0, QR_MODULE_DARK);
+	qr_module_set(qr, 5, 64, QR_MODULE_DARK);
+	qr_module_set(qr, 5, 176, QR_MODULE_DARK);
+	qr_module_set(qr, 6, 1, QR_MODULE_DARK);
+
+	const qr_module_word *row = qr_matrix_row(qr, 5);
+	if (row[0] != 1 || row[1] != 1 || row[2] != ((qr_module_word) 1 << 48)) {
+		free_test_qr(qr);
+		return 3;
+	}
+
+	if (qr_matrix_row(qr, 6)[0] != 2 || qr_matrix_row(qr, 6) != row + 3) {
+		free_test_qr(qr);
+		return 4;
+	}
+
+	qr_module_set(qr, 5, 64, QR_MODULE_LIGHT);
+	if (row[1] != 0 || qr_module_get(qr, 5, 176) != QR_MODULE_DARK) {
+		free_test_qr(qr);
+		return 5;
+	}
+
+	free_test_qr(qr);
+	return 0;
+}
+
+/**
+ * @brief Test the precomputed reservation bitmaps
+ *
+ * Verifies for every version that the cached bitmap returned by
+ * qr_reserved_map agrees with the geometric reservation rules.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(reserved_map_all_versions) {
+	for (unsigned version = 0; version < QR_VERSION_COUNT; version++) {
+		qr_code *qr = create_test_qr(version, QR_SIDE_LENGTH(version));
+		if (!qr) return 1;
+
+		for (size_t i = 0; i < qr->side_length; i++) {
+			for (size_t j = 0; j < qr->side_length; j++) {
+				if (qr_module_is_reserved(qr, i, j) != module_is_reserved_uncached(qr, i, j)) {
+					free_test_qr(qr);
+					return 1000 + version;
+				}
+			}
+		}
+
+		free_test_qr(qr);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test the precomputed codeword placement maps
+ *
+ * Verifies for every version that the placement map covers each data module
+ * exactly once and never points into a reserved module.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(placement_map_all_versions) {
+	for (unsigned version = 0; version < QR_VERSION_COUNT; version++) {
+		qr_code *qr = create_test_qr(version, QR_SIDE_LENGTH(version));
+		if (!qr) return 1;
+
+		size_t length;
+		const uint16_t *map = qr_placement_map(version, &length);
+		if (!map) {
+			free_test_qr(qr);
+			return 1;
+		}
+
+		for (size_t bit = 0; bit < length; bit++) {
+			size_t i = map[bit] / (QR_ROW_WORDS(qr->side_length) * QR_MODULE_WORD_BITS);
+			size_t j = map[bit] % (QR_ROW_WORDS(qr->side_length) * QR_MODULE_WORD_BITS);
+
+			if (qr_module_is_reserved(qr, i, j) || qr_module_get(qr, i, j) == QR_MODULE_DARK) {
+				free_test_qr(qr);
+				return 1000 + version;  // Reserved or already visited module
+			}
+			qr_module_set(qr, i, j, QR_MODULE_DARK);
+		}
+
+		for (size_t i = 0; i < qr->side_length; i++) {
+			for (size_t j = 0; j < qr->side_length; j++) {
+				if (!qr_module_is_reserved(qr, i, j) && qr_module_get(qr, i, j) != QR_MODULE_DARK) {
+					free_test_qr(qr);
+					return 2000 + version;  // Data module never visited
+				}
+			}
+		}
+
+		free_test_qr(qr);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test the cached version skeletons
+ *
+ * Verifies for every version that copying the skeleton yields the same
+ * matrix as painting finder, separator, timing and alignment patterns.
+ *
+ * @return 0 on success, non-zero on failure
+ */
+TEST(skeleton_all_versions) {
+	for (unsigned version = 0; version < QR_VERSION_COUNT; version++) {
+		qr_code *painted = create_test_qr(version, QR_SIDE_LENGTH(version));
+		qr_code *copied = create_test_qr(version, QR_SIDE_LENGTH(version));
+		if (!painted || !copied) return 1;
+
+		qr_finder_patterns_apply(painted);
+		qr_separators_apply(painted);
+		qr_timing_patterns_apply(painted);
+		qr_alignment_patterns_apply(painted);
+		qr_skeleton_apply(copied);
+
+		int mismatch = memcmp(painted->matrix, copied->matrix, qr_matrix_size(painted->side_length));
+		free_test_qr(painted);
+		free_test_qr(copied);
+		if (mismatch) return 1000 + version;
+	}
+
+	return 0;
+}